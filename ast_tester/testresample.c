@@ -0,0 +1,729 @@
+#include "ast.h"
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+/* The maximum number of pixels in each slab of a large array is
+   protected, so is declared here. */
+int astSlabPix_( int, int * );
+
+/* Size of the test grids. */
+#define NX 120
+#define NY 90
+
+static void ukern( double offset, const double params[], int flags,
+                   double *value, int *status );
+static AstMapping *MakeMapping( void );
+static void MakeData( double *in, double *in_var );
+static void TestThreads( AstMapping *map, const double *in,
+                         const double *in_var );
+static void TestPlan( AstMapping *map, const double *in,
+                      const double *in_var );
+static void TestMany( AstMapping *map, const double *in,
+                      const double *in_var );
+static void TestKernTab( AstMapping *map, const double *in );
+static void TestBlockTab( AstMapping *map, const double *in,
+                          const double *in_var );
+static void TestResample8( AstMapping *map, const double *in,
+                           const double *in_var );
+static void TestTranGrid8( AstMapping *map );
+static void TestCopy( const double *in, const double *in_var );
+static void TestMask8( AstMapping *map, const double *in );
+static void NullPutErr( int status_value, const char *message );
+
+int main(){
+   AstMapping *map;
+   double in[ NX*NY ];
+   double in_var[ NX*NY ];
+
+   astBegin;
+
+   map = MakeMapping();
+   MakeData( in, in_var );
+
+   TestThreads( map, in, in_var );
+   TestPlan( map, in, in_var );
+   TestMany( map, in, in_var );
+   TestKernTab( map, in );
+   TestBlockTab( map, in, in_var );
+   TestResample8( map, in, in_var );
+   TestTranGrid8( map );
+   TestMask8( map, in );
+   TestCopy( in, in_var );
+
+   astEnd;
+
+   if( astOK ) {
+      printf(" All Resample tests passed\n");
+   } else {
+      printf("Resample tests failed\n");
+   }
+   return 0;
+}
+
+/* Create a non-linear Mapping from input to output pixel coordinates, so
+   that the resampling functions need to sub-divide the output grid. */
+static AstMapping *MakeMapping( void ){
+   double cen[ 2 ] = { 60.0, 45.0 };
+   double shift[ 2 ] = { 3.37, -2.61 };
+   AstMapping *map;
+
+   map = (AstMapping *) astCmpMap( astPcdMap( 2.0E-5, cen, " " ),
+                                   astZoomMap( 2, 1.07, " " ), 1, " " );
+   map = (AstMapping *) astCmpMap( map, astShiftMap( 2, shift, " " ), 1,
+                                   " " );
+   return map;
+}
+
+/* Fill the input data and variance arrays, including some bad values. */
+static void MakeData( double *in, double *in_var ){
+   int i;
+   for( i = 0; i < NX*NY; i++ ) {
+      in[ i ] = sin( 0.1*( i % NX ) ) * cos( 0.07*( i / NX ) ) + 0.01*i;
+      in_var[ i ] = 1.0 + 0.5*cos( 0.3*i );
+      if( i % 97 == 13 ) in[ i ] = AST__BAD;
+   }
+}
+
+/* A simple user-supplied 1-d kernel. */
+static void ukern( double offset, const double params[], int flags,
+                   double *value, int *status ){
+   *value = exp( -offset*offset );
+}
+
+/* Check that resampling with several threads gives results that are
+   identical to those obtained with a single thread, for every
+   interpolation scheme. */
+static void TestThreads( AstMapping *map, const double *in,
+                         const double *in_var ){
+   int interp[] = { AST__NEAREST, AST__LINEAR, AST__SINC, AST__SINCSINC,
+                    AST__SINCCOS, AST__SINCGAUSS, AST__SOMB, AST__SOMBCOS,
+                    AST__GAUSS, AST__BLOCKAVE, AST__UKERN1 };
+   int flags[] = { 0, AST__USEVAR, AST__CONSERVEFLUX | AST__USEVAR };
+   const int nscheme = sizeof( interp )/sizeof( interp[ 0 ] );
+   const int nflag = sizeof( flags )/sizeof( flags[ 0 ] );
+   double params[] = { 2.0, 2.0 };
+   double out1[ NX*NY ], out2[ NX*NY ], var1[ NX*NY ], var2[ NX*NY ];
+   int lbnd[ 2 ] = { 1, 1 };
+   int ubnd[ 2 ] = { NX, NY };
+   int ischeme, iflag, nbad1, nbad2, nthread, oldn;
+   void (*finterp)( void );
+
+   oldn = astTune( "NThread", AST__TUNULL );
+
+   for( ischeme = 0; ischeme < nscheme && astOK; ischeme++ ) {
+      finterp = ( interp[ ischeme ] == AST__UKERN1 ) ?
+                (void (*)( void )) ukern : NULL;
+      params[ 0 ] = ( interp[ ischeme ] == AST__BLOCKAVE ) ? 1.0 : 2.0;
+
+      for( iflag = 0; iflag < nflag && astOK; iflag++ ) {
+         astTune( "NThread", 1 );
+         nbad1 = astResampleD( map, 2, lbnd, ubnd, in, in_var,
+                               interp[ ischeme ], finterp, params,
+                               flags[ iflag ], 0.1, 20, AST__BAD, 2,
+                               lbnd, ubnd, lbnd, ubnd, out1, var1 );
+
+         for( nthread = 2; nthread <= 5 && astOK; nthread += 3 ) {
+            astTune( "NThread", nthread );
+            nbad2 = astResampleD( map, 2, lbnd, ubnd, in, in_var,
+                                  interp[ ischeme ], finterp, params,
+                                  flags[ iflag ], 0.1, 20, AST__BAD, 2,
+                                  lbnd, ubnd, lbnd, ubnd, out2, var2 );
+            if( astOK ) {
+               if( nbad1 != nbad2 ) {
+                  astError( AST__INTER, "TestThreads: scheme %d flags %d "
+                            "NThread %d: %d bad values (%d expected).",
+                            interp[ ischeme ], flags[ iflag ], nthread,
+                            nbad2, nbad1 );
+               } else if( memcmp( out1, out2, sizeof( out1 ) ) ) {
+                  astError( AST__INTER, "TestThreads: scheme %d flags %d "
+                            "NThread %d: output data differ.",
+                            interp[ ischeme ], flags[ iflag ], nthread );
+               } else if( ( flags[ iflag ] & AST__USEVAR ) &&
+                          memcmp( var1, var2, sizeof( var1 ) ) ) {
+                  astError( AST__INTER, "TestThreads: scheme %d flags %d "
+                            "NThread %d: output variances differ.",
+                            interp[ ischeme ], flags[ iflag ], nthread );
+               }
+            }
+         }
+      }
+   }
+
+   astTune( "NThread", oldn );
+}
+
+/* Check that resampling with a stored plan (AST__USEPLAN) gives results
+   that are identical to those obtained without a plan, both when the
+   plan is created and when it is re-used for a different input array. */
+static void TestPlan( AstMapping *map, const double *in,
+                      const double *in_var ){
+   double in2[ NX*NY ];
+   double out1[ NX*NY ], out2[ NX*NY ], var1[ NX*NY ], var2[ NX*NY ];
+   double params[] = { 2.0, 2.0 };
+   int lbnd[ 2 ] = { 1, 1 };
+   int ubnd[ 2 ] = { NX, NY };
+   int i, iuse, nbad1, nbad2;
+   const double *data;
+
+   for( i = 0; i < NX*NY; i++ ) {
+      in2[ i ] = ( in[ i ] != AST__BAD ) ? 2.0*in[ i ] - 1.0 : AST__BAD;
+   }
+
+   for( iuse = 0; iuse < 3 && astOK; iuse++ ) {
+      data = ( iuse == 2 ) ? in2 : in;
+
+      nbad1 = astResampleD( map, 2, lbnd, ubnd, data, in_var, AST__SINCSINC,
+                            NULL, params, AST__USEVAR, 0.1, 20, AST__BAD,
+                            2, lbnd, ubnd, lbnd, ubnd, out1, var1 );
+      nbad2 = astResampleD( map, 2, lbnd, ubnd, data, in_var, AST__SINCSINC,
+                            NULL, params, AST__USEVAR | AST__USEPLAN, 0.1,
+                            20, AST__BAD, 2, lbnd, ubnd, lbnd, ubnd, out2,
+                            var2 );
+      if( astOK ) {
+         if( nbad1 != nbad2 ) {
+            astError( AST__INTER, "TestPlan: use %d: %d bad values (%d "
+                      "expected).", iuse, nbad2, nbad1 );
+         } else if( memcmp( out1, out2, sizeof( out1 ) ) ) {
+            astError( AST__INTER, "TestPlan: use %d: output data differ.",
+                      iuse );
+         } else if( memcmp( var1, var2, sizeof( var1 ) ) ) {
+            astError( AST__INTER, "TestPlan: use %d: output variances "
+                      "differ.", iuse );
+         }
+      }
+   }
+}
+
+/* Check that resampling several grids with astResampleMany gives results
+   that are identical to those obtained by resampling each grid with a
+   separate call to astResample. The second grid has no variances. */
+#define NPLANE 3
+static void TestMany( AstMapping *map, const double *in,
+                      const double *in_var ){
+   const double *inp[ NPLANE ], *in_varp[ NPLANE ];
+   double *outp[ NPLANE ], *out_varp[ NPLANE ];
+   double in2[ NPLANE ][ NX*NY ];
+   double out1[ NPLANE ][ NX*NY ], var1[ NPLANE ][ NX*NY ];
+   double out2[ NPLANE ][ NX*NY ], var2[ NPLANE ][ NX*NY ];
+   double params[] = { 2.0, 2.0 };
+   int interp[] = { AST__NEAREST, AST__LINEAR, AST__SINCGAUSS };
+   const int nscheme = sizeof( interp )/sizeof( interp[ 0 ] );
+   int lbnd[ 2 ] = { 1, 1 };
+   int ubnd[ 2 ] = { NX, NY };
+   int i, iplane, ischeme, nbad1, nbad2;
+
+   for( iplane = 0; iplane < NPLANE; iplane++ ) {
+      for( i = 0; i < NX*NY; i++ ) {
+         in2[ iplane ][ i ] = ( in[ i ] != AST__BAD ) ?
+                              in[ i ] + iplane*cos( 0.01*i ) : AST__BAD;
+      }
+      inp[ iplane ] = in2[ iplane ];
+      in_varp[ iplane ] = ( iplane == 1 ) ? NULL : in_var;
+      outp[ iplane ] = out2[ iplane ];
+      out_varp[ iplane ] = ( iplane == 1 ) ? NULL : var2[ iplane ];
+   }
+
+   for( ischeme = 0; ischeme < nscheme && astOK; ischeme++ ) {
+      nbad1 = 0;
+      for( iplane = 0; iplane < NPLANE; iplane++ ) {
+         nbad1 += astResampleD( map, 2, lbnd, ubnd, inp[ iplane ],
+                                in_varp[ iplane ], interp[ ischeme ], NULL,
+                                params, AST__USEVAR | AST__USEBAD, 0.1, 20,
+                                AST__BAD, 2, lbnd, ubnd, lbnd, ubnd,
+                                out1[ iplane ],
+                                out_varp[ iplane ] ? var1[ iplane ] : NULL );
+      }
+
+      nbad2 = astResampleManyD( map, 2, lbnd, ubnd, NPLANE, inp, in_varp,
+                                interp[ ischeme ], NULL, params,
+                                AST__USEVAR | AST__USEBAD, 0.1, 20,
+                                AST__BAD, 2, lbnd, ubnd, lbnd, ubnd, outp,
+                                out_varp );
+
+      if( astOK ) {
+         if( nbad1 != nbad2 ) {
+            astError( AST__INTER, "TestMany: scheme %d: %d bad values (%d "
+                      "expected).", interp[ ischeme ], nbad2, nbad1 );
+         }
+         for( iplane = 0; iplane < NPLANE && astOK; iplane++ ) {
+            if( memcmp( out1[ iplane ], out2[ iplane ],
+                        sizeof( out1[ iplane ] ) ) ) {
+               astError( AST__INTER, "TestMany: scheme %d: output data "
+                         "differ for grid %d.", interp[ ischeme ], iplane );
+            } else if( out_varp[ iplane ] &&
+                       memcmp( var1[ iplane ], var2[ iplane ],
+                               sizeof( var1[ iplane ] ) ) ) {
+               astError( AST__INTER, "TestMany: scheme %d: output "
+                         "variances differ for grid %d.", interp[ ischeme ],
+                         iplane );
+            }
+         }
+      }
+   }
+}
+#undef NPLANE
+
+/* Check that resampling with a tabulated kernel (AST__KERNTAB) gives
+   results that agree with those obtained by evaluating the kernel
+   directly. Each kernel value has an error of at most params[2], so the
+   error in each normalised output value should be no more than about
+   (2*neighb)^2*params[2] times the largest input value (about 100). The
+   second accuracy requires cubic interpolation. It is not used with the
+   Somb kernels, which are evaluated using a Bessel function approximation
+   that is not smooth enough. An accuracy that cannot be achieved should
+   cause an error to be reported. */
+static void TestKernTab( AstMapping *map, const double *in ){
+   int interp[] = { AST__SINC, AST__SINCSINC, AST__SINCCOS,
+                    AST__SINCGAUSS, AST__SOMB, AST__SOMBCOS, AST__GAUSS };
+   double acc[] = { 1.0E-6, 1.0E-11 };
+   const int nscheme = sizeof( interp )/sizeof( interp[ 0 ] );
+   const int nacc = sizeof( acc )/sizeof( acc[ 0 ] );
+   double out1[ NX*NY ], out2[ NX*NY ];
+   double params[] = { 2.0, 2.0, 0.0 };
+   double err, maxerr;
+   int lbnd[ 2 ] = { 1, 1 };
+   int ubnd[ 2 ] = { NX, NY };
+   int i, iacc, ischeme, nbad1, nbad2;
+
+   for( ischeme = 0; ischeme < nscheme && astOK; ischeme++ ) {
+      nbad1 = astResampleD( map, 2, lbnd, ubnd, in, NULL, interp[ ischeme ],
+                            NULL, params, AST__USEBAD, 0.1, 20, AST__BAD, 2,
+                            lbnd, ubnd, lbnd, ubnd, out1, NULL );
+
+      for( iacc = 0; iacc < nacc && astOK; iacc++ ) {
+         if( iacc > 0 && ( interp[ ischeme ] == AST__SOMB ||
+                           interp[ ischeme ] == AST__SOMBCOS ) ) break;
+         params[ 2 ] = acc[ iacc ];
+         nbad2 = astResampleD( map, 2, lbnd, ubnd, in, NULL,
+                               interp[ ischeme ], NULL, params,
+                               AST__USEBAD | AST__KERNTAB, 0.1, 20, AST__BAD,
+                               2, lbnd, ubnd, lbnd, ubnd, out2, NULL );
+         if( astOK ) {
+            maxerr = 0.0;
+            for( i = 0; i < NX*NY; i++ ) {
+               if( ( out1[ i ] == AST__BAD ) != ( out2[ i ] == AST__BAD ) ) {
+                  maxerr = AST__BAD;
+                  break;
+               } else if( out1[ i ] != AST__BAD ) {
+                  err = fabs( out1[ i ] - out2[ i ] );
+                  if( err > maxerr ) maxerr = err;
+               }
+            }
+            if( nbad1 != nbad2 || maxerr == AST__BAD ) {
+               astError( AST__INTER, "TestKernTab: scheme %d accuracy %g: "
+                         "bad pixels differ.", interp[ ischeme ],
+                         acc[ iacc ] );
+            } else if( maxerr > 16*100*acc[ iacc ] ) {
+               astError( AST__INTER, "TestKernTab: scheme %d accuracy %g: "
+                         "output data differ by up to %g.", interp[ ischeme ],
+                         acc[ iacc ], maxerr );
+            }
+         }
+      }
+      params[ 2 ] = 0.0;
+   }
+
+   if( astOK ) {
+      astSetPutErr( NullPutErr );
+      params[ 2 ] = 1.0E-20;
+      astResampleD( map, 2, lbnd, ubnd, in, NULL, AST__SINC, NULL, params,
+                    AST__USEBAD | AST__KERNTAB, 0.1, 20, AST__BAD, 2, lbnd,
+                    ubnd, lbnd, ubnd, out2, NULL );
+      if( astOK ) {
+         astError( AST__INTER, "TestKernTab: no error reported for an "
+                   "unachievable table accuracy." );
+      } else if( astStatus == AST__BDPAR ) {
+         astClearStatus;
+      }
+      astSetPutErr( NULL );
+   }
+}
+
+/* Check that block averaging using summed-area tables (AST__BLOCKTAB)
+   gives results that agree with those obtained by summing over each
+   block directly, to within rounding errors. The input variances include
+   bad, zero and negative values, all of which should cause the input
+   pixel to be ignored by both methods. */
+static void TestBlockTab( AstMapping *map, const double *in,
+                          const double *in_var ){
+   double var2[ NX*NY ];
+   double out1[ NX*NY ], out2[ NX*NY ], ovar1[ NX*NY ], ovar2[ NX*NY ];
+   double params[] = { 0.0 };
+   double blocks[] = { 1.0, 3.0, 7.0 };
+   int flags[] = { AST__USEBAD, AST__USEBAD | AST__USEVAR };
+   const int nblock = sizeof( blocks )/sizeof( blocks[ 0 ] );
+   const int nflag = sizeof( flags )/sizeof( flags[ 0 ] );
+   double err, maxerr;
+   int lbnd[ 2 ] = { 1, 1 };
+   int ubnd[ 2 ] = { NX, NY };
+   int i, iblock, iflag, nbad1, nbad2;
+
+   for( i = 0; i < NX*NY; i++ ) {
+      if( i % 53 == 7 ) {
+         var2[ i ] = 0.0;
+      } else if( i % 59 == 11 ) {
+         var2[ i ] = -1.0;
+      } else if( i % 61 == 17 ) {
+         var2[ i ] = AST__BAD;
+      } else {
+         var2[ i ] = in_var[ i ];
+      }
+   }
+
+   for( iblock = 0; iblock < nblock && astOK; iblock++ ) {
+      params[ 0 ] = blocks[ iblock ];
+      for( iflag = 0; iflag < nflag && astOK; iflag++ ) {
+         nbad1 = astResampleD( map, 2, lbnd, ubnd, in, var2, AST__BLOCKAVE,
+                               NULL, params, flags[ iflag ], 0.1, 20,
+                               AST__BAD, 2, lbnd, ubnd, lbnd, ubnd, out1,
+                               ovar1 );
+         nbad2 = astResampleD( map, 2, lbnd, ubnd, in, var2, AST__BLOCKAVE,
+                               NULL, params, flags[ iflag ] | AST__BLOCKTAB,
+                               0.1, 20, AST__BAD, 2, lbnd, ubnd, lbnd, ubnd,
+                               out2, ovar2 );
+         if( astOK ) {
+            maxerr = 0.0;
+            for( i = 0; i < NX*NY; i++ ) {
+               if( ( out1[ i ] == AST__BAD ) != ( out2[ i ] == AST__BAD ) ||
+                   !isfinite( out1[ i ] ) || !isfinite( out2[ i ] ) ) {
+                  maxerr = AST__BAD;
+                  break;
+               } else if( out1[ i ] != AST__BAD ) {
+                  err = fabs( out1[ i ] - out2[ i ] );
+                  if( err > maxerr ) maxerr = err;
+               }
+               if( flags[ iflag ] & AST__USEVAR ) {
+                  if( ( ovar1[ i ] == AST__BAD ) !=
+                      ( ovar2[ i ] == AST__BAD ) ||
+                      !isfinite( ovar1[ i ] ) || !isfinite( ovar2[ i ] ) ) {
+                     maxerr = AST__BAD;
+                     break;
+                  } else if( ovar1[ i ] != AST__BAD ) {
+                     err = fabs( ovar1[ i ] - ovar2[ i ] );
+                     if( err > maxerr ) maxerr = err;
+                  }
+               }
+            }
+            if( nbad1 != nbad2 || maxerr == AST__BAD ) {
+               astError( AST__INTER, "TestBlockTab: block %g flags %d: "
+                         "bad or non-finite values differ.",
+                         blocks[ iblock ], flags[ iflag ] );
+            } else if( maxerr > 1.0E-9 ) {
+               astError( AST__INTER, "TestBlockTab: block %g flags %d: "
+                         "output values differ by up to %g.",
+                         blocks[ iblock ], flags[ iflag ], maxerr );
+            }
+         }
+      }
+   }
+}
+
+/* Check that resampling with astResample8 gives results that are
+   identical to those obtained with astResample when the arrays are
+   divided into slabs. The maximum number of pixels in a slab is reduced
+   so that the small test arrays are divided into several slabs, and
+   the output region covers only part of the output grid. The tolerances
+   used include zero and a value that allows a single linear fit to be
+   used for large sections. An error should be reported if a single
+   plane of the arrays is too large. */
+static void TestResample8( AstMapping *map, const double *in,
+                           const double *in_var ){
+   double out1[ NX*NY ], out2[ NX*NY ], var1[ NX*NY ], var2[ NX*NY ];
+   double params[] = { 2.0, 2.0 };
+   double tol[] = { 0.1, 0.0, 0.1, 2.0 };
+   int maxpix[] = { 20, 20, 1000, 1000 };
+   int interp[] = { AST__NEAREST, AST__LINEAR, AST__SINCSINC, AST__GAUSS,
+                    AST__BLOCKAVE, AST__UKERN1 };
+   int flags[] = { AST__USEBAD, AST__USEBAD | AST__USEVAR,
+                   AST__USEBAD | AST__USEVAR | AST__CONSERVEFLUX };
+   int slab[] = { 4000, 2000 };
+   const int nscheme = sizeof( interp )/sizeof( interp[ 0 ] );
+   const int nflag = sizeof( flags )/sizeof( flags[ 0 ] );
+   const int ntol = sizeof( tol )/sizeof( tol[ 0 ] );
+   const int nslab = sizeof( slab )/sizeof( slab[ 0 ] );
+   int lbnd_in[ 2 ] = { 1, 1 };
+   int ubnd_in[ 2 ] = { NX, NY };
+   int lbnd[ 2 ] = { 4, 3 };
+   int ubnd[ 2 ] = { NX - 5, NY - 2 };
+   int64_t lbnd_in8[ 2 ] = { 1, 1 };
+   int64_t ubnd_in8[ 2 ] = { NX, NY };
+   int64_t lbnd8[ 2 ] = { 4, 3 };
+   int64_t ubnd8[ 2 ] = { NX - 5, NY - 2 };
+   int i, iflag, ischeme, islab, itol, nbad1, oldslab;
+   int64_t nbad2;
+   void (*finterp)( void );
+
+   if( !astOK ) return;
+   oldslab = astSlabPix_( AST__TUNULL, astGetStatusPtr );
+
+   for( ischeme = 0; ischeme < nscheme && astOK; ischeme++ ) {
+      finterp = ( interp[ ischeme ] == AST__UKERN1 ) ?
+                (void (*)( void )) ukern : NULL;
+      params[ 0 ] = ( interp[ ischeme ] == AST__BLOCKAVE ) ? 1.0 : 2.0;
+
+      for( iflag = 0; iflag < nflag && astOK; iflag++ ) {
+         for( itol = 0; itol < ntol && astOK; itol++ ) {
+            if( tol[ itol ] == 0.0 &&
+                ( flags[ iflag ] & AST__CONSERVEFLUX ) ) continue;
+
+            for( i = 0; i < NX*NY; i++ ) {
+               out1[ i ] = out2[ i ] = -1.0;
+               var1[ i ] = var2[ i ] = -1.0;
+            }
+
+            nbad1 = astResampleD( map, 2, lbnd_in, ubnd_in, in, in_var,
+                                  interp[ ischeme ], finterp, params,
+                                  flags[ iflag ], tol[ itol ],
+                                  maxpix[ itol ], AST__BAD, 2, lbnd_in,
+                                  ubnd_in, lbnd, ubnd, out1, var1 );
+
+            for( islab = 0; islab < nslab && astOK; islab++ ) {
+               astSlabPix_( slab[ islab ], astGetStatusPtr );
+               nbad2 = astResample8D( map, 2, lbnd_in8, ubnd_in8, in,
+                                      in_var, interp[ ischeme ], finterp,
+                                      params, flags[ iflag ], tol[ itol ],
+                                      maxpix[ itol ], AST__BAD, 2,
+                                      lbnd_in8, ubnd_in8, lbnd8, ubnd8,
+                                      out2, var2 );
+               astSlabPix_( oldslab, astGetStatusPtr );
+
+               if( astOK ) {
+                  if( nbad1 != nbad2 ) {
+                     astError( AST__INTER, "TestResample8: scheme %d flags "
+                               "%d tol %g slab %d: %d bad values (%d "
+                               "expected).", interp[ ischeme ],
+                               flags[ iflag ], tol[ itol ], slab[ islab ],
+                               (int) nbad2, nbad1 );
+                  } else if( memcmp( out1, out2, sizeof( out1 ) ) ) {
+                     astError( AST__INTER, "TestResample8: scheme %d flags "
+                               "%d tol %g slab %d: output data differ.",
+                               interp[ ischeme ], flags[ iflag ],
+                               tol[ itol ], slab[ islab ] );
+                  } else if( memcmp( var1, var2, sizeof( var1 ) ) ) {
+                     astError( AST__INTER, "TestResample8: scheme %d flags "
+                               "%d tol %g slab %d: output variances "
+                               "differ.", interp[ ischeme ], flags[ iflag ],
+                               tol[ itol ], slab[ islab ] );
+                  }
+               }
+            }
+         }
+      }
+   }
+
+   if( astOK ) {
+      astSetPutErr( NullPutErr );
+      astSlabPix_( NX - 1, astGetStatusPtr );
+      astResample8D( map, 2, lbnd_in8, ubnd_in8, in, in_var, AST__LINEAR,
+                     NULL, params, 0, 0.1, 20, AST__BAD, 2, lbnd_in8,
+                     ubnd_in8, lbnd8, ubnd8, out2, NULL );
+      astSlabPix_( oldslab, astGetStatusPtr );
+      astSetPutErr( NULL );
+      if( astStatus == AST__EXSPIX ) {
+         astClearStatus;
+      } else if( astOK ) {
+         astError( AST__INTER, "TestResample8: no error reported for a "
+                   "plane that is too large." );
+      }
+   }
+}
+
+/* Check that astTranGrid8 gives the same positions as astTranGrid when
+   the grid is divided into slabs. */
+static void TestTranGrid8( AstMapping *map ){
+   static double out1[ 2*NX*NY ], out2[ 2*NX*NY ];
+   double tol[] = { 0.1, 0.0, 0.1, 2.0 };
+   int maxpix[] = { 20, 20, 1000, 1000 };
+   int slab[] = { 1000, 500 };
+   const int ntol = sizeof( tol )/sizeof( tol[ 0 ] );
+   const int nslab = sizeof( slab )/sizeof( slab[ 0 ] );
+   int lbnd[ 2 ] = { -3, 2 };
+   int ubnd[ 2 ] = { NX - 7, NY + 1 };
+   int64_t lbnd8[ 2 ] = { -3, 2 };
+   int64_t ubnd8[ 2 ] = { NX - 7, NY + 1 };
+   int forward, i, islab, itol, oldslab;
+
+   if( !astOK ) return;
+   oldslab = astSlabPix_( AST__TUNULL, astGetStatusPtr );
+
+   for( forward = 0; forward < 2 && astOK; forward++ ) {
+      for( itol = 0; itol < ntol && astOK; itol++ ) {
+         for( i = 0; i < 2*NX*NY; i++ ) out1[ i ] = out2[ i ] = -1.0;
+         astTranGrid( map, 2, lbnd, ubnd, tol[ itol ], maxpix[ itol ],
+                      forward, 2, NX*NY, out1 );
+
+         for( islab = 0; islab < nslab && astOK; islab++ ) {
+            astSlabPix_( slab[ islab ], astGetStatusPtr );
+            astTranGrid8( map, 2, lbnd8, ubnd8, tol[ itol ], maxpix[ itol ],
+                          forward, 2, NX*NY, out2 );
+            astSlabPix_( oldslab, astGetStatusPtr );
+
+            if( astOK && memcmp( out1, out2, sizeof( out1 ) ) ) {
+               astError( AST__INTER, "TestTranGrid8: forward %d tol %g "
+                         "slab %d: output positions differ.", forward,
+                         tol[ itol ], slab[ islab ] );
+            }
+         }
+      }
+   }
+
+   if( astOK ) {
+      astSetPutErr( NullPutErr );
+      astSlabPix_( NX - 10, astGetStatusPtr );
+      astTranGrid8( map, 2, lbnd8, ubnd8, 0.1, 20, 1, 2, NX*NY, out2 );
+      astSlabPix_( oldslab, astGetStatusPtr );
+      astSetPutErr( NULL );
+      if( astStatus == AST__EXSPIX ) {
+         astClearStatus;
+      } else if( astOK ) {
+         astError( AST__INTER, "TestTranGrid8: no error reported for a "
+                   "plane that is too large." );
+      }
+   }
+}
+
+/* Check that astMask8<X> masks the same pixels as astMask<X> when the
+   array is divided into slabs. */
+static void TestMask8( AstMapping *map, const double *in ){
+   static double out1[ NX*NY ], out2[ NX*NY ];
+   AstFrame *frm;
+   AstMapping *mask_map;
+   AstRegion *reg;
+   double centre[ 2 ] = { 55.3, 41.8 };
+   double radius[ 1 ] = { 30.7 };
+   int lbnd[ 2 ] = { 1, 1 };
+   int ubnd[ 2 ] = { NX, NY };
+   int64_t lbnd8[ 2 ] = { 1, 1 };
+   int64_t ubnd8[ 2 ] = { NX, NY };
+   int i, inside, nmask1, oldslab, usemap;
+   int64_t nmask2;
+
+   if( !astOK ) return;
+   oldslab = astSlabPix_( AST__TUNULL, astGetStatusPtr );
+
+   astBegin;
+   frm = astFrame( 2, "Domain=grid" );
+   reg = (AstRegion *) astCircle( frm, 1, centre, radius, NULL, " " );
+
+   for( usemap = 0; usemap < 2 && astOK; usemap++ ) {
+      for( inside = 0; inside < 2 && astOK; inside++ ) {
+         mask_map = usemap ? map : NULL;
+         for( i = 0; i < NX*NY; i++ ) out1[ i ] = out2[ i ] = in[ i ];
+         nmask1 = astMaskD( reg, mask_map, inside, 2, lbnd, ubnd, out1,
+                            AST__BAD );
+         astSlabPix_( 1000, astGetStatusPtr );
+         nmask2 = astMask8D( reg, mask_map, inside, 2, lbnd8, ubnd8, out2,
+                             AST__BAD );
+         astSlabPix_( oldslab, astGetStatusPtr );
+
+         if( astOK ) {
+            if( nmask1 != nmask2 ) {
+               astError( AST__INTER, "TestMask8: map %d inside %d: %d "
+                         "pixels masked (%d expected).", usemap, inside,
+                         (int) nmask2, nmask1 );
+            } else if( memcmp( out1, out2, sizeof( out1 ) ) ) {
+               astError( AST__INTER, "TestMask8: map %d inside %d: masked "
+                         "data differ.", usemap, inside );
+            }
+         }
+      }
+   }
+
+   astEnd;
+}
+
+/* Check that Mappings which move pixels by whole pixels (which are
+   resampled by copying pixels) give the same results as equivalent
+   MathMaps (which are resampled by interpolation). The Mappings are a
+   shift, an axis swap with a shift, and an axis reversal with a shift. */
+static void TestCopy( const double *in, const double *in_var ){
+   static double var[ NX*NY ];
+   double out1[ NX*NY ], out2[ NX*NY ], var1[ NX*NY ], var2[ NX*NY ];
+   double shift1[ 2 ] = { 3.0, -2.0 };
+   double shift2[ 2 ] = { 5.0, -4.0 };
+   double shift3[ 2 ] = { NX - 2.0, 2.0 };
+   double diag[ 2 ] = { -1.0, 1.0 };
+   int perm[ 2 ] = { 2, 1 };
+   const char *fwd[ 3 ][ 2 ] = { { "u=x+3", "v=y-2" },
+                                 { "u=y+5", "v=x-4" },
+                                 { "u=118-x", "v=y+2" } };
+   const char *inv[ 3 ][ 2 ] = { { "x=u-3", "y=v+2" },
+                                 { "x=v+4", "y=u-5" },
+                                 { "x=118-u", "y=v-2" } };
+   int interp[] = { AST__NEAREST, AST__LINEAR };
+   int flags[] = { 0, AST__USEBAD, AST__USEBAD | AST__USEVAR };
+   const int nscheme = sizeof( interp )/sizeof( interp[ 0 ] );
+   const int nflag = sizeof( flags )/sizeof( flags[ 0 ] );
+   int lbnd_in[ 2 ] = { 1, 1 };
+   int ubnd_in[ 2 ] = { NX, NY };
+   int lbnd[ 2 ] = { 2, 1 };
+   int ubnd[ 2 ] = { NX, NY - 3 };
+   int i, iflag, imap, ischeme, nbad1, nbad2;
+   AstMapping *map;
+   AstMapping *mathmap;
+
+   if( !astOK ) return;
+
+/* Use some negative input variances, which are treated as bad. */
+   for( i = 0; i < NX*NY; i++ ) {
+      var[ i ] = ( i % 89 == 7 ) ? -1.0 : in_var[ i ];
+   }
+
+   astBegin;
+   for( imap = 0; imap < 3 && astOK; imap++ ) {
+      if( imap == 0 ) {
+         map = (AstMapping *) astShiftMap( 2, shift1, " " );
+      } else if( imap == 1 ) {
+         map = (AstMapping *) astCmpMap( astPermMap( 2, perm, 2, perm,
+                                                     NULL, " " ),
+                                         astShiftMap( 2, shift2, " " ), 1,
+                                         " " );
+      } else {
+         map = (AstMapping *) astCmpMap( astMatrixMap( 2, 2, 1, diag, " " ),
+                                         astShiftMap( 2, shift3, " " ), 1,
+                                         " " );
+      }
+      mathmap = (AstMapping *) astMathMap( 2, 2, 2, fwd[ imap ], 2,
+                                           inv[ imap ], " " );
+
+      for( ischeme = 0; ischeme < nscheme && astOK; ischeme++ ) {
+         for( iflag = 0; iflag < nflag && astOK; iflag++ ) {
+            for( i = 0; i < NX*NY; i++ ) {
+               out1[ i ] = out2[ i ] = -1.0;
+               var1[ i ] = var2[ i ] = -1.0;
+            }
+
+            nbad1 = astResampleD( mathmap, 2, lbnd_in, ubnd_in, in, var,
+                                  interp[ ischeme ], NULL, NULL,
+                                  flags[ iflag ], 0.0, 100, AST__BAD, 2,
+                                  lbnd_in, ubnd_in, lbnd, ubnd, out1, var1 );
+            nbad2 = astResampleD( map, 2, lbnd_in, ubnd_in, in, var,
+                                  interp[ ischeme ], NULL, NULL,
+                                  flags[ iflag ], 0.1, 100, AST__BAD, 2,
+                                  lbnd_in, ubnd_in, lbnd, ubnd, out2, var2 );
+            if( astOK ) {
+               if( nbad1 != nbad2 ) {
+                  astError( AST__INTER, "TestCopy: map %d scheme %d flags "
+                            "%d: %d bad values (%d expected).", imap,
+                            interp[ ischeme ], flags[ iflag ], nbad2,
+                            nbad1 );
+               } else if( memcmp( out1, out2, sizeof( out1 ) ) ) {
+                  astError( AST__INTER, "TestCopy: map %d scheme %d flags "
+                            "%d: output data differ.", imap,
+                            interp[ ischeme ], flags[ iflag ] );
+               } else if( memcmp( var1, var2, sizeof( var1 ) ) ) {
+                  astError( AST__INTER, "TestCopy: map %d scheme %d flags "
+                            "%d: output variances differ.", imap,
+                            interp[ ischeme ], flags[ iflag ] );
+               }
+            }
+         }
+      }
+   }
+   astEnd;
+}
+
+/* An error handler that discards the messages for expected errors. */
+static void NullPutErr( int status_value, const char *message ){
+}
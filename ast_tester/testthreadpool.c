@@ -0,0 +1,107 @@
+#include "ast.h"
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+
+/* The ThreadPool functions are protected, so are declared here. */
+typedef void (AstJobFun)( int, void *, int * );
+void astRunJobs_( int, AstJobFun *, void *, int * );
+
+/* Numbers of jobs. */
+#define NOUTER 6
+#define NINNER 50
+
+/* Counts of the number of times each job has been executed. */
+typedef struct JobData {
+   int outer[ NOUTER ];
+   int inner[ NOUTER ][ NINNER ];
+} JobData;
+
+static void InnerJob( int ijob, void *data, int *status );
+static void OuterJob( int ijob, void *data, int *status );
+static void *Caller( void *data );
+static int Check( JobData *data );
+
+/* Argument passed to each inner job. */
+typedef struct InnerData {
+   JobData *data;
+   int outer;
+} InnerData;
+
+int main(){
+   JobData data[ 2 ];
+   pthread_t thread[ 2 ];
+   int i, oldn;
+
+   oldn = astTune( "NThread", 4 );
+
+/* Run a set of jobs, each of which runs a further set of jobs. The
+   nested calls should be executed sequentially by the thread that
+   makes them, and every job should be executed exactly once. */
+   memset( data, 0, sizeof( data ) );
+   astRunJobs_( NOUTER, OuterJob, data, astGetStatusPtr );
+   if( astOK && !Check( data ) ) {
+      astError( AST__INTER, "Nested jobs were not all executed once." );
+   }
+
+/* Now make the same call concurrently from two independent threads.
+   Only one of them can use the worker pool at any one time, but both
+   should complete all their jobs. */
+   memset( data, 0, sizeof( data ) );
+   for( i = 0; i < 2 && astOK; i++ ) {
+      if( pthread_create( thread + i, NULL, Caller, data + i ) ) {
+         astError( AST__INTER, "Error creating thread %d.", i );
+      }
+   }
+   for( i = 0; i < 2 && astOK; i++ ) {
+      if( pthread_join( thread[ i ], NULL ) ) {
+         astError( AST__INTER, "Error joining thread %d.", i );
+      } else if( !Check( data + i ) ) {
+         astError( AST__INTER, "Concurrent jobs in thread %d were not all "
+                   "executed once.", i );
+      }
+   }
+
+   astTune( "NThread", oldn );
+
+   if( astOK ) {
+      printf(" All ThreadPool tests passed\n");
+   } else {
+      printf("ThreadPool tests failed\n");
+   }
+   return 0;
+}
+
+/* Make a nested call to astRunJobs from a new thread. */
+static void *Caller( void *data ){
+   int status = 0;
+   astRunJobs_( NOUTER, OuterJob, data, &status );
+   if( status ) ( (JobData *) data )->outer[ 0 ] = -1;
+   return NULL;
+}
+
+/* Each outer job runs a set of inner jobs. */
+static void OuterJob( int ijob, void *data, int *status ){
+   InnerData idata;
+   ( (JobData *) data )->outer[ ijob ]++;
+   idata.data = data;
+   idata.outer = ijob;
+   astRunJobs_( NINNER, InnerJob, &idata, status );
+}
+
+static void InnerJob( int ijob, void *data, int *status ){
+   InnerData *idata = (InnerData *) data;
+   idata->data->inner[ idata->outer ][ ijob ]++;
+}
+
+/* Return non-zero if every job was executed exactly once. */
+static int Check( JobData *data ){
+   int i, j;
+   for( i = 0; i < NOUTER; i++ ) {
+      if( data->outer[ i ] != 1 ) return 0;
+      for( j = 0; j < NINNER; j++ ) {
+         if( data->inner[ i ][ j ] != 1 ) return 0;
+      }
+   }
+   return 1;
+}
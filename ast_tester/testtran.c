@@ -0,0 +1,1214 @@
+#include "ast.h"
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+/* Number of points to transform. This is large enough for the points
+   to be divided between several threads. */
+#define NPOINT 20000
+
+static void CountTran( AstMapping *this, int npoint, int ncoord_in,
+                       const double *ptr_in[], int forward, int ncoord_out,
+                       double *ptr_out[] );
+static void TestTranThreads( void );
+static void TestCompile( void );
+static void TestSimplifyCache( void );
+static void TestChebyApprox( void );
+static void TestJacobian( void );
+static void TestTranGridF( void );
+static void TestFreeze( void );
+static void TestFormatArray( void );
+static void TestNestedPoly( void );
+static void TestIterInverse( void );
+static void CompareFormatArray( AstFrame *frm, int axis, int npoint,
+                                const double *value, const char *name );
+static void CheckImmut( const char *what );
+static void NullPutErr( int status_value, const char *message );
+static void CompareJacobian( AstMapping *map, int forward, double tol,
+                             const char *name );
+static void CompareCompiled( AstMapping *map, const double *in, int forward,
+                             const char *name );
+
+/* The number of points transformed by CountTran since the count was last
+   reset. */
+static int tran_count;
+
+int main(){
+   astBegin;
+
+   TestTranThreads();
+   TestCompile();
+   TestSimplifyCache();
+   TestChebyApprox();
+   TestJacobian();
+   TestTranGridF();
+   TestFreeze();
+   TestFormatArray();
+   TestNestedPoly();
+   TestIterInverse();
+
+   astEnd;
+
+   if( astOK ) {
+      printf(" All Tran tests passed\n");
+   } else {
+      printf("Tran tests failed\n");
+   }
+   return 0;
+}
+
+/* An IntraMap transformation that shifts each point by an amount that
+   depends on the number of points transformed before it, and so gives
+   the expected results only if the points are transformed in order by a
+   single thread. */
+static void CountTran( AstMapping *this, int npoint, int ncoord_in,
+                       const double *ptr_in[], int forward, int ncoord_out,
+                       double *ptr_out[] ){
+   int i;
+   for( i = 0; i < npoint; i++ ) {
+      if( ptr_in[ 0 ][ i ] != AST__BAD && ptr_in[ 1 ][ i ] != AST__BAD ) {
+         ptr_out[ 0 ][ i ] = ptr_in[ 0 ][ i ] + 1.0E-3*tran_count;
+         ptr_out[ 1 ][ i ] = ptr_in[ 1 ][ i ];
+      } else {
+         ptr_out[ 0 ][ i ] = AST__BAD;
+         ptr_out[ 1 ][ i ] = AST__BAD;
+      }
+      tran_count++;
+   }
+}
+
+/* Check that astTranN gives identical results for several values of the
+   NThread tuning parameter. The first Mapping contains an IntraMap, which
+   is not thread safe and so must be transformed by a single thread. The
+   second contains a MathMap and a ZoomMap, which are thread safe. */
+static void TestTranThreads( void ){
+   static double in[ 2*NPOINT ], out1[ 2*NPOINT ], out2[ 2*NPOINT ];
+   const char *fwd[ 2 ] = { "r=x*cos(y)+y*y", "s=x*sin(y)-x" };
+   const char *inv[ 2 ] = { "x", "y" };
+   int i, imap, nthread, oldn;
+   AstMapping *map;
+   AstMapping *mathmap;
+
+   if( !astOK ) return;
+   oldn = astTune( "NThread", AST__TUNULL );
+
+   for( i = 0; i < NPOINT; i++ ) {
+      in[ i ] = 0.01*i;
+      in[ NPOINT + i ] = sin( 0.001*i );
+   }
+   in[ 123 ] = AST__BAD;
+   in[ NPOINT + 9876 ] = AST__BAD;
+
+   astBegin;
+   astIntraReg( "CountTran", 2, 2, CountTran, AST__NOINV,
+                "Shift points by their position in the sequence",
+                "AST tester", "-" );
+   mathmap = (AstMapping *) astMathMap( 2, 2, 2, fwd, 2, inv, " " );
+
+   for( imap = 0; imap < 2 && astOK; imap++ ) {
+      if( imap == 0 ) {
+         map = (AstMapping *) astCmpMap( astIntraMap( "CountTran", 2, 2,
+                                                      " " ),
+                                         mathmap, 1, " " );
+      } else {
+         map = (AstMapping *) astCmpMap( mathmap,
+                                         astZoomMap( 2, 1.3, " " ), 1,
+                                         " " );
+      }
+
+      astTune( "NThread", 1 );
+      tran_count = 0;
+      astTranN( map, NPOINT, 2, NPOINT, in, 1, 2, NPOINT, out1 );
+
+      for( nthread = 3; nthread <= 4 && astOK; nthread++ ) {
+         astTune( "NThread", nthread );
+         tran_count = 0;
+         astTranN( map, NPOINT, 2, NPOINT, in, 1, 2, NPOINT, out2 );
+         if( astOK && memcmp( out1, out2, sizeof( out1 ) ) ) {
+            astError( AST__INTER, "TestTranThreads: map %d NThread %d: "
+                      "transformed positions differ.", imap, nthread );
+         }
+      }
+   }
+
+   astEnd;
+   astTune( "NThread", oldn );
+}
+
+/* Check that the Mappings returned by astCompile transform points in
+   the same way as the Mappings from which they were created. */
+static void TestCompile( void ){
+   static double in[ 2*NPOINT ];
+   const char *cards[] = {
+      "NAXIS   = 2",
+      "NAXIS1  = 1000",
+      "NAXIS2  = 1000",
+      "CTYPE1  = 'RA---TAN'",
+      "CTYPE2  = 'DEC--TAN'",
+      "CRPIX1  = 500.5",
+      "CRPIX2  = 480.0",
+      "CRVAL1  = 83.63",
+      "CRVAL2  = 22.01",
+      "CD1_1   = -2.5E-4",
+      "CD1_2   = 3.0E-5",
+      "CD2_1   = 2.8E-5",
+      "CD2_2   = 2.5E-4",
+      "RADESYS = 'ICRS'",
+      NULL };
+   const char *fwd[ 1 ] = { "y=x+0.1*x*x*x" };
+   const char *inv[ 1 ] = { "x=y" };
+   double cen[ 2 ] = { 0.3, -0.2 };
+   double matrix[ 4 ] = { 0.8, 0.6, -0.6, 0.8 };
+   double shift[ 2 ] = { 1.5, -2.5 };
+   double ina[ 2 ] = { -1.0, -1.0 };
+   double inb[ 2 ] = { 1.0, 1.0 };
+   double outa[ 2 ] = { 10.0, 20.0 };
+   double outb[ 2 ] = { 14.0, 18.0 };
+   int perm[ 2 ] = { 2, 1 };
+   int i;
+   AstFitsChan *fc;
+   AstFrameSet *fs;
+   AstMapping *map;
+
+   if( !astOK ) return;
+   astBegin;
+
+/* A FITS celestial FrameSet, with a conversion from ICRS to galactic
+   coordinates. The points are pixel positions. */
+   fc = astFitsChan( NULL, NULL, " " );
+   for( i = 0; cards[ i ]; i++ ) astPutFits( fc, cards[ i ], 0 );
+   astClear( fc, "Card" );
+   fs = astRead( fc );
+   if( fs ) astSet( fs, "System=Galactic" );
+   for( i = 0; i < NPOINT; i++ ) {
+      in[ i ] = 1.0 + 0.05*i;
+      in[ NPOINT + i ] = 1000.0 - 0.047*i;
+   }
+   CompareCompiled( (AstMapping *) fs, in, 1, "FITS FrameSet" );
+
+/* A deep tree of compound Mappings, with series and parallel
+   components. The points are spread over a small range. */
+   map = (AstMapping *) astCmpMap( astZoomMap( 2, 0.5, " " ),
+                                   astShiftMap( 2, shift, " " ), 1, " " );
+   map = (AstMapping *) astCmpMap( map, astPcdMap( 0.01, cen, " " ), 1,
+                                   " " );
+   map = (AstMapping *) astCmpMap( map, astMatrixMap( 2, 2, 0, matrix,
+                                                      " " ), 1, " " );
+   map = (AstMapping *) astCmpMap( map,
+                                   astCmpMap( astMathMap( 1, 1, 1, fwd, 1,
+                                                          inv, " " ),
+                                              astZoomMap( 1, 3.0, " " ),
+                                              0, " " ), 1, " " );
+   map = (AstMapping *) astCmpMap( map, astPermMap( 2, perm, 2, perm,
+                                                    NULL, " " ), 1, " " );
+   map = (AstMapping *) astCmpMap( map, astWinMap( 2, ina, inb, outa, outb,
+                                                   " " ), 1, " " );
+   for( i = 0; i < NPOINT; i++ ) {
+      in[ i ] = -5.0 + 0.0005*i;
+      in[ NPOINT + i ] = 3.0*sin( 0.01*i );
+   }
+   CompareCompiled( map, in, 1, "CmpMap tree" );
+
+/* The same tree with the inverse transformation (the MathMap inverse
+   is not the true inverse, but the compiled and original Mappings must
+   still agree). */
+   CompareCompiled( map, in, 0, "CmpMap tree" );
+
+   astEnd;
+}
+
+/* Compare the positions produced by a Mapping, its simplified form and
+   its compiled form, using several different numbers of points in each
+   call. The compiled and simplified forms must agree exactly. The
+   original form may differ by rounding errors, since adjacent Mappings
+   are merged. Then check that inverting the original Mapping does not
+   affect the compiled Mapping. */
+static void CompareCompiled( AstMapping *map, const double *in, int forward,
+                             const char *name ){
+   static double out1[ 2*NPOINT ], out2[ 2*NPOINT ], out3[ 2*NPOINT ];
+   int batch[] = { 1, 7, 128, NPOINT };
+   const int nbatch = sizeof( batch )/sizeof( batch[ 0 ] );
+   double tol;
+   int i, ib, ipoint, n;
+   AstMapping *compiled;
+   AstMapping *simple;
+
+   if( !astOK ) return;
+   astBegin;
+
+   compiled = astCompile( map );
+   simple = astSimplify( map );
+
+   for( ib = 0; ib < nbatch && astOK; ib++ ) {
+      for( ipoint = 0; ipoint < NPOINT; ipoint += n ) {
+         n = ( NPOINT - ipoint < batch[ ib ] ) ? NPOINT - ipoint :
+                                                 batch[ ib ];
+         astTranN( map, n, 2, NPOINT, in + ipoint, forward, 2, NPOINT,
+                   out1 + ipoint );
+         astTranN( simple, n, 2, NPOINT, in + ipoint, forward, 2, NPOINT,
+                   out2 + ipoint );
+         astTranN( compiled, n, 2, NPOINT, in + ipoint, forward, 2, NPOINT,
+                   out3 + ipoint );
+      }
+
+      if( astOK ) {
+         if( memcmp( out2, out3, sizeof( out2 ) ) ) {
+            astError( AST__INTER, "TestCompile: %s: compiled and simplified "
+                      "positions differ (batches of %d, forward %d).", name,
+                      batch[ ib ], forward );
+         }
+         for( i = 0; i < 2*NPOINT && astOK; i++ ) {
+            tol = 1.0E-10*( 1.0 + fabs( out1[ i ] ) );
+            if( ( out1[ i ] == AST__BAD ) != ( out3[ i ] == AST__BAD ) ||
+                ( out1[ i ] != AST__BAD &&
+                  fabs( out1[ i ] - out3[ i ] ) > tol ) ) {
+               astError( AST__INTER, "TestCompile: %s: compiled position "
+                         "%g differs from original position %g (batches "
+                         "of %d, forward %d).", name, out3[ i ], out1[ i ],
+                         batch[ ib ], forward );
+            }
+         }
+      }
+   }
+
+   if( astOK ) {
+      astInvert( map );
+      astTranN( compiled, NPOINT, 2, NPOINT, in, forward, 2, NPOINT, out1 );
+      astInvert( map );
+      if( astOK && memcmp( out1, out3, sizeof( out1 ) ) ) {
+         astError( AST__INTER, "TestCompile: %s: compiled Mapping changed "
+                   "when the original was inverted.", name );
+      }
+   }
+
+   astEnd;
+}
+
+/* Check that changes made to the Mapping returned by astSimplify do not
+   affect the Mapping returned by later invocations of astSimplify on the
+   same Mapping (which re-use a stored simplified Mapping). */
+static void TestSimplifyCache( void ){
+   double xin[ 2 ] = { 1.0, -4.0 };
+   double xout[ 2 ];
+   int i;
+   AstMapping *map;
+   AstMapping *simp1;
+   AstMapping *simp2;
+   AstMapping *simp3;
+
+   if( !astOK ) return;
+   astBegin;
+
+/* Two ZoomMaps in series simplify to a single ZoomMap with zoom 6. */
+   map = (AstMapping *) astCmpMap( astZoomMap( 1, 2.0, " " ),
+                                   astZoomMap( 1, 3.0, " " ), 1, " " );
+
+/* Simplify it, then invert the result and change its Zoom. */
+   simp1 = astSimplify( map );
+   if( astOK && !astIsAZoomMap( simp1 ) ) {
+      astError( AST__INTER, "TestSimplifyCache: Simplified Mapping is a "
+                "%s (expected a ZoomMap).", astGetC( simp1, "Class" ) );
+   }
+   astInvert( simp1 );
+   astSetD( simp1, "Zoom", 10.0 );
+
+/* Simplify again. The result should not be affected by the above
+   changes. Then do the same thing to it. */
+   for( i = 0; i < 2 && astOK; i++ ) {
+      simp2 = astSimplify( map );
+      if( astOK && ( simp2 == simp1 || astGetI( simp2, "Invert" ) ||
+                     astGetD( simp2, "Zoom" ) != 6.0 ) ) {
+         astError( AST__INTER, "TestSimplifyCache: Simplified Mapping "
+                   "was changed by a modification to a previous result "
+                   "(pass %d).", i );
+      }
+      astTran1( simp2, 2, xin, 1, xout );
+      if( astOK && ( xout[ 0 ] != 6.0 || xout[ 1 ] != -24.0 ) ) {
+         astError( AST__INTER, "TestSimplifyCache: Simplified Mapping "
+                   "gives %g %g (expected 6 -24) (pass %d).", xout[ 0 ],
+                   xout[ 1 ], i );
+      }
+      astInvert( simp2 );
+      astSetD( simp2, "Zoom", 0.5 );
+   }
+
+/* Inverting the original Mapping should produce an inverted simplified
+   Mapping, and re-inverting it should restore the original result. */
+   astInvert( map );
+   simp3 = astSimplify( map );
+   astTran1( simp3, 2, xin, 1, xout );
+   if( astOK && ( fabs( xout[ 0 ] - 1.0/6.0 ) > 1.0E-15 ||
+                  fabs( xout[ 1 ] + 4.0/6.0 ) > 1.0E-15 ) ) {
+      astError( AST__INTER, "TestSimplifyCache: Inverted Mapping gives "
+                "%g %g (expected 1/6 -4/6).", xout[ 0 ], xout[ 1 ] );
+   }
+   astInvert( map );
+   simp3 = astSimplify( map );
+   astTran1( simp3, 2, xin, 1, xout );
+   if( astOK && ( xout[ 0 ] != 6.0 || xout[ 1 ] != -24.0 ) ) {
+      astError( AST__INTER, "TestSimplifyCache: Re-inverted Mapping gives "
+                "%g %g (expected 6 -24).", xout[ 0 ], xout[ 1 ] );
+   }
+
+   astEnd;
+}
+
+/* Check that astChebyApprox returns a Mapping that meets the requested
+   accuracy, and that it returns a copy of the supplied Mapping if the
+   approximation would be slower to evaluate. */
+static void TestChebyApprox( void ){
+   static double in[ 2*NPOINT ], out1[ 2*NPOINT ], out2[ 2*NPOINT ];
+   const char *fwd[ 2 ] = { "u=x+0.1*sin(x*0.3*y)*exp(0.01*x*y)",
+                            "v=y+0.05*exp(0.3*x)*cos(y)*sqrt(1+x*x)" };
+   const char *inv[ 2 ] = { "x=u", "y=v" };
+   double acc = 1.0E-8;
+   double fitacc;
+   double lbnd[ 2 ] = { 0.0, 0.0 };
+   double ubnd[ 2 ] = { 1.0, 1.0 };
+   int i;
+   AstMapping *approx;
+   AstMapping *map;
+
+   if( !astOK ) return;
+   astBegin;
+
+/* Positions spread over the box, including its edges. */
+   for( i = 0; i < NPOINT; i++ ) {
+      in[ i ] = (double) i/( NPOINT - 1 );
+      in[ NPOINT + i ] = 0.5 + 0.5*sin( 0.37*i );
+   }
+
+/* Whatever form the returned Mapping takes, it must reproduce the
+   supplied Mapping to the requested accuracy. */
+   map = (AstMapping *) astMathMap( 2, 2, 2, fwd, 2, inv, " " );
+   approx = astChebyApprox( map, lbnd, ubnd, acc, 16, 64, &fitacc );
+   if( astOK && ( !approx || fitacc == AST__BAD || fitacc > acc ) ) {
+      astError( AST__INTER, "TestChebyApprox: No approximation found "
+                "for the MathMap (fitacc %g).", fitacc );
+   }
+   astTran2( map, NPOINT, in, in + NPOINT, 1, out1, out1 + NPOINT );
+   astTran2( approx, NPOINT, in, in + NPOINT, 1, out2, out2 + NPOINT );
+   for( i = 0; i < 2*NPOINT && astOK; i++ ) {
+      if( out2[ i ] == AST__BAD || fabs( out1[ i ] - out2[ i ] ) > acc ) {
+         astError( AST__INTER, "TestChebyApprox: Approximation gives %.15g "
+                   "(expected %.15g).", out2[ i ], out1[ i ] );
+      }
+   }
+
+/* A ZoomMap is much cheaper to evaluate than any ChebyMap, so a copy of
+   it should be returned, with an exact accuracy. */
+   map = (AstMapping *) astZoomMap( 2, 3.0, " " );
+   approx = astChebyApprox( map, lbnd, ubnd, acc, 16, 64, &fitacc );
+   if( astOK && ( !approx || approx == map || !astIsAZoomMap( approx ) ||
+                  fitacc != 0.0 ) ) {
+      astError( AST__INTER, "TestChebyApprox: A copy of the ZoomMap was "
+                "not returned (fitacc %g).", fitacc );
+   }
+
+   astEnd;
+}
+
+/* Check the Jacobians returned by astJacobian against central finite
+   differences formed in this test, for Mappings that use each of the
+   analytical methods, and for Mappings that use the finite differences
+   implemented by the Mapping class. */
+static void TestJacobian( void ){
+   const char *fwd[ 2 ] = { "u=x+0.1*sin(x*y)", "v=y*exp(0.2*x)" };
+   const char *inv[ 2 ] = { "x=u", "y=v" };
+   double cheby[] = { 0.5, 1.0, 1.0, 0.0,
+                      0.2, 1.0, 2.0, 1.0,
+                      -0.3, 2.0, 0.0, 3.0,
+                      0.7, 2.0, 1.0, 1.0 };
+   double cbnd_l[ 2 ] = { -10.0, -10.0 };
+   double cbnd_u[ 2 ] = { 10.0, 10.0 };
+   double matrix[ 4 ] = { 0.8, 0.6, -0.6, 0.9 };
+   double poly[] = { 1.0, 1.0, 1.0, 0.0,
+                     0.01, 1.0, 2.0, 1.0,
+                     1.0, 2.0, 0.0, 1.0,
+                     -0.02, 2.0, 1.0, 2.0 };
+   double poly1[] = { 2.0, 1.0, 1.0,
+                      0.1, 1.0, 3.0 };
+   double shift[ 2 ] = { 1.5, -2.5 };
+   double ina[ 2 ] = { -1.0, -1.0 };
+   double inb[ 2 ] = { 1.0, 1.0 };
+   double outa[ 2 ] = { 0.0, 1.0 };
+   double outb[ 2 ] = { 2.0, 2.0 };
+   AstMapping *map;
+
+   if( !astOK ) return;
+   astBegin;
+
+/* Analytical Jacobians for a series chain of linear Mappings and a
+   PolyMap, in both directions (the inverse of the PolyMap is found by
+   iteration). */
+   map = (AstMapping *) astCmpMap( astWinMap( 2, ina, inb, outa, outb, " " ),
+                                   astPolyMap( 2, 2, 4, poly, 0, NULL,
+                                               "IterInverse=1" ), 1, " " );
+   map = (AstMapping *) astCmpMap( map, astMatrixMap( 2, 2, 0, matrix, " " ),
+                                   1, " " );
+   map = (AstMapping *) astCmpMap( map, astShiftMap( 2, shift, " " ), 1,
+                                   " " );
+   map = (AstMapping *) astCmpMap( map, astZoomMap( 2, 1.7, " " ), 1, " " );
+   CompareJacobian( map, 1, 1.0E-6, "Linear/PolyMap chain" );
+   CompareJacobian( map, 0, 1.0E-6, "Linear/PolyMap chain" );
+
+/* An inverted chain. */
+   astInvert( map );
+   CompareJacobian( map, 1, 1.0E-6, "Inverted chain" );
+
+/* A parallel CmpMap. */
+   map = (AstMapping *) astCmpMap( astPolyMap( 1, 1, 2, poly1, 0, NULL,
+                                               " " ),
+                                   astUnitMap( 1, " " ), 0, " " );
+   CompareJacobian( map, 1, 1.0E-6, "Parallel CmpMap" );
+
+/* A ChebyMap. */
+   map = (AstMapping *) astChebyMap( 2, 2, 4, cheby, 0, NULL, cbnd_l,
+                                     cbnd_u, NULL, NULL, " " );
+   CompareJacobian( map, 1, 1.0E-6, "ChebyMap" );
+
+/* A MathMap, which uses the finite differences implemented by the
+   Mapping class, both alone and within a CmpMap. */
+   map = (AstMapping *) astMathMap( 2, 2, 2, fwd, 2, inv, " " );
+   CompareJacobian( map, 1, 1.0E-4, "MathMap" );
+   map = (AstMapping *) astCmpMap( astZoomMap( 2, 0.5, " " ), map, 1, " " );
+   CompareJacobian( map, 1, 1.0E-4, "ZoomMap/MathMap chain" );
+
+   astEnd;
+}
+
+/* Compare the Jacobian returned by astJacobian with central finite
+   differences. The finite difference step is 1E-5 of each axis value
+   (or 1E-5 if the axis value is smaller than 1.0), so the truncation
+   error is much smaller than "tol" for these smooth Mappings. An
+   element of the Jacobian, "j", is accepted if it differs from the
+   finite difference estimate, "e", by no more than tol*(1+|e|). */
+static void CompareJacobian( AstMapping *map, int forward, double tol,
+                             const char *name ){
+#define NJAC 50
+   static double in[ 2*NJAC ], jac[ 4*NJAC ];
+   static double inm[ 2*NJAC ], inp[ 2*NJAC ];
+   static double outm[ 2*NJAC ], outp[ 2*NJAC ];
+   double est;
+   double step[ NJAC ];
+   int i;
+   int iin;
+   int iout;
+
+   if( !astOK ) return;
+
+/* Positions in the range -2 to 2 on each axis. Use the forward
+   transformation to get positions for testing the inverse, so that
+   they are within the range of the Mapping. */
+   for( i = 0; i < NJAC; i++ ) {
+      in[ i ] = -2.0 + 4.0*i/( NJAC - 1 );
+      in[ NJAC + i ] = 1.5*cos( 0.7*i );
+   }
+   if( !forward ) {
+      astTranN( map, NJAC, 2, NJAC, in, 1, 2, NJAC, outp );
+      memcpy( in, outp, sizeof( in ) );
+   }
+
+   astJacobian( map, NJAC, 2, NJAC, in, forward, NJAC, jac );
+
+   for( iin = 0; iin < 2 && astOK; iin++ ) {
+      memcpy( inm, in, sizeof( in ) );
+      memcpy( inp, in, sizeof( in ) );
+      for( i = 0; i < NJAC; i++ ) {
+         step[ i ] = 1.0E-5*( ( fabs( in[ iin*NJAC + i ] ) > 1.0 ) ?
+                              fabs( in[ iin*NJAC + i ] ) : 1.0 );
+         inm[ iin*NJAC + i ] -= step[ i ];
+         inp[ iin*NJAC + i ] += step[ i ];
+      }
+      astTranN( map, NJAC, 2, NJAC, inm, forward, 2, NJAC, outm );
+      astTranN( map, NJAC, 2, NJAC, inp, forward, 2, NJAC, outp );
+
+      for( iout = 0; iout < 2 && astOK; iout++ ) {
+         for( i = 0; i < NJAC && astOK; i++ ) {
+            est = ( outp[ iout*NJAC + i ] - outm[ iout*NJAC + i ] )/
+                  ( 2.0*step[ i ] );
+            if( jac[ ( iout*2 + iin )*NJAC + i ] == AST__BAD ||
+                fabs( jac[ ( iout*2 + iin )*NJAC + i ] - est ) >
+                tol*( 1.0 + fabs( est ) ) ) {
+               astError( AST__INTER, "TestJacobian: %s: d(out%d)/d(in%d) "
+                         "at point %d is %.10g (expected %.10g, forward "
+                         "%d).", name, iout + 1, iin + 1, i,
+                         jac[ ( iout*2 + iin )*NJAC + i ], est, forward );
+            }
+         }
+      }
+   }
+#undef NJAC
+}
+
+/* Check that astTranGridF returns the values returned by astTranGrid,
+   converted to single precision, with bad values replaced by the
+   supplied bad value. */
+static void TestTranGridF( void ){
+#define NGRID ( 121*91 )
+   static double dout[ 2*NGRID ];
+   static float fout[ 2*NGRID ];
+   const char *fwd[ 2 ] = { "u=sqrt(x)*10", "v=y+0.001*x*y" };
+   const char *inv[ 2 ] = { "x=(u/10)**2", "y=v/(1+0.001*x)" };
+   const float badval = -999.0F;
+   double cen[ 2 ] = { 20.0, 30.0 };
+   double shift[ 2 ] = { 0.25, -3.5 };
+   double tols[ 2 ] = { 0.0, 0.1 };
+   float expect;
+   int forward;
+   int i;
+   int imap;
+   int itol;
+   int lbnd[ 2 ] = { -20, -10 };
+   int nbad;
+   int ubnd[ 2 ] = { 100, 80 };
+   AstMapping *maps[ 3 ];
+
+   if( !astOK ) return;
+   astBegin;
+
+/* A linear Mapping, a non-linear Mapping, and a non-linear Mapping that
+   gives bad values for some of the grid. */
+   maps[ 0 ] = (AstMapping *) astCmpMap( astShiftMap( 2, shift, " " ),
+                                         astZoomMap( 2, 1.0E5, " " ), 1,
+                                         " " );
+   maps[ 1 ] = (AstMapping *) astPcdMap( 1.0E-5, cen, " " );
+   maps[ 2 ] = (AstMapping *) astMathMap( 2, 2, 2, fwd, 2, inv, " " );
+
+   for( imap = 0; imap < 3 && astOK; imap++ ) {
+      for( forward = 1; forward >= 0 && astOK; forward-- ) {
+         for( itol = 0; itol < 2 && astOK; itol++ ) {
+            astTranGrid( maps[ imap ], 2, lbnd, ubnd, tols[ itol ], 50,
+                         forward, 2, NGRID, dout );
+            astTranGridF( maps[ imap ], 2, lbnd, ubnd, tols[ itol ], 50,
+                          forward, 2, NGRID, fout, badval );
+            nbad = 0;
+            for( i = 0; i < 2*NGRID && astOK; i++ ) {
+               if( dout[ i ] == AST__BAD ) {
+                  expect = badval;
+                  nbad++;
+               } else {
+                  expect = (float) dout[ i ];
+               }
+               if( fout[ i ] != expect ) {
+                  astError( AST__INTER, "TestTranGridF: Mapping %d, "
+                            "forward %d, tol %g: element %d is %.9g "
+                            "(expected %.9g).", imap, forward,
+                            tols[ itol ], i, fout[ i ], expect );
+               }
+            }
+            if( astOK && ( imap == 2 && forward ) != ( nbad > 0 ) ) {
+               astError( AST__INTER, "TestTranGridF: Mapping %d, forward "
+                         "%d, tol %g: unexpected number of bad values "
+                         "(%d).", imap, forward, tols[ itol ], nbad );
+            }
+         }
+      }
+   }
+
+   astEnd;
+#undef NGRID
+}
+
+/* Check that methods which would modify a frozen Object report an error,
+   that the Objects within a frozen FrameSet are also frozen, and that
+   methods which only read a frozen Mapping (including those which
+   temporarily change the Invert attribute of its components) give the
+   same results as before it was frozen. */
+static void TestFreeze( void ){
+   double xin[ 3 ] = { -2.0, 1.0, 4.0 };
+   double yin[ 3 ] = { 0.5, -3.0, 7.0 };
+   double at[ 2 ] = { 1.0, 2.0 };
+   double lbnd[ 2 ] = { -1.0E10, 0.0 };
+   double ubnd[ 2 ] = { 0.0, 1.0E10 };
+   double shift[ 2 ] = { 5.0, -1.0 };
+   double xout1[ 3 ], xout2[ 3 ], yout1[ 3 ], yout2[ 3 ];
+   double rate1, rate2;
+   int i;
+   int ipass;
+   int out[ 1 ] = { 1 };
+   int splitout[ 2 ];
+   AstFrame *frame;
+   AstFrameSet *fs;
+   AstFrameSet *fscopy;
+   AstMapping *cmp;
+   AstMapping *cmpcopy;
+   AstMapping *map;
+   AstMapping *routes[ 2 ];
+   AstMapping *simp;
+   AstMapping *split;
+   AstMapping *swmap;
+   AstMapping *swcopy;
+   AstRegion *regs[ 2 ];
+
+   if( !astOK ) return;
+   astBegin;
+
+/* An inverted series CmpMap containing an inverted ZoomMap. Reading it
+   requires the Invert attribute of the components to be changed. */
+   map = (AstMapping *) astZoomMap( 2, 4.0, " " );
+   astInvert( map );
+   cmp = (AstMapping *) astCmpMap( map, astShiftMap( 2, shift, " " ), 1,
+                                   " " );
+   astInvert( cmp );
+
+/* A SwitchMap with two inverted routes, selected by the sign of the
+   input value. */
+   frame = astFrame( 1, " " );
+   regs[ 0 ] = (AstRegion *) astInterval( frame, lbnd, ubnd, NULL, " " );
+   regs[ 1 ] = (AstRegion *) astInterval( frame, lbnd + 1, ubnd + 1, NULL,
+                                          " " );
+   routes[ 0 ] = (AstMapping *) astZoomMap( 1, 2.0, "Invert=1" );
+   routes[ 1 ] = (AstMapping *) astShiftMap( 1, shift, "Invert=1" );
+   swmap = (AstMapping *) astSwitchMap( astSelectorMap( 2, (void **) regs,
+                                                        AST__BAD, " " ),
+                                        NULL, 2, (void **) routes, " " );
+
+/* A FrameSet holding the CmpMap. */
+   fs = astFrameSet( astFrame( 2, "Domain=A" ), " " );
+   astAddFrame( fs, AST__BASE, cmp, astFrame( 2, "Domain=B" ) );
+
+/* Unfrozen copies used to give the expected results. */
+   cmpcopy = astCopy( cmp );
+   swcopy = astCopy( swmap );
+   fscopy = astCopy( fs );
+
+   astFreeze( cmp );
+   astFreeze( swmap );
+   astFreeze( fs );
+
+/* Methods that modify a frozen Object should report an error and leave
+   it unchanged. */
+   astSetPutErr( NullPutErr );
+   astInvert( cmp );
+   CheckImmut( "astInvert" );
+   astInvert( fs );
+   CheckImmut( "astInvert on a FrameSet" );
+   astAddFrame( fs, AST__BASE, astUnitMap( 2, " " ), astFrame( 2, " " ) );
+   CheckImmut( "astAddFrame" );
+   astRemapFrame( fs, AST__CURRENT, astUnitMap( 2, " " ) );
+   CheckImmut( "astRemapFrame" );
+   astRemoveFrame( fs, AST__BASE );
+   CheckImmut( "astRemoveFrame" );
+   astSet( fs, "Invert=1" );
+   CheckImmut( "astSet" );
+
+/* The Objects within the FrameSet should also have been frozen. */
+   frame = astGetFrame( fs, AST__CURRENT );
+   astSet( frame, "Domain=C" );
+   CheckImmut( "astSet on a Frame within a FrameSet" );
+   astPermAxes( frame, out );
+   CheckImmut( "astPermAxes on a Frame within a FrameSet" );
+   astSetPutErr( NULL );
+
+   if( astOK && ( astGetI( fs, "Nframe" ) != 2 ||
+                  astGetI( fs, "Invert" ) || astGetI( cmp, "Invert" ) != 1 ||
+                  strcmp( astGetC( frame, "Domain" ), "B" ) ) ) {
+      astError( AST__INTER, "TestFreeze: A frozen Object was changed." );
+   }
+
+/* Transform points using the frozen Mappings, and compare with the
+   unfrozen copies. */
+   for( ipass = 0; ipass < 3 && astOK; ipass++ ) {
+      map = ( ipass == 0 ) ? cmp : ( ipass == 1 ) ? (AstMapping *) fs : swmap;
+      for( i = 0; i < 2 && astOK; i++ ) {
+         if( ipass < 2 ) {
+            astTran2( map, 3, xin, yin, !i, xout1, yout1 );
+            astTran2( ( ipass == 0 ) ? cmpcopy : (AstMapping *) fscopy, 3,
+                      xin, yin, !i, xout2, yout2 );
+         } else if( !i ) {
+            astTran1( swmap, 3, xin, 1, xout1 );
+            astTran1( swcopy, 3, xin, 1, xout2 );
+            memcpy( yout1, yout2, sizeof( yout2 ) );
+         } else {
+            break;
+         }
+         if( astOK && ( memcmp( xout1, xout2, sizeof( xout1 ) ) ||
+                        memcmp( yout1, yout2, sizeof( yout1 ) ) ) ) {
+            astError( AST__INTER, "TestFreeze: Frozen Mapping %d gives "
+                      "different results (forward %d).", ipass, !i );
+         }
+      }
+   }
+
+/* Rate, MapSplit, Equal and GetMapping. */
+   rate1 = astRate( cmp, at, 1, 1 );
+   rate2 = astRate( cmpcopy, at, 1, 1 );
+   if( astOK && rate1 != rate2 ) {
+      astError( AST__INTER, "TestFreeze: Frozen Mapping gives rate %g "
+                "(expected %g).", rate1, rate2 );
+   }
+   rate1 = astRate( swmap, xin, 1, 1 );
+   rate2 = astRate( swcopy, xin, 1, 1 );
+   if( astOK && rate1 != rate2 ) {
+      astError( AST__INTER, "TestFreeze: Frozen SwitchMap gives rate %g "
+                "(expected %g).", rate1, rate2 );
+   }
+   astMapSplit( cmp, 1, out, splitout, &split );
+   if( astOK && ( !split || splitout[ 0 ] != 1 ||
+                  astGetI( split, "Nout" ) != 1 ) ) {
+      astError( AST__INTER, "TestFreeze: Failed to split a frozen "
+                "Mapping." );
+   }
+   if( astOK && ( !astEqual( cmp, cmpcopy ) || !astEqual( cmpcopy, cmp ) ||
+                  !astEqual( fs, fscopy ) || !astEqual( swmap, swcopy ) ) ) {
+      astError( AST__INTER, "TestFreeze: A frozen Mapping is not equal to "
+                "its copy." );
+   }
+   map = astGetMapping( fs, AST__CURRENT, AST__BASE );
+   if( astOK && !astEqual( map, astGetMapping( fscopy, AST__CURRENT,
+                                                 AST__BASE ) ) ) {
+      astError( AST__INTER, "TestFreeze: astGetMapping gives the wrong "
+                "Mapping for a frozen FrameSet." );
+   }
+
+/* The simplified Mapping should not be frozen and may be modified
+   without affecting later results. A frozen Mapping may also be used
+   as a component of a new Mapping, which can then be simplified. */
+   astTran2( cmpcopy, 3, xin, yin, 1, xout2, yout2 );
+   for( ipass = 0; ipass < 2 && astOK; ipass++ ) {
+      simp = astSimplify( cmp );
+      astTran2( simp, 3, xin, yin, 1, xout1, yout1 );
+      if( astOK && ( astGetI( simp, "Frozen" ) || simp == cmp ) ) {
+         astError( AST__INTER, "TestFreeze: The simplified Mapping is "
+                   "frozen (pass %d).", ipass );
+      }
+      for( i = 0; i < 3 && astOK; i++ ) {
+         if( fabs( xout1[ i ] - xout2[ i ] ) > 1.0E-12 ||
+             fabs( yout1[ i ] - yout2[ i ] ) > 1.0E-12 ) {
+            astError( AST__INTER, "TestFreeze: The simplified Mapping "
+                      "gives wrong results (pass %d).", ipass );
+         }
+      }
+      astInvert( simp );
+   }
+   map = (AstMapping *) astCmpMap( cmp, cmp, 1, " " );
+   astInvert( map );
+   simp = astSimplify( map );
+   astTran2( simp, 3, xin, yin, 1, xout1, yout1 );
+   astTran2( cmpcopy, 3, xin, yin, 0, xout2, yout2 );
+   astTran2( cmpcopy, 3, xout2, yout2, 0, xout2, yout2 );
+   for( i = 0; i < 3 && astOK; i++ ) {
+      if( fabs( xout1[ i ] - xout2[ i ] ) > 1.0E-12 ||
+          fabs( yout1[ i ] - yout2[ i ] ) > 1.0E-12 ) {
+         astError( AST__INTER, "TestFreeze: Simplified CmpMap containing "
+                   "a frozen Mapping gives wrong results." );
+      }
+   }
+   if( astOK && ( astGetI( cmp, "Invert" ) != 1 ||
+                  !astEqual( cmp, cmpcopy ) ) ) {
+      astError( AST__INTER, "TestFreeze: A frozen Mapping was changed by "
+                "simplifying a Mapping that contains it." );
+   }
+
+   astEnd;
+
+/* Frozen Objects are not annulled by astEnd. */
+   cmp = astAnnul( cmp );
+   swmap = astAnnul( swmap );
+   fs = astAnnul( fs );
+}
+
+/* Check that astFormatArray and astUnformatArray give the same results
+   as calling astFormat and astUnformat for each value, for each axis of
+   a range of Frame classes that format and read values differently. */
+static void TestFormatArray( void ){
+#define NVAL 8
+   double value[ NVAL ] = { 0.0, 1.0, -0.5, 3.14159265358979, 6.2831853,
+                            1.5707963, 1.0E10/3.0, AST__BAD };
+   double mjd[ NVAL ] = { 55000.123456, 0.0, 60000.99999999, -1.5, 51544.5,
+                          59000.0, 1.0/3.0, AST__BAD };
+   double lbnd[ 2 ] = { 0.1, -0.2 };
+   double ubnd[ 2 ] = { 0.3, 0.4 };
+   AstFrame *frm;
+   AstFrameSet *fs;
+   AstRegion *box;
+   AstSkyFrame *sky;
+   AstSpecFrame *spec;
+   AstTimeFrame *time;
+   int axis;
+
+   if( !astOK ) return;
+   astBegin;
+
+   frm = astFrame( 2, " " );
+   astSetC( frm, "Format(1)", "%8.3f" );
+   for( axis = 1; axis <= 2; axis++ ) {
+      CompareFormatArray( frm, axis, NVAL, value, "Frame" );
+   }
+
+   sky = astSkyFrame( "Format(1)=hms.2,Format(2)=dms.1" );
+   for( axis = 1; axis <= 2; axis++ ) {
+      CompareFormatArray( (AstFrame *) sky, axis, NVAL, value, "SkyFrame" );
+   }
+
+   time = astTimeFrame( "Format=iso.2" );
+   CompareFormatArray( (AstFrame *) time, 1, NVAL, mjd, "TimeFrame" );
+
+   spec = astSpecFrame( " " );
+   frm = (AstFrame *) astCmpFrame( sky, spec, " " );
+   for( axis = 1; axis <= 3; axis++ ) {
+      CompareFormatArray( frm, axis, NVAL, value, "CmpFrame" );
+   }
+
+   fs = astFrameSet( astFrame( 2, "Domain=PIX" ), " " );
+   astAddFrame( fs, AST__BASE, astUnitMap( 2, " " ),
+                astSkyFrame( "Format(2)=dms.3" ) );
+   for( axis = 1; axis <= 2; axis++ ) {
+      CompareFormatArray( (AstFrame *) fs, axis, NVAL, value, "FrameSet" );
+   }
+
+   box = (AstRegion *) astBox( sky, 1, lbnd, ubnd, NULL, " " );
+   for( axis = 1; axis <= 2; axis++ ) {
+      CompareFormatArray( (AstFrame *) box, axis, NVAL, value, "Box" );
+   }
+
+   astEnd;
+#undef NVAL
+}
+
+/* Compare the results of astFormatArray and astUnformatArray for one
+   axis of a Frame with those of astFormat and astUnformat. The strings
+   read include the formatted values, some strings that can be read
+   only in part, and the values formatted with truncation. */
+static void CompareFormatArray( AstFrame *frm, int axis, int npoint,
+                                const double *value, const char *name ){
+#define LEN 50
+#define SHORT 6
+#define NEXTRA 6
+   static const char *extra[ NEXTRA ] = { "", "  10:20:30.5  ", "junk",
+                                          "12:30:00x", "1.5e3", "-45d30m" };
+   char buf[ 2*LEN*( 10 + NEXTRA ) ];
+   char sbuf[ SHORT*10 ];
+   const char *strings[ 2*( 10 + NEXTRA ) ];
+   const char *text;
+   double expect;
+   double got[ 2*( 10 + NEXTRA ) ];
+   double one;
+   int i;
+   int nc;
+   int nok;
+   int nread;
+   int nstr;
+
+   if( !astOK ) return;
+
+/* Format the values in one call, once with room for the whole string
+   and once with truncation, and compare with astFormat. */
+   astFormatArray( frm, axis, npoint, value, LEN, buf );
+   astFormatArray( frm, axis, npoint, value, SHORT, sbuf );
+   for( i = 0; i < npoint && astOK; i++ ) {
+      text = astFormat( frm, axis, value[ i ] );
+      if( astOK && strcmp( buf + i*LEN, text ) ) {
+         astError( AST__INTER, "TestFormatArray: %s axis %d value %d: "
+                   "astFormatArray gave '%s' (expected '%s').", name, axis,
+                   i, buf + i*LEN, text );
+      } else if( astOK && strncmp( sbuf + i*SHORT, text, SHORT - 1 ) ) {
+         astError( AST__INTER, "TestFormatArray: %s axis %d value %d: "
+                   "truncated astFormatArray gave '%s' (expected '%.*s').",
+                   name, axis, i, sbuf + i*SHORT, SHORT - 1, text );
+      }
+      strings[ i ] = buf + i*LEN;
+   }
+
+/* Add the extra strings, and the truncated strings. */
+   nstr = npoint;
+   for( i = 0; i < NEXTRA; i++ ) strings[ nstr++ ] = extra[ i ];
+   for( i = 0; i < npoint; i++ ) strings[ nstr++ ] = sbuf + i*SHORT;
+
+/* Read all the strings in one call and compare with astUnformat. A
+   string is only read successfully if astUnformat uses all of it. */
+   nread = astUnformatArray( frm, axis, nstr, strings, got );
+   nok = 0;
+   for( i = 0; i < nstr && astOK; i++ ) {
+      nc = astUnformat( frm, axis, strings[ i ], &one );
+      if( nc > 0 && nc == (int) strlen( strings[ i ] ) ) {
+         expect = one;
+         nok++;
+      } else {
+         expect = AST__BAD;
+      }
+      if( astOK && got[ i ] != expect ) {
+         astError( AST__INTER, "TestFormatArray: %s axis %d: "
+                   "astUnformatArray read '%s' as %.17g (expected %.17g).",
+                   name, axis, strings[ i ], got[ i ], expect );
+      }
+   }
+   if( astOK && nread != nok ) {
+      astError( AST__INTER, "TestFormatArray: %s axis %d: astUnformatArray "
+                "read %d strings (expected %d).", name, axis, nread, nok );
+   }
+
+#undef LEN
+#undef SHORT
+#undef NEXTRA
+}
+
+/* Check that PolyMaps and ChebyMaps with one or two inputs, which are
+   evaluated by nested multiplication (Horner's scheme or Clenshaw's
+   recurrence), agree with the general term-by-term evaluation. The
+   general scheme is used for polynomials with more than two inputs, so
+   each polynomial is compared with an equivalent polynomial that has
+   extra inputs, which have zero power in every term and are given the
+   value zero. The coefficients are less than one and there are fewer
+   than 30 of them, so the results should agree to within 1.0E-12. Also
+   check that a copy of each Mapping, and a copy read back from a
+   Channel, give exactly the same results. */
+static void TestNestedPoly( void ){
+#define MAXDEG 6
+#define NCOF ( ( MAXDEG + 1 )*( MAXDEG + 2 )/2 )
+   static double in[ 3*NPOINT ], out1[ 2*NPOINT ], out2[ 2*NPOINT ];
+   double cof[ 2*NCOF*4 ];
+   double cof3[ 2*NCOF*5 ];
+   double lbnd[ 3 ] = { -2.0, -1.5, -1.0 };
+   double ubnd[ 3 ] = { 1.0, 2.0, 1.0 };
+   double lbnd3[ 3 ];
+   double ubnd3[ 3 ];
+   char *text;
+   double *pc;
+   double *pc3;
+   double u;
+   int cheby;
+   int i;
+   int icopy;
+   int imap;
+   int iout;
+   int j;
+   int k;
+   int nbad;
+   int ncof;
+   int nin;
+   AstMapping *map;
+   AstMapping *map3;
+   AstObject *obj;
+
+   if( !astOK ) return;
+   astBegin;
+
+/* Test a 2-input PolyMap, a 2-input ChebyMap, a 1-input PolyMap and a
+   1-input ChebyMap, in that order. */
+   for( imap = 0; imap < 4 && astOK; imap++ ) {
+      nin = ( imap < 2 ) ? 2 : 1;
+      cheby = imap % 2;
+
+/* Store the coefficients for a polynomial of degree MAXDEG, and the
+   same coefficients for the equivalent 3-input polynomial. */
+      pc = cof;
+      pc3 = cof3;
+      ncof = 0;
+      for( iout = 0; iout < nin; iout++ ) {
+         for( i = 0; i <= MAXDEG; i++ ) {
+            for( j = 0; j <= ( nin == 2 ? MAXDEG - i : 0 ); j++ ) {
+               u = 0.9*sin( 1.0 + 7*ncof );
+               *(pc++) = u;
+               *(pc++) = iout + 1;
+               *(pc++) = i;
+               if( nin == 2 ) *(pc++) = j;
+               *(pc3++) = u;
+               *(pc3++) = iout + 1;
+               *(pc3++) = i;
+               *(pc3++) = j;
+               *(pc3++) = 0;
+               ncof++;
+            }
+         }
+      }
+
+/* The bounding box of the 3-input ChebyMap includes zero on the extra
+   axes. */
+      for( k = 0; k < 3; k++ ) {
+         lbnd3[ k ] = ( k < nin ) ? lbnd[ k ] : -1.0;
+         ubnd3[ k ] = ( k < nin ) ? ubnd[ k ] : 1.0;
+      }
+
+      if( cheby ) {
+         map = (AstMapping *) astChebyMap( nin, nin, ncof, cof, 0, NULL,
+                                           lbnd, ubnd, NULL, NULL, " " );
+         map3 = (AstMapping *) astChebyMap( 3, nin, ncof, cof3, 0, NULL,
+                                            lbnd3, ubnd3, NULL, NULL, " " );
+      } else {
+         map = (AstMapping *) astPolyMap( nin, nin, ncof, cof, 0, NULL,
+                                          " " );
+         map3 = (AstMapping *) astPolyMap( 3, nin, ncof, cof3, 0, NULL,
+                                           " " );
+      }
+
+/* The input values are in the range [-1,+1] for PolyMaps. For ChebyMaps,
+   they cover the bounding box and extend a little beyond its upper
+   bound, so that some outputs are bad. Some input values are bad. */
+      for( i = 0; i < NPOINT; i++ ) {
+         for( k = 0; k < 3; k++ ) {
+            if( k >= nin ) {
+               u = 0.0;
+            } else {
+               u = ( k == 0 ) ? cos( 0.37*i ) : sin( 0.011*i );
+               if( cheby ) {
+                  u = lbnd[ k ] + ( ubnd[ k ] - lbnd[ k ] )*( u + 1.05 )/2.0;
+               }
+            }
+            in[ k*NPOINT + i ] = u;
+         }
+      }
+      in[ 5 ] = AST__BAD;
+      if( nin == 2 ) in[ NPOINT + 77 ] = AST__BAD;
+
+      astTranN( map, NPOINT, nin, NPOINT, in, 1, nin, NPOINT, out1 );
+      astTranN( map3, NPOINT, 3, NPOINT, in, 1, nin, NPOINT, out2 );
+
+      nbad = 0;
+      for( i = 0; i < nin*NPOINT && astOK; i++ ) {
+         if( out1[ i ] == AST__BAD || out2[ i ] == AST__BAD ) {
+            if( out1[ i ] != out2[ i ] ) {
+               astError( AST__INTER, "TestNestedPoly: Mapping %d element %d: "
+                         "bad value mismatch (%g and %g).", imap, i,
+                         out1[ i ], out2[ i ] );
+            }
+            nbad++;
+         } else if( fabs( out1[ i ] - out2[ i ] ) > 1.0E-12 ) {
+            astError( AST__INTER, "TestNestedPoly: Mapping %d element %d: "
+                      "%.17g (expected %.17g).", imap, i, out1[ i ],
+                      out2[ i ] );
+         }
+      }
+      if( astOK && ( nbad < nin || nbad > nin*NPOINT/2 ) ) {
+         astError( AST__INTER, "TestNestedPoly: Mapping %d: unexpected "
+                   "number of bad values (%d).", imap, nbad );
+      }
+
+/* Check a copy, and a copy read back from a Channel. */
+      for( icopy = 0; icopy < 2 && astOK; icopy++ ) {
+         if( icopy == 0 ) {
+            obj = astCopy( map );
+         } else {
+            text = astToString( map );
+            obj = astFromString( text );
+            text = astFree( text );
+         }
+         astTranN( (AstMapping *) obj, NPOINT, nin, NPOINT, in, 1, nin,
+                   NPOINT, out2 );
+         if( astOK && memcmp( out1, out2, nin*NPOINT*sizeof( double ) ) ) {
+            astError( AST__INTER, "TestNestedPoly: Mapping %d copy %d: "
+                      "transformed positions differ.", imap, icopy );
+         }
+         obj = astAnnul( obj );
+      }
+   }
+
+   astEnd;
+#undef MAXDEG
+#undef NCOF
+}
+
+/* Check the iterative inverse transformation of PolyMaps with 2, 3 and 4
+   inputs, which use different methods to solve for each Newton-Raphson
+   step. The inverse must return the original input positions to within
+   1.0E-8 (the PolyMaps are close to linear and the target relative
+   error is 1.0E-10), give bad values for bad positions, and give
+   identical results for different values of NThread (the points are
+   divided into several blocks, which are inverted concurrently if
+   NThread is larger than one). */
+static void TestIterInverse( void ){
+   static double in[ 4*NPOINT ], out[ 4*NPOINT ], inv1[ 4*NPOINT ],
+                 inv2[ 4*NPOINT ];
+   double cof2[] = { 1.0, 1, 1, 0,  0.05, 1, 2, 0,  -0.02, 1, 1, 1,
+                     0.01, 1, 0, 3,  1.0, 2, 0, 1,  0.03, 2, 1, 1,
+                     0.02, 2, 3, 0 };
+   double cof3[] = { 1.0, 1, 1, 0, 0,  0.02, 1, 0, 1, 1,  1.0, 2, 0, 1, 0,
+                     0.01, 2, 2, 0, 0,  1.0, 3, 0, 0, 1,  0.03, 3, 1, 1, 0 };
+   double cof4[] = { 1.0, 1, 1, 0, 0, 0,  0.02, 1, 0, 1, 0, 1,
+                     1.0, 2, 0, 1, 0, 0,  0.01, 2, 2, 0, 0, 0,
+                     1.0, 3, 0, 0, 1, 0,  0.03, 3, 1, 1, 0, 0,
+                     1.0, 4, 0, 0, 0, 1,  -0.02, 4, 0, 0, 1, 1,
+                     0.5, 4, 1, 0, 0, 0 };
+   int ncofs[ 3 ] = { 7, 6, 9 };
+   double *cofs[ 3 ];
+   int i;
+   int imap;
+   int k;
+   int ncoord;
+   int nthread;
+   int oldn;
+   AstMapping *map;
+
+   if( !astOK ) return;
+   oldn = astTune( "NThread", AST__TUNULL );
+   astBegin;
+
+   cofs[ 0 ] = cof2;
+   cofs[ 1 ] = cof3;
+   cofs[ 2 ] = cof4;
+
+   for( imap = 0; imap < 3 && astOK; imap++ ) {
+      ncoord = imap + 2;
+      map = (AstMapping *) astPolyMap( ncoord, ncoord, ncofs[ imap ],
+                                       cofs[ imap ], 0, NULL,
+                                       "IterInverse=1,TolInverse=1.0E-10,"
+                                       "NiterInverse=20" );
+
+/* Transform a set of input positions with the forward transformation,
+   and make one output position bad. */
+      for( i = 0; i < NPOINT; i++ ) {
+         for( k = 0; k < ncoord; k++ ) {
+            in[ k*NPOINT + i ] = 2.0*sin( 0.001*i*( k + 1 ) + k );
+         }
+      }
+      astTranN( map, NPOINT, ncoord, NPOINT, in, 1, ncoord, NPOINT, out );
+      out[ NPOINT + 4321 ] = AST__BAD;
+
+/* Invert the output positions using one thread, and check the results. */
+      astTune( "NThread", 1 );
+      astTranN( map, NPOINT, ncoord, NPOINT, out, 0, ncoord, NPOINT, inv1 );
+      for( i = 0; i < NPOINT && astOK; i++ ) {
+         for( k = 0; k < ncoord && astOK; k++ ) {
+            if( i == 4321 ) {
+               if( inv1[ k*NPOINT + i ] != AST__BAD ) {
+                  astError( AST__INTER, "TestIterInverse: %d inputs: "
+                            "inverse of a bad position is not bad.",
+                            ncoord );
+               }
+            } else if( inv1[ k*NPOINT + i ] == AST__BAD ||
+                       fabs( inv1[ k*NPOINT + i ] - in[ k*NPOINT + i ] )
+                       > 1.0E-8 ) {
+               astError( AST__INTER, "TestIterInverse: %d inputs: point "
+                         "%d axis %d: inverse is %.17g (expected %.17g).",
+                         ncoord, i, k, inv1[ k*NPOINT + i ],
+                         in[ k*NPOINT + i ] );
+            }
+         }
+      }
+
+/* Check that several threads give identical results. */
+      for( nthread = 2; nthread <= 4 && astOK; nthread += 2 ) {
+         astTune( "NThread", nthread );
+         astTranN( map, NPOINT, ncoord, NPOINT, out, 0, ncoord, NPOINT,
+                   inv2 );
+         if( astOK && memcmp( inv1, inv2, ncoord*NPOINT*sizeof( double ) ) ) {
+            astError( AST__INTER, "TestIterInverse: %d inputs, NThread %d: "
+                      "inverted positions differ.", ncoord, nthread );
+         }
+      }
+   }
+
+   astEnd;
+   astTune( "NThread", oldn );
+}
+
+/* Report an error unless the previous call reported an AST__IMMUT error,
+   in which case clear it. Error messages are suppressed by NullPutErr
+   while this test is running. */
+static void CheckImmut( const char *what ){
+   int status_value;
+   status_value = astStatus;
+   if( status_value != AST__IMMUT ) {
+      astSetPutErr( NULL );
+      astClearStatus;
+      astError( AST__INTER, "TestFreeze: %s did not report an AST__IMMUT "
+                "error for a frozen Object (status %d).", what,
+                status_value );
+   } else {
+      astClearStatus;
+   }
+}
+
+static void NullPutErr( int status_value, const char *message ){
+}
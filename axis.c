@@ -197,6 +197,7 @@ AstAxis *astAxisId_( const char *, ... );
 /* ======================================== */
 static const char *AxisAbbrev( AstAxis *, const char *, const char *, const char *, int * );
 static const char *AxisFormat( AstAxis *, double, int * );
+static const char *FormatParsed( AstAxis *, const char *, int, int, int, int, double, int * );
 static int GetObjSize( AstObject *, int * );
 static const char *GetAttrib( AstObject *, const char *, int * );
 static const char *GetAxisFormat( AstAxis *, int * );
@@ -214,6 +215,7 @@ static double AxisOffset( AstAxis *, double, double, int * );
 static int AxisFields( AstAxis *, const char *, const char *, int, char **, int *, double *, int * );
 static int AxisIn( AstAxis *, double, double, double, int, int * );
 static int AxisUnformat( AstAxis *, const char *, double *, int * );
+static int AxisUnformatArray( AstAxis *, int, const char *const [], double *, int * );
 static int GetAxisDigits( AstAxis *, int * );
 static int GetAxisDirection( AstAxis *, int * );
 static int TestAttrib( AstObject *, const char *, int * );
@@ -227,6 +229,7 @@ static int TestAxisInternalUnit( AstAxis *, int * );
 static int TestAxisNormUnit( AstAxis *, int * );
 static void AxisNorm( AstAxis *, double *, int * );
 static void AxisNormValues( AstAxis *, int, int, double *, int * );
+static void AxisFormatArray( AstAxis *, int, const double *, int, char *, int * );
 static void AxisOverlay( AstAxis *, AstAxis *, int * );
 static void ClearAttrib( AstObject *, const char *, int * );
 static void ClearAxisDigits( AstAxis *, int * );
@@ -669,37 +672,20 @@ static const char *AxisFormat( AstAxis *this, double value, int *status ) {
 *-
 */
 
-/* Local Constants: */
-#define ERRBUF_LEN 80
-
 /* Local Variables: */
-   astDECLARE_GLOBALS           /* Pointer to thread-specific global data */
-   char *errstat;               /* Pointer for system error message */
-   char errbuf[ ERRBUF_LEN ];   /* Buffer for system error message */
-   char log_esc[ 50 ];          /* Buffer for graphical delimiter string */
    const char *fmt0;            /* Pointer to original Format string */
    const char *fmt;             /* Pointer to parsed Format string */
-   const char *log_del;         /* Pointer to delimiter string */
    const char *result;          /* Pointer to formatted value */
-   double x;                    /* The value to be formatted by sprintf */
    int integ;                   /* Cast axis value to integer before printing? */
    int log;                     /* Format as "10**x"? */
-   int nc;                      /* Total number of characters written */
-   int ncc;                     /* Number of characters written */
    int sign;                    /* Include leading sign in front of "10**x"? */
    int space;                   /* Include leading space in front of "10**x"? */
-   int stat;                    /* Value of errno after error */
 
 /* Check the global error status. */
    if ( !astOK ) return NULL;
 
-/* Get a pointer to the thread specific global data structure. */
-   astGET_GLOBALS(this);
-
 /* Initialise. */
    result = NULL;
-   nc = 0;
-   x = value;
 
 /* Check if a bad coordinate value was supplied and return a pointer to an
    appropriate string if necessary. */
@@ -732,112 +718,111 @@ static const char *AxisFormat( AstAxis *this, double value, int *status ) {
    replacing the "*" by the current vale of the Digits attribute. */
       fmt = ParseAxisFormat( fmt0, astGetAxisDigits( this ), &log, &sign,
                              &space, &integ, status );
-      if( astOK ) {
 
-/* Format zero normally. */
-         if( value == 0.0 ) log = 0;
+/* Format the value using the parsed Format string. */
+      result = FormatParsed( this, fmt, log, sign, space, integ, value,
+                             status );
 
-/* If log format is required, find the value of the exponent "x", and
-   initialise the returned string to hold the exponent and the graphical
-   escape sequence which produces a superscript. Otherwise just format the
-   supplied value. */
-         if( log ) {
+/* Free resources. */
+      fmt = astFree( (void *) fmt );
 
-            if( sign ) {
-               axisformat_buff[ 0 ] ='+';
-               nc = 1;
+   }
 
-            } else if( space ) {
-               axisformat_buff[ 0 ] =' ';
-               nc = 1;
-            }
+/* Return the result. */
+   return result;
 
-            if( value > 0 ) {
-               x = log10( integ ? (int) value : value );
+}
 
-            } else {
-               x = log10( integ ? (int) -value : -value );
-               axisformat_buff[ 0 ] ='-';
-               nc = 1;
-            }
+static void AxisFormatArray( AstAxis *this, int npoint, const double *value,
+                             int len, char *buf, int *status ) {
+/*
+*+
+*  Name:
+*     astAxisFormatArray
 
-            if(  astEscapes( -1 ) ) {
-               astTuneC( "exdel", NULL, log_esc, sizeof( log_esc ) );
-               log_del = log_esc;
-            } else {
-               log_del = log_txt;
-            }
+*  Purpose:
+*     Format an array of coordinate values for an Axis.
 
-            nc += sprintf( axisformat_buff + nc, "%s", log_del );
+*  Type:
+*     Protected virtual function.
 
-/* Round small exponents to zero. */
-            if( fabs( x ) < 1.0E-10 ) x = 0.0;
-         }
-      }
+*  Synopsis:
+*     #include "axis.h"
+*     void astAxisFormatArray( AstAxis *this, int npoint,
+*                              const double *value, int len, char *buf )
 
-/* Clear errno and attempt to format the value as if the Format string were
-   a standard "sprintf" format. */
-      if ( astOK ) {
-         errno = 0;
-         if( integ ) {
-            ncc = sprintf( axisformat_buff + nc, fmt, (int) x );
-         } else {
-            ncc = sprintf( axisformat_buff + nc, fmt, x );
-         }
-         nc += ncc;
+*  Class Membership:
+*     Axis method.
 
-/* If log format is being used, terminate the string with an escape
-   sequence which resets the graphical attributes to what they were at the
-   start of the string. */
-         if( log ) nc += sprintf( axisformat_buff + nc, "%%+" );
+*  Description:
+*     This function formats an array of coordinate values for an Axis,
+*     storing the resulting strings in a buffer supplied by the caller.
+*     Each string is identical to that which would be returned by
+*     astAxisFormat for the corresponding value, but the Format string
+*     is obtained and parsed only once, rather than once for each value.
 
-/* The possibilities for error detection are limited here, but check if an
-   error value was returned and report an error. Include information from
-   errno if it was set. */
-         if ( ncc < 0 ) {
-            stat = errno;
-            if( stat ) {
-#if HAVE_STRERROR_R
-               strerror_r( stat, errbuf, ERRBUF_LEN );
-               errstat = errbuf;
-#else
-               errstat = strerror( stat );
-#endif
-            } else {
-               *errbuf = 0;
-               errstat = errbuf;
-            }
-            astError( AST__FMTER, "astAxisFormat(%s): Error formatting a "
-                      "coordinate value of %1.*G%s%s.", status, astGetClass( this ),
-                      AST__DBL_DIG, value, stat? " - " : "", errstat );
-            astError( AST__FMTER, "The format string was \"%s\".", status, fmt );
+*  Parameters:
+*     this
+*        Pointer to the Axis.
+*     npoint
+*        The number of values to be formatted.
+*     value
+*        Pointer to an array of "npoint" coordinate values.
+*     len
+*        The number of characters reserved in "buf" for each formatted
+*        value, including the terminating null. Longer strings are
+*        truncated to "len-1" characters.
+*     buf
+*        Pointer to a buffer of at least "npoint*len" characters. The
+*        formatted version of "value[i]" is returned as a null-terminated
+*        string starting at "buf[i*len]".
 
-/* Also check that the result buffer did not overflow. If it did, memory will
-   probably have been corrupted but this cannot be prevented with "sprintf".
-   Report the error and abort. */
-         } else if ( nc > AST__AXIS_AXISFORMAT_BUFF_LEN ) {
-            astError( AST__FMTER, "astAxisFormat(%s): Internal buffer "
-                      "overflow while formatting a coordinate value of %1.*G "
-                      "- result exceeds %d characters.", status, astGetClass( this ),
-                      AST__DBL_DIG, value, AST__AXIS_AXISFORMAT_BUFF_LEN );
-            astError( AST__FMTER, "The format string was \"%s\".", status, fmt );
+*  Notes:
+*     - Classes which over-ride the astAxisFormat method should also
+*     over-ride this method.
+*-
+*/
 
-/* If succesfull, return a pointer to the buffer. */
-         } else {
-            result = axisformat_buff;
-         }
-      }
+/* Local Variables: */
+   const char *fmt0;            /* Pointer to original Format string */
+   const char *fmt;             /* Pointer to parsed Format string */
+   const char *text;            /* Pointer to formatted value */
+   int i;                       /* Index of current value */
+   int integ;                   /* Cast axis value to integer before printing? */
+   int log;                     /* Format as "10**x"? */
+   int nc;                      /* Number of characters to store */
+   int sign;                    /* Include leading sign in front of "10**x"? */
+   int space;                   /* Include leading space in front of "10**x"? */
 
-/* Free resources. */
-      fmt = astFree( (void *) fmt );
+/* Check the global error status. */
+   if ( !astOK ) return;
 
-   }
+/* Obtain and parse the Format string once, in the same way as the
+   AxisFormat function. */
+   fmt0 = GetAxisFormat( this, status );
+   fmt = ParseAxisFormat( fmt0, astGetAxisDigits( this ), &log, &sign,
+                          &space, &integ, status );
 
-/* Return the result. */
-   return result;
+/* Format each value, copying the result into the caller's buffer. */
+   for ( i = 0; i < npoint && astOK; i++ ) {
+      if ( value[ i ] == AST__BAD ) {
+         text = "<bad>";
+      } else {
+         text = FormatParsed( this, fmt, log, sign, space, integ, value[ i ],
+                              status );
+      }
+
+      if ( text ) {
+         nc = strlen( text );
+         if ( nc >= len ) nc = len - 1;
+         memcpy( buf + i*len, text, (size_t) nc );
+         buf[ i*len + nc ] = '\0';
+      }
+   }
 
+/* Free resources. */
+   fmt = astFree( (void *) fmt );
 }
-#undef ERRBUF_LEN
 
 static double AxisCentre( AstAxis *this, double value, double gap, int *status ) {
 /*
@@ -1371,6 +1356,91 @@ static int AxisUnformat( AstAxis *this, const char *string, double *value, int *
    return nc;
 }
 
+static int AxisUnformatArray( AstAxis *this, int npoint,
+                              const char *const strings[], double *value,
+                              int *status ) {
+/*
+*+
+*  Name:
+*     astAxisUnformatArray
+
+*  Purpose:
+*     Read an array of formatted coordinate values for an Axis.
+
+*  Type:
+*     Protected virtual function.
+
+*  Synopsis:
+*     #include "axis.h"
+*     int astAxisUnformatArray( AstAxis *this, int npoint,
+*                               const char *const strings[], double *value )
+
+*  Class Membership:
+*     Axis method.
+
+*  Description:
+*     This function reads an array of formatted coordinate values for
+*     an Axis (supplied as strings) and returns the equivalent numerical
+*     values. Each string is interpreted in the same way as by
+*     astAxisUnformat.
+
+*  Parameters:
+*     this
+*        Pointer to the Axis.
+*     npoint
+*        The number of strings to be read.
+*     strings
+*        An array of "npoint" pointers to null-terminated strings, each
+*        holding a formatted coordinate value.
+*     value
+*        Pointer to an array in which to return the "npoint" coordinate
+*        values read.
+
+*  Returned Value:
+*     The number of strings that were read successfully. A string is
+*     read successfully only if all its characters are used in forming
+*     the coordinate value (leading and trailing white space is
+*     ignored). AST__BAD is returned in "value" for any other string.
+
+*  Notes:
+*     - Classes which over-ride the astAxisUnformat method, and which
+*     can read values more efficiently in bulk, may over-ride this
+*     method.
+*     - A value of zero will be returned if this function is invoked
+*     with the global error status set, or if it should fail for any
+*     reason.
+*-
+*/
+
+/* Local Variables: */
+   int i;                        /* Index of current string */
+   int nc;                       /* Number of characters read */
+   int result;                   /* Number of strings read */
+
+/* Initialise. */
+   result = 0;
+
+/* Check the global error status. */
+   if ( !astOK ) return result;
+
+/* Read each string in turn, using the (possibly over-ridden) astAxisUnformat
+   method. Store a bad value if the whole string was not used. */
+   for ( i = 0; i < npoint && astOK; i++ ) {
+      nc = astAxisUnformat( this, strings[ i ], value + i );
+      if ( nc > 0 && nc == (int) strlen( strings[ i ] ) ) {
+         result++;
+      } else {
+         value[ i ] = AST__BAD;
+      }
+   }
+
+/* Return zero if an error occurred. */
+   if ( !astOK ) result = 0;
+
+/* Return the result. */
+   return result;
+}
+
 static void ClearAttrib( AstObject *this_object, const char *attrib, int *status ) {
 /*
 *  Name:
@@ -1473,6 +1543,185 @@ static void ClearAttrib( AstObject *this_object, const char *attrib, int *status
    }
 }
 
+static const char *FormatParsed( AstAxis *this, const char *fmt, int log,
+                                 int sign, int space, int integ,
+                                 double value, int *status ) {
+/*
+*  Name:
+*     FormatParsed
+
+*  Purpose:
+*     Format a good coordinate value using a parsed Axis Format string.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "axis.h"
+*     const char *FormatParsed( AstAxis *this, const char *fmt, int log,
+*                               int sign, int space, int integ,
+*                               double value, int *status )
+
+*  Class Membership:
+*     Axis member function
+
+*  Description:
+*     This function formats a coordinate value using a Format string
+*     and flags previously obtained from ParseAxisFormat. It allows the
+*     AxisFormat and AxisFormatArray functions to share the same code.
+
+*  Parameters:
+*     this
+*        Pointer to the Axis.
+*     fmt
+*        The printf format specifier returned by ParseAxisFormat.
+*     log
+*        The "log" flag returned by ParseAxisFormat.
+*     sign
+*        The "sign" flag returned by ParseAxisFormat.
+*     space
+*        The "lspace" flag returned by ParseAxisFormat.
+*     integ
+*        The "integ" flag returned by ParseAxisFormat.
+*     value
+*        The coordinate value to be formatted. Must not be AST__BAD.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     A pointer to a null-terminated string containing the formatted
+*     value. This is held in a static buffer which is over-written by
+*     each invocation.
+
+*  Notes:
+*     -  A NULL pointer will be returned if this function is invoked with the
+*     global error status set, or if it should fail for any reason.
+*/
+
+/* Local Constants: */
+#define ERRBUF_LEN 80
+
+/* Local Variables: */
+   astDECLARE_GLOBALS           /* Pointer to thread-specific global data */
+   char *errstat;               /* Pointer for system error message */
+   char errbuf[ ERRBUF_LEN ];   /* Buffer for system error message */
+   char log_esc[ 50 ];          /* Buffer for graphical delimiter string */
+   const char *log_del;         /* Pointer to delimiter string */
+   const char *result;          /* Pointer to formatted value */
+   double x;                    /* The value to be formatted by sprintf */
+   int nc;                      /* Total number of characters written */
+   int ncc;                     /* Number of characters written */
+   int stat;                    /* Value of errno after error */
+
+/* Check the global error status. */
+   if ( !astOK ) return NULL;
+
+/* Get a pointer to the thread specific global data structure. */
+   astGET_GLOBALS(this);
+
+/* Initialise. */
+   result = NULL;
+   nc = 0;
+   x = value;
+
+/* Format zero normally. */
+   if( value == 0.0 ) log = 0;
+
+/* If log format is required, find the value of the exponent "x", and
+   initialise the returned string to hold the exponent and the graphical
+   escape sequence which produces a superscript. Otherwise just format the
+   supplied value. */
+   if( log ) {
+
+      if( sign ) {
+         axisformat_buff[ 0 ] ='+';
+         nc = 1;
+
+      } else if( space ) {
+         axisformat_buff[ 0 ] =' ';
+         nc = 1;
+      }
+
+      if( value > 0 ) {
+         x = log10( integ ? (int) value : value );
+
+      } else {
+         x = log10( integ ? (int) -value : -value );
+         axisformat_buff[ 0 ] ='-';
+         nc = 1;
+      }
+
+      if(  astEscapes( -1 ) ) {
+         astTuneC( "exdel", NULL, log_esc, sizeof( log_esc ) );
+         log_del = log_esc;
+      } else {
+         log_del = log_txt;
+      }
+
+      nc += sprintf( axisformat_buff + nc, "%s", log_del );
+
+/* Round small exponents to zero. */
+      if( fabs( x ) < 1.0E-10 ) x = 0.0;
+   }
+
+/* Clear errno and attempt to format the value as if the Format string were
+   a standard "sprintf" format. */
+   if ( astOK ) {
+      errno = 0;
+      if( integ ) {
+         ncc = sprintf( axisformat_buff + nc, fmt, (int) x );
+      } else {
+         ncc = sprintf( axisformat_buff + nc, fmt, x );
+      }
+      nc += ncc;
+
+/* If log format is being used, terminate the string with an escape
+   sequence which resets the graphical attributes to what they were at the
+   start of the string. */
+      if( log ) nc += sprintf( axisformat_buff + nc, "%%+" );
+
+/* The possibilities for error detection are limited here, but check if an
+   error value was returned and report an error. Include information from
+   errno if it was set. */
+      if ( ncc < 0 ) {
+         stat = errno;
+         if( stat ) {
+#if HAVE_STRERROR_R
+            strerror_r( stat, errbuf, ERRBUF_LEN );
+            errstat = errbuf;
+#else
+            errstat = strerror( stat );
+#endif
+         } else {
+            *errbuf = 0;
+            errstat = errbuf;
+         }
+         astError( AST__FMTER, "astAxisFormat(%s): Error formatting a "
+                   "coordinate value of %1.*G%s%s.", status, astGetClass( this ),
+                   AST__DBL_DIG, value, stat? " - " : "", errstat );
+         astError( AST__FMTER, "The format string was \"%s\".", status, fmt );
+
+/* Also check that the result buffer did not overflow. If it did, memory will
+   probably have been corrupted but this cannot be prevented with "sprintf".
+   Report the error and abort. */
+      } else if ( nc > AST__AXIS_AXISFORMAT_BUFF_LEN ) {
+         astError( AST__FMTER, "astAxisFormat(%s): Internal buffer "
+                   "overflow while formatting a coordinate value of %1.*G "
+                   "- result exceeds %d characters.", status, astGetClass( this ),
+                   AST__DBL_DIG, value, AST__AXIS_AXISFORMAT_BUFF_LEN );
+         astError( AST__FMTER, "The format string was \"%s\".", status, fmt );
+
+/* If succesfull, return a pointer to the buffer. */
+      } else {
+         result = axisformat_buff;
+      }
+   }
+
+/* Return the result. */
+   return result;
+}
+#undef ERRBUF_LEN
+
 static const char *GetAxisInternalUnit( AstAxis *this, int *status ){
 /*
 *+
@@ -1935,6 +2184,7 @@ void astInitAxisVtab_(  AstAxisVtab *vtab, const char *name, int *status ) {
    vtab->AxisAbbrev = AxisAbbrev;
    vtab->AxisFields = AxisFields;
    vtab->AxisFormat = AxisFormat;
+   vtab->AxisFormatArray = AxisFormatArray;
    vtab->AxisDistance = AxisDistance;
    vtab->AxisOffset = AxisOffset;
    vtab->AxisCentre = AxisCentre;
@@ -1944,6 +2194,7 @@ void astInitAxisVtab_(  AstAxisVtab *vtab, const char *name, int *status ) {
    vtab->AxisNormValues = AxisNormValues;
    vtab->AxisOverlay = AxisOverlay;
    vtab->AxisUnformat = AxisUnformat;
+   vtab->AxisUnformatArray = AxisUnformatArray;
    vtab->ClearAxisDigits = ClearAxisDigits;
    vtab->ClearAxisDirection = ClearAxisDirection;
    vtab->ClearAxisFormat = ClearAxisFormat;
@@ -3462,6 +3713,16 @@ int astAxisUnformat_( AstAxis *this, const char *string, double *value, int *sta
    if ( !astOK ) return 0;
    return (**astMEMBER(this,Axis,AxisUnformat))( this, string, value, status );
 }
+int astAxisUnformatArray_( AstAxis *this, int npoint, const char *const strings[],
+                           double *value, int *status ) {
+   if ( !astOK ) return 0;
+   return (**astMEMBER(this,Axis,AxisUnformatArray))( this, npoint, strings, value, status );
+}
+void astAxisFormatArray_( AstAxis *this, int npoint, const double *value,
+                          int len, char *buf, int *status ) {
+   if ( !astOK ) return;
+   (**astMEMBER(this,Axis,AxisFormatArray))( this, npoint, value, len, buf, status );
+}
 int astAxisFields_( AstAxis *this, const char *fmt, const char *str,
                     int maxfld, char **fields, int *nc, double *val, int *status ) {
    if ( !astOK ) return 0;
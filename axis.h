@@ -103,6 +103,8 @@
 *           Find the distance between two axis values.
 *        astAxisFields
 *           Identify the fields within a formatted SkyAxis value.
+*        astAxisFormatArray
+*           Format an array of coordinate values for an Axis.
 *        astAxisCentre
 *           Find a "nice" central axis value.
 *        astAxisGap
@@ -111,6 +113,8 @@
 *           Add an increment onto a supplied axis value.
 *        astAxisOverlay
 *           Overlay the attributes of a template Axis on to another Axis.
+*        astAxisUnformatArray
+*           Read an array of formatted coordinate values for an Axis.
 *        astClearAxisDigits
 *           Clear the Digits attribute for an Axis.
 *        astClearAxisDirection
@@ -323,6 +327,8 @@ typedef struct AstAxisVtab {
    int (* AxisIn)( AstAxis *, double, double, double, int, int * );
    int (* AxisFields)( AstAxis *, const char *, const char *, int, char **, int *, double *, int * );
    int (* AxisUnformat)( AstAxis *, const char *, double *, int * );
+   int (* AxisUnformatArray)( AstAxis *, int, const char *const [], double *, int * );
+   void (* AxisFormatArray)( AstAxis *, int, const double *, int, char *, int * );
    int (* GetAxisDigits)( AstAxis *, int * );
    int (* GetAxisDirection)( AstAxis *, int * );
    int (* TestAxisDigits)( AstAxis *, int * );
@@ -438,6 +444,8 @@ int astTestAxisDigits_( AstAxis *, int * );
 int astTestAxisDirection_( AstAxis *, int * );
 int astAxisFields_( AstAxis *, const char *, const char *, int, char **, int *, double *, int * );
 int astAxisIn_( AstAxis *, double, double, double, int, int * );
+int astAxisUnformatArray_( AstAxis *, int, const char *const [], double *, int * );
+void astAxisFormatArray_( AstAxis *, int, const double *, int, char *, int * );
 int astTestAxisFormat_( AstAxis *, int * );
 int astTestAxisLabel_( AstAxis *, int * );
 int astTestAxisSymbol_( AstAxis *, int * );
@@ -535,6 +543,10 @@ astINVOKE(V,astAxisGap_(astCheckAxis(this),gap,ntick,STATUS_PTR))
 astINVOKE(V,astAxisFields_(astCheckAxis(this),fmt,str,maxfld,fields,nc,val,STATUS_PTR))
 #define astAxisIn(this,lo,hi,val,closed) \
 astINVOKE(V,astAxisIn_(astCheckAxis(this),lo,hi,val,closed,STATUS_PTR))
+#define astAxisFormatArray(this,npoint,value,len,buf) \
+astINVOKE(V,astAxisFormatArray_(astCheckAxis(this),npoint,value,len,buf,STATUS_PTR))
+#define astAxisUnformatArray(this,npoint,strings,value) \
+astINVOKE(V,astAxisUnformatArray_(astCheckAxis(this),npoint,strings,value,STATUS_PTR))
 #define astAxisDistance(this,v1,v2) \
 astINVOKE(V,astAxisDistance_(astCheckAxis(this),v1,v2,STATUS_PTR))
 #define astAxisOffset(this,v1,dist) \
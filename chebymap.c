@@ -183,6 +183,7 @@ static int class_check;
 static int (* parent_getobjsize)( AstObject *, int * );
 static int (* parent_equal)( AstObject *, AstObject *, int * );
 static void (* parent_polypowers)( AstPolyMap *, double **, int, const int *, double **, int, int, int * );
+static void (* parent_polypowerderivs)( AstPolyMap *, double **, double **, int, const int *, double **, int, int, int * );
 static AstPolyMap *(*parent_polytran)( AstPolyMap *, int, double, double, int, const double *, const double *, int * );
 
 
@@ -231,7 +232,9 @@ static void ChebyDomain( AstChebyMap *, int, double *, double *, int * );
 static void Copy( const AstObject *, AstObject *, int * );
 static void Delete( AstObject *obj, int * );
 static void Dump( AstObject *, AstChannel *, int * );
+static int PolyBasis( AstPolyMap *, int, const double **, const double **, int * );
 static void PolyPowers( AstPolyMap *, double **, int, const int *, double **, int, int, int *);
+static void PolyPowerDerivs( AstPolyMap *, double **, double **, int, const int *, double **, int, int, int * );
 static void FitPoly1DInit( AstPolyMap *, int, double **, AstMinPackData *, double *, int *);
 static void FitPoly2DInit( AstPolyMap *, int, double **, AstMinPackData *, double *, int *);
 
@@ -1030,6 +1033,11 @@ void astInitChebyMapVtab_(  AstChebyMapVtab *vtab, const char *name, int *status
    parent_polypowers = polymap->PolyPowers;
    polymap->PolyPowers = PolyPowers;
 
+   polymap->PolyBasis = PolyBasis;
+
+   parent_polypowerderivs = polymap->PolyPowerDerivs;
+   polymap->PolyPowerDerivs = PolyPowerDerivs;
+
    parent_polytran = polymap->PolyTran;
    polymap->PolyTran = PolyTran;
 
@@ -1059,6 +1067,74 @@ void astInitChebyMapVtab_(  AstChebyMapVtab *vtab, const char *name, int *status
    }
 }
 
+static int PolyBasis( AstPolyMap *this_polymap, int fwd, const double **scales,
+                      const double **offsets, int *status ){
+/*
+*  Name:
+*     PolyBasis
+
+*  Purpose:
+*     Identify the functions used as the basis of a polynomial.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "chebymap.h"
+*     int PolyBasis( AstPolyMap *this, int fwd, const double **scales,
+*                    const double **offsets, int *status )
+
+*  Class Membership:
+*     ChebyMap member function (over-rides the astPolyBasis protected
+*     method inherited from the PolyMap class).
+
+*  Description:
+*     This function indicates whether the specified transformation of a
+*     ChebyMap is defined by a Chebyshev polynomial or by a standard
+*     polynomial. It should be kept consistent with the PolyPowers
+*     function.
+
+*  Parameters:
+*     this
+*        Pointer to the PolyMap.
+*     fwd
+*        Do the coefficients define the foward transformation of the
+*        PolyMap?
+*     scales
+*        Address of a location at which to return a pointer to an array
+*        holding the scale factor for each input axis, or NULL if the
+*        transformation is a standard polynomial.
+*     offsets
+*        Address of a location at which to return a pointer to an array
+*        holding the offset for each input axis, or NULL if the
+*        transformation is a standard polynomial.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     Non-zero if the transformation is a Chebyshev polynomial.
+
+*/
+
+/* Local Variables; */
+   AstChebyMap *this;
+
+/* Initialise */
+   *scales = NULL;
+   *offsets = NULL;
+
+/* Check the local error status. */
+   if ( !astOK ) return 0;
+
+/* Get a pointer to the ChebyMap structure. */
+   this = (AstChebyMap *) this_polymap;
+
+/* Chebyshev polynomials always have non-NULL scale array pointers. */
+   *scales = fwd ? this->scale_f : this->scale_i;
+   *offsets = fwd ? this->offset_f : this->offset_i;
+   return ( *scales != NULL );
+}
+
 static void PolyPowers( AstPolyMap *this_polymap, double **work, int ncoord,
                         const int *mxpow, double **ptr, int point, int fwd,
                         int *status ){
@@ -1190,6 +1266,118 @@ static void PolyPowers( AstPolyMap *this_polymap, double **work, int ncoord,
    }
 }
 
+static void PolyPowerDerivs( AstPolyMap *this_polymap, double **work,
+                             double **dwork, int ncoord, const int *mxpow,
+                             double **ptr, int point, int fwd, int *status ){
+/*
+*  Name:
+*     PolyPowerDerivs
+
+*  Purpose:
+*     Find the required powers of the input axis values and their
+*     derivatives.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "chebymap.h"
+*     void PolyPowerDerivs( AstPolyMap *this, double **work, double **dwork,
+*                           int ncoord, const int *mxpow, double **ptr,
+*                           int point, int fwd, int *status )
+
+*  Class Membership:
+*     ChebyMap member function (over-rides the astPolyPowerDerivs
+*     protected method inherited from the PolyMap class).
+
+*  Description:
+*     This function returns the Chebyshev polynomials returned by the
+*     PolyPowers function, together with their derivatives with respect
+*     to the (unscaled) input axis values.
+
+*  Parameters:
+*     this
+*        Pointer to the PolyMap.
+*     work
+*        An array of "ncoord" pointers, each pointing to an array of
+*        length "max(2,mxpow)". The values returned by PolyPowers are
+*        placed in this array on exit.
+*     dwork
+*        An array of "ncoord" pointers, each pointing to an array of
+*        length "max(2,mxpow)". The derivatives of the values returned
+*        in "work" are placed in this array on exit.
+*     ncoord
+*        The number of axes.
+*     mxpow
+*        Pointer to an array holding the maximum power required of each
+*        axis value. Should have "ncoord" elements.
+*     ptr
+*        An array of "ncoord" pointers, each pointing to an array holding
+*        the axis values. Each of these arrays of axis values must have
+*        at least "point+1" elements.
+*     point
+*        The zero based index of the point within "ptr" that holds the
+*        axis values to be exponentiated.
+*     fwd
+*        Do the supplied coefficients define the foward transformation of
+*        the PolyMap?
+*/
+
+/* Local Variables; */
+   AstChebyMap *this;
+   double *pdwork;
+   double *pwork;
+   double *scales;
+   double *offsets;
+   double x;
+   int coord;
+   int ip;
+
+/* Check the local error status. */
+   if ( !astOK ) return;
+
+/* Get a pointer to the ChebyMap structure. */
+   this = (AstChebyMap *) this_polymap;
+
+/* If the coefficients relate to a standard polynomial, then invoke the
+   astPolyPowerDerivs implementation of the parent class (PolyMap). */
+   if( (fwd && !this->scale_f) || (!fwd && !this->scale_i) ) {
+      (*parent_polypowerderivs)( this_polymap, work, dwork, ncoord, mxpow,
+                                 ptr, point, fwd, status );
+
+/* Otherwise, get the Chebyshev polynomials. */
+   } else {
+      PolyPowers( this_polymap, work, ncoord, mxpow, ptr, point, fwd,
+                  status );
+      scales = fwd ? this->scale_f : this->scale_i;
+      offsets = fwd ? this->offset_f : this->offset_i;
+
+/* Differentiating the recurrence relation Tn+1(x') = 2.x'.Tn(x') - Tn-1(x')
+   with respect to x gives Tn+1' = 2.s.Tn + 2.x'.Tn' - Tn-1', where "s"
+   is the scale factor (dx'/dx). T0' is zero and T1' is "s". Loop over
+   all input axes. */
+      for( coord = 0; coord < ncoord; coord++ ) {
+         pwork = work[ coord ];
+         pdwork = dwork[ coord ];
+         pdwork[ 0 ] = 0.0;
+
+/* PolyPowers returns bad values for input positions that are bad or
+   outside the bounding box. */
+         if( mxpow[ coord ] > 0 && pwork[ 1 ] == AST__BAD ) {
+            for( ip = 1; ip <= mxpow[ coord ]; ip++ ) pdwork[ ip ] = AST__BAD;
+
+         } else if( mxpow[ coord ] > 0 ) {
+            x = ptr[ coord ][ point ]*scales[ coord ] + offsets[ coord ];
+            pdwork[ 1 ] = scales[ coord ];
+            for( ip = 2; ip <= mxpow[ coord ]; ip++ ) {
+               pdwork[ ip ] = 2.0*scales[ coord ]*pwork[ ip - 1 ]
+                              + 2.0*x*pdwork[ ip - 1 ] - pdwork[ ip - 2 ];
+            }
+         }
+      }
+   }
+}
+
 static AstPolyMap *PolyTran( AstPolyMap *this_polymap, int forward, double acc,
                              double maxacc, int maxorder, const double *lbnd,
                              const double *ubnd, int *status ){
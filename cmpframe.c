@@ -622,9 +622,7 @@ static void (* parent_setobsalt)( AstFrame *, double, int * );
 static void (* parent_setobslat)( AstFrame *, double, int * );
 static void (* parent_setobslon)( AstFrame *, double, int * );
 
-#if defined(THREAD_SAFE)
 static int (* parent_managelock)( AstObject *, int, int, AstObject **, int * );
-#endif
 
 
 /* Define macros for accessing each item of thread specific global data. */
@@ -702,6 +700,7 @@ static AstSystemType SystemCode( AstFrame *, const char *, int * );
 static AstSystemType ValidateSystem( AstFrame *, AstSystemType, const char *, int * );
 static const char *Abbrev( AstFrame *, int, const char *, const char *, const char *, int * );
 static const char *Format( AstFrame *, int, double, int * );
+static void FormatArray( AstFrame *, int, int, const double *, int, char *, int * );
 static const char *GetDomain( AstFrame *, int * );
 static const char *GetFormat( AstFrame *, int, int * );
 static const char *GetLabel( AstFrame *, int, int * );
@@ -736,6 +735,7 @@ static int TestLabel( AstFrame *, int, int * );
 static int TestSymbol( AstFrame *, int, int * );
 static int TestUnit( AstFrame *, int, int * );
 static int Unformat( AstFrame *, int, const char *, double *, int * );
+static int UnformatArray( AstFrame *, int, int, const char *const [], double *, int * );
 static void AddExtraAxes( int, int [], int, int, int, int * );
 static void ClearDirection( AstFrame *, int, int * );
 static void ClearFormat( AstFrame *, int, int * );
@@ -796,9 +796,7 @@ static void SetObsAlt( AstFrame *, double, int * );
 
 static void ClearAlignSystem( AstFrame *, int * );
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *, int, int, AstObject **, int * );
-#endif
 
 /* Member functions. */
 /* ================= */
@@ -2751,6 +2749,92 @@ static const char *Format( AstFrame *this_frame, int axis, double value, int *st
    return result;
 }
 
+static void FormatArray( AstFrame *this_frame, int axis, int npoint,
+                         const double *value, int len, char *buf,
+                         int *status ) {
+/*
+*  Name:
+*     FormatArray
+
+*  Purpose:
+*     Format an array of coordinate values for a CmpFrame axis.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "cmpframe.h"
+*     void FormatArray( AstFrame *this, int axis, int npoint,
+*                       const double *value, int len, char *buf,
+*                       int *status )
+
+*  Class Membership:
+*     CmpFrame member function (over-rides the astFormatArray method
+*     inherited from the Frame class).
+
+*  Description:
+*     This function formats an array of coordinate values for a
+*     CmpFrame axis, storing the resulting strings in a buffer supplied
+*     by the caller. The formatting applied is the same as for astFormat.
+
+*  Parameters:
+*     this
+*        Pointer to the CmpFrame.
+*     axis
+*        The number of the axis (zero-based) for which formatting is
+*        to be performed.
+*     npoint
+*        The number of values to be formatted.
+*     value
+*        Pointer to an array of "npoint" coordinate values.
+*     len
+*        The number of characters reserved in "buf" for each formatted
+*        value, including the terminating null.
+*     buf
+*        Pointer to a buffer of at least "npoint*len" characters. The
+*        formatted version of "value[i]" is returned as a null-terminated
+*        string starting at "buf[i*len]".
+*     status
+*        Pointer to the inherited status variable.
+*/
+
+/* Local Variables: */
+   AstCmpFrame *this;            /* Pointer to CmpFrame structure */
+   AstFrame *frame;              /* Pointer to Frame containing axis */
+   int naxes1;                   /* Number of axes in frame1 */
+   int set;                      /* Digits attribute set? */
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* Obtain a pointer to the CmpFrame structure. */
+   this = (AstCmpFrame *) this_frame;
+
+/* Validate and permute the axis index supplied. */
+   axis = astValidateAxis( this, axis, 1, "astFormatArray" );
+
+/* Determine the number of axes in the first component Frame. */
+   naxes1 = astGetNaxes( this->frame1 );
+   if ( astOK ) {
+
+/* Decide which component Frame contains the axis and adjust the axis
+   index if necessary. */
+      frame = ( axis < naxes1 ) ? this->frame1 : this->frame2;
+      axis = ( axis < naxes1 ) ? axis : axis - naxes1;
+
+/* Temporarily over-ride the Digits attribute of the component Frame, as
+   in the Format function. */
+      set = astTestDigits( frame );
+      if ( !set ) astSetDigits( frame, astGetDigits( this ) );
+
+/* Invoke the Frame's astFormatArray method to format the values. */
+      astFormatArray( frame, axis, npoint, value, len, buf );
+
+/* Clear Frame attributes which were temporarily over-ridden. */
+      if ( !set ) astClearDigits( frame );
+   }
+}
+
 static AstPointSet *FrameGrid( AstFrame *this_object, int size, const double *lbnd,
                                const double *ubnd, int *status ){
 /*
@@ -4729,10 +4813,8 @@ void astInitCmpFrameVtab_(  AstCmpFrameVtab *vtab, const char *name, int *status
    parent_getusedefs = object->GetUseDefs;
    object->GetUseDefs = GetUseDefs;
 
-#if defined(THREAD_SAFE)
    parent_managelock = object->ManageLock;
    object->ManageLock = ManageLock;
-#endif
 
    mapping->RemoveRegions = RemoveRegions;
    mapping->Simplify = Simplify;
@@ -4841,6 +4923,7 @@ void astInitCmpFrameVtab_(  AstCmpFrameVtab *vtab, const char *name, int *status
    frame->Distance = Distance;
    frame->Fields = Fields;
    frame->Format = Format;
+   frame->FormatArray = FormatArray;
    frame->FrameGrid = FrameGrid;
    frame->Centre = Centre;
    frame->Gap = Gap;
@@ -4874,6 +4957,7 @@ void astInitCmpFrameVtab_(  AstCmpFrameVtab *vtab, const char *name, int *status
    frame->TestSymbol = TestSymbol;
    frame->TestUnit = TestUnit;
    frame->Unformat = Unformat;
+   frame->UnformatArray = UnformatArray;
    frame->ValidateSystem = ValidateSystem;
    frame->SystemString = SystemString;
    frame->SystemCode = SystemCode;
@@ -4945,7 +5029,6 @@ static int IsUnitFrame( AstFrame *this_frame, int *status ){
    return astIsUnitFrame( this->frame1 ) && astIsUnitFrame( this->frame2 );
 }
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *this_object, int mode, int extra,
                        AstObject **fail, int *status ) {
 /*
@@ -5038,7 +5121,6 @@ static int ManageLock( AstObject *this_object, int mode, int extra,
    return result;
 
 }
-#endif
 
 static int Match( AstFrame *template_frame, AstFrame *target, int matchsub,
                   int **template_axes, int **target_axes,
@@ -9946,6 +10028,103 @@ static int Unformat( AstFrame *this_frame, int axis, const char *string,
    return nc;
 }
 
+static int UnformatArray( AstFrame *this_frame, int axis, int npoint,
+                          const char *const strings[], double *value,
+                          int *status ) {
+/*
+*  Name:
+*     UnformatArray
+
+*  Purpose:
+*     Read an array of formatted coordinate values for a CmpFrame axis.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "cmpframe.h"
+*     int UnformatArray( AstFrame *this, int axis, int npoint,
+*                        const char *const strings[], double *value,
+*                        int *status )
+
+*  Class Membership:
+*     CmpFrame member function (over-rides the astUnformatArray method
+*     inherited from the Frame class).
+
+*  Description:
+*     This function reads an array of formatted coordinate values for
+*     a CmpFrame axis (supplied as strings) and returns the equivalent
+*     numerical values. Each string is interpreted as by astUnformat.
+
+*  Parameters:
+*     this
+*        Pointer to the CmpFrame.
+*     axis
+*        The number of the axis (zero-based) for which the coordinate
+*        values are to be read.
+*     npoint
+*        The number of strings to be read.
+*     strings
+*        An array of "npoint" pointers to null-terminated strings, each
+*        holding a formatted coordinate value.
+*     value
+*        Pointer to an array in which to return the "npoint" coordinate
+*        values read.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     The number of strings that were read successfully (see
+*     astUnformatArray).
+*/
+
+/* Local Variables: */
+   AstCmpFrame *this;            /* Pointer to CmpFrame structure */
+   AstFrame *frame;              /* Pointer to Frame containing axis */
+   int naxes1;                   /* Number of axes in frame1 */
+   int result;                   /* Number of strings read */
+   int set;                      /* Digits attribute set? */
+
+/* Initialise. */
+   result = 0;
+
+/* Check the global error status. */
+   if ( !astOK ) return result;
+
+/* Obtain a pointer to the CmpFrame structure. */
+   this = (AstCmpFrame *) this_frame;
+
+/* Validate and permute the axis index supplied. */
+   axis = astValidateAxis( this, axis, 1, "astUnformatArray" );
+
+/* Determine the number of axes in the first component Frame. */
+   naxes1 = astGetNaxes( this->frame1 );
+   if ( astOK ) {
+
+/* Decide which component Frame contains the axis and adjust the axis
+   index if necessary. */
+      frame = ( axis < naxes1 ) ? this->frame1 : this->frame2;
+      axis = ( axis < naxes1 ) ? axis : axis - naxes1;
+
+/* Temporarily over-ride the Digits attribute of the component Frame, as
+   in the Unformat function. */
+      set = astTestDigits( frame );
+      if ( !set ) astSetDigits( frame, astGetDigits( this ) );
+
+/* Invoke the Frame's astUnformatArray method to read the values. */
+      result = astUnformatArray( frame, axis, npoint, strings, value );
+
+/* Clear Frame attributes which were temporarily over-ridden. */
+      if ( !set ) astClearDigits( frame );
+   }
+
+/* Return zero if an error occurred. */
+   if ( !astOK ) result = 0;
+
+/* Return the result. */
+   return result;
+}
+
 static int ValidateSystem( AstFrame *this, AstSystemType system, const char *method, int *status ) {
 /*
 *
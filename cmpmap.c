@@ -190,6 +190,18 @@ f     The CmpMap class does not define any new routines beyond those
 #include <string.h>
 #include <stdio.h>
 
+/* Type Definitions. */
+/* ================= */
+/* Structure holding the list of Mappings which implement a series
+   CmpMap created by astCompile. The Mappings are those returned by
+   astMapList and, when applied in order with the given Invert values,
+   they implement the forward transformation of the un-inverted CmpMap. */
+typedef struct AstCmpMapPlan {
+   AstMapping **map_list;        /* Mappings to be applied in series */
+   int *invert_list;             /* Invert value required for each Mapping */
+   int nmap;                     /* Number of Mappings */
+} AstCmpMapPlan;
+
 /* Module Variables. */
 /* ================= */
 
@@ -199,13 +211,12 @@ static int class_check;
 
 /* Pointers to parent class methods which are extended by this class. */
 static int (* parent_getobjsize)( AstObject *, int * );
+static AstMapping *(* parent_compile)( AstMapping *, int * );
 static AstPointSet *(* parent_transform)( AstMapping *, AstPointSet *, int, AstPointSet *, int * );
 static int (* parent_maplist)( AstMapping *, int, int, int *, AstMapping ***, int **, int * );
 static int *(* parent_mapsplit)( AstMapping *, int, const int *, AstMapping **, int * );
 
-#if defined(THREAD_SAFE)
 static int (* parent_managelock)( AstObject *, int, int, AstObject **, int * );
-#endif
 
 
 /* Define macros for accessing each item of thread specific global data. */
@@ -251,10 +262,13 @@ AstCmpMap *astCmpMapId_( void *, void *, int, const char *, ... );
 
 /* Prototypes for Private Member Functions. */
 /* ======================================== */
+static AstCmpMapPlan *FreePlan( AstCmpMapPlan *, int * );
 static AstMapping *CombineMaps( AstMapping *, int, AstMapping *, int, int, int * );
+static AstMapping *Compile( AstMapping *, int * );
 static AstMapping *RemoveRegions( AstMapping *, int * );
 static AstMapping *Simplify( AstMapping *, int * );
 static AstPointSet *Transform( AstMapping *, AstPointSet *, int, AstPointSet *, int * );
+static void JacobianPoints( AstMapping *, AstPointSet *, int, AstPointSet *, int * );
 static double Rate( AstMapping *, double *, int, int, int * );
 static int *MapSplit( AstMapping *, int, const int *, AstMapping **, int * );
 static int *MapSplit0( AstMapping *, int, const int *, AstMapping **, int, int * );
@@ -265,15 +279,17 @@ static int GetIsLinear( AstMapping *, int * );
 static int MapList( AstMapping *, int, int, int *, AstMapping ***, int **, int * );
 static int MapMerge( AstMapping *, int, int, int *, AstMapping ***, int **, int * );
 static int PatternCheck( int, int, int **, int *, int * );
+static int ThreadSafe( AstMapping *, int * );
 static void Copy( const AstObject *, AstObject *, int * );
 static void Decompose( AstMapping *, AstMapping **, AstMapping **, int *, int *, int *, int * );
 static void Delete( AstObject *, int * );
 static void Dump( AstObject *, AstChannel *, int * );
+static void CompilePlan( AstCmpMap *, int * );
+static void TransformSeries( AstPointSet *, int, int, AstMapping **, const int *, AstPointSet *, int * );
+static void JacobianSeries( AstPointSet *, int, int, AstMapping **, const int *, AstPointSet *, int * );
 static int GetObjSize( AstObject *, int * );
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *, int, int, AstObject **, int * );
-#endif
 
 
 /* Member functions. */
@@ -414,6 +430,61 @@ static int Equal( AstObject *this_object, AstObject *that_object, int *status )
    return result;
 }
 
+static AstCmpMapPlan *FreePlan( AstCmpMapPlan *plan, int *status ) {
+/*
+*  Name:
+*     FreePlan
+
+*  Purpose:
+*     Free a compiled list of series Mappings.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "cmpmap.h"
+*     AstCmpMapPlan *FreePlan( AstCmpMapPlan *plan, int *status )
+
+*  Class Membership:
+*     CmpMap member function.
+
+*  Description:
+*     This function annuls the Mapping pointers in a list created by
+*     CompilePlan and frees the memory used to hold the list.
+
+*  Parameters:
+*     plan
+*        Pointer to the list to be freed. May be NULL.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     A NULL pointer.
+
+*  Notes:
+*     - This function attempts to execute even if the global error
+*     status is set.
+*/
+
+/* Local Variables: */
+   int imap;                     /* Index of Mapping in list */
+
+/* Check a list was supplied. */
+   if ( plan ) {
+
+/* Annul the Mapping pointers and free the arrays. */
+      for ( imap = 0; imap < plan->nmap; imap++ ) {
+         plan->map_list[ imap ] = astAnnul( plan->map_list[ imap ] );
+      }
+      plan->map_list = astFree( plan->map_list );
+      plan->invert_list = astFree( plan->invert_list );
+      plan = astFree( plan );
+   }
+
+/* Return a NULL pointer. */
+   return NULL;
+}
+
 static int GetIsLinear( AstMapping *this_mapping, int *status ){
 /*
 *  Name:
@@ -506,6 +577,11 @@ static int GetObjSize( AstObject *this_object, int *status ) {
 
    result += astGetObjSize( this->map1 );
    result += astGetObjSize( this->map2 );
+   if( this->plan ) {
+      result += astTSizeOf( this->plan );
+      result += astTSizeOf( this->plan->map_list );
+      result += astTSizeOf( this->plan->invert_list );
+   }
 
 /* If an error occurred, clear the result value. */
    if ( !astOK ) result = 0;
@@ -606,9 +682,10 @@ static AstMapping *CombineMaps( AstMapping *mapping1, int invert1,
    copy = ( ( mapping1 == mapping2 ) && ( invert1 != invert2 ) );
 
 /* Clone the first Mapping pointer. Do likewise for the second but
-   make a copy instead if necessary. */
-   map1 = astClone( mapping1 );
-   map2 = copy ? astCopy( mapping2 ) : astClone( mapping2 );
+   make a copy instead if necessary. A frozen Mapping may be in use by
+   other threads, so also use a copy if its Invert flag needs changing. */
+   map1 = astCopyIfFrozen( mapping1, invert1 );
+   map2 = copy ? astCopy( mapping2 ) : astCopyIfFrozen( mapping2, invert2 );
 
 /* If the Invert value for the first Mapping needs changing, make the
    change. */
@@ -664,6 +741,148 @@ static AstMapping *CombineMaps( AstMapping *mapping1, int invert1,
    return result;
 }
 
+static AstMapping *Compile( AstMapping *this, int *status ) {
+/*
+*  Name:
+*     Compile
+
+*  Purpose:
+*     Prepare a CmpMap for fast repeated use.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "cmpmap.h"
+*     AstMapping *Compile( AstMapping *this, int *status )
+
+*  Class Membership:
+*     CmpMap method (over-rides the astCompile method inherited from
+*     the Mapping class).
+
+*  Description:
+*     This function returns a simplified copy of the supplied CmpMap
+*     in which every CmpMap that combines Mappings in series holds a
+*     flat list of the Mappings it contains. This list is then used by
+*     astTransform, avoiding the need to decompose the CmpMap each time
+*     points are transformed.
+
+*  Parameters:
+*     this
+*        Pointer to the CmpMap.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     A new pointer to the compiled Mapping.
+
+*  Notes:
+*     - A NULL pointer will be returned if this function is invoked with
+*     the global error status set, or if it should fail for any reason.
+*/
+
+/* Local Variables: */
+   AstMapping *result;           /* Pointer to returned Mapping */
+
+/* Check the global error status. */
+   if ( !astOK ) return NULL;
+
+/* Use the parent method to obtain an independent simplified copy of the
+   CmpMap. */
+   result = (*parent_compile)( this, status );
+
+/* If the result is still a CmpMap, store the lists of Mappings within
+   it. */
+   if ( astOK && astIsACmpMap( result ) ) {
+      CompilePlan( (AstCmpMap *) result, status );
+   }
+
+/* Return the result, deleting it if an error occurred. */
+   if ( !astOK ) result = astAnnul( result );
+   return result;
+}
+
+static void CompilePlan( AstCmpMap *this, int *status ) {
+/*
+*  Name:
+*     CompilePlan
+
+*  Purpose:
+*     Store lists of series Mappings within a compiled CmpMap.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "cmpmap.h"
+*     void CompilePlan( AstCmpMap *this, int *status )
+
+*  Class Membership:
+*     CmpMap member function.
+
+*  Description:
+*     If the supplied CmpMap combines its component Mappings in series,
+*     this function decomposes it into a list of Mappings using
+*     astMapList and stores the list in the CmpMap. The function then
+*     invokes itself on any CmpMaps in the list (or on the component
+*     Mappings of a parallel CmpMap) so that nested series CmpMaps are
+*     also compiled.
+
+*  Parameters:
+*     this
+*        Pointer to the CmpMap. This should not be accessible to
+*        anything other than astCompile.
+*     status
+*        Pointer to the inherited status variable.
+*/
+
+/* Local Variables: */
+   AstCmpMapPlan *plan;          /* Pointer to new list of Mappings */
+   int imap;                     /* Index of Mapping in list */
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* For a series CmpMap, decompose the two component Mappings into a list
+   of Mappings which implement the forward transformation of the
+   (un-inverted) CmpMap. The component Mappings are used rather than the
+   CmpMap itself so that the CmpMap is always expanded at least one
+   level. */
+   if ( this->series ) {
+      plan = astMalloc( sizeof( AstCmpMapPlan ) );
+      if ( astOK ) {
+         plan->nmap = 0;
+         plan->map_list = NULL;
+         plan->invert_list = NULL;
+         (void) astMapList( this->map1, 1, this->invert1, &plan->nmap,
+                            &plan->map_list, &plan->invert_list );
+         (void) astMapList( this->map2, 1, this->invert2, &plan->nmap,
+                            &plan->map_list, &plan->invert_list );
+
+/* Store the list in the CmpMap, replacing any previous list. */
+         (void) FreePlan( this->plan, status );
+         this->plan = plan;
+
+/* Compile any CmpMaps in the list. These will be parallel CmpMaps, or
+   series CmpMaps that could not be expanded. */
+         for ( imap = 0; imap < plan->nmap; imap++ ) {
+            if ( astIsACmpMap( plan->map_list[ imap ] ) ) {
+               CompilePlan( (AstCmpMap *) plan->map_list[ imap ], status );
+            }
+         }
+      }
+
+/* For a parallel CmpMap, compile any component CmpMaps. */
+   } else {
+      if ( astIsACmpMap( this->map1 ) ) {
+         CompilePlan( (AstCmpMap *) this->map1, status );
+      }
+      if ( astIsACmpMap( this->map2 ) ) {
+         CompilePlan( (AstCmpMap *) this->map2, status );
+      }
+   }
+}
+
 static void Decompose( AstMapping *this_mapping, AstMapping **map1,
                        AstMapping **map2, int *series, int *invert1,
                        int *invert2, int *status ) {
@@ -852,10 +1071,11 @@ void astInitCmpMapVtab_(  AstCmpMapVtab *vtab, const char *name, int *status ) {
    parent_getobjsize = object->GetObjSize;
    object->GetObjSize = GetObjSize;
 
-#if defined(THREAD_SAFE)
    parent_managelock = object->ManageLock;
    object->ManageLock = ManageLock;
-#endif
+
+   parent_compile = mapping->Compile;
+   mapping->Compile = Compile;
 
    parent_maplist = mapping->MapList;
    mapping->MapList = MapList;
@@ -874,6 +1094,7 @@ void astInitCmpMapVtab_(  AstCmpMapVtab *vtab, const char *name, int *status ) {
    mapping->Simplify = Simplify;
    mapping->RemoveRegions = RemoveRegions;
    mapping->GetIsLinear = GetIsLinear;
+   mapping->ThreadSafe = ThreadSafe;
 
 /* For some reason the CmpMap implementation of astRate can be immensely
    slow for complex Mapping, so it's currently disable until such time as
@@ -881,6 +1102,7 @@ void astInitCmpMapVtab_(  AstCmpMapVtab *vtab, const char *name, int *status ) {
 
    mapping->Rate = Rate;
 */
+   mapping->JacobianPoints = JacobianPoints;
 
 /* Declare the copy constructor, destructor and class dump function. */
    astSetCopy( vtab, Copy );
@@ -896,7 +1118,6 @@ void astInitCmpMapVtab_(  AstCmpMapVtab *vtab, const char *name, int *status ) {
    }
 }
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *this_object, int mode, int extra,
                        AstObject **fail, int *status ) {
 /*
@@ -989,7 +1210,6 @@ static int ManageLock( AstObject *this_object, int mode, int extra,
    return result;
 
 }
-#endif
 
 static int MapList( AstMapping *this_mapping, int series, int invert,
                      int *nmap, AstMapping ***map_list, int **invert_list, int *status ) {
@@ -2970,6 +3190,166 @@ static int PatternCheck( int val, int check, int **list, int *list_len, int *sta
    return result;
 }
 
+static void JacobianPoints( AstMapping *this, AstPointSet *in, int forward,
+                            AstPointSet *jac, int *status ) {
+/*
+*  Name:
+*     JacobianPoints
+
+*  Purpose:
+*     Find the Jacobian matrix of a Mapping at a set of points.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "cmpmap.h"
+*     void JacobianPoints( AstMapping *this, AstPointSet *in, int forward,
+*                          AstPointSet *jac, int *status )
+
+*  Class Membership:
+*     CmpMap member function (over-rides the astJacobianPoints protected
+*     method inherited from the Mapping class).
+
+*  Description:
+*     This function finds the Jacobian matrix of the forward or inverse
+*     transformation of a CmpMap at each of the points in a PointSet,
+*     using the Jacobians of the two component Mappings. For Mappings in
+*     series, these are combined using the chain rule. For Mappings in
+*     parallel, they form the diagonal blocks of the returned Jacobian.
+
+*  Parameters:
+*     this
+*        Pointer to the CmpMap.
+*     in
+*        Pointer to the PointSet holding the positions at which the
+*        Jacobian is required.
+*     forward
+*        A non-zero value indicates that the Jacobian of the forward
+*        coordinate transformation is required, while a zero value
+*        requests the Jacobian of the inverse transformation.
+*     jac
+*        Pointer to the PointSet in which to store the Jacobian.
+*     status
+*        Pointer to the inherited status variable.
+*/
+
+/* Local Variables: */
+   AstCmpMap *map;               /* Pointer to CmpMap */
+   AstMapping **map_list;        /* Mappings to be applied in series */
+   AstPointSet *jac_a;           /* Jacobian of first Mapping */
+   AstPointSet *jac_b;           /* Jacobian of second Mapping */
+   AstPointSet *temp;            /* Subset of input positions */
+   double **ptr_a;               /* Pointers to Jacobian of first Mapping */
+   double **ptr_b;               /* Pointers to Jacobian of second Mapping */
+   double **ptr_jac;             /* Pointers to returned Jacobian */
+   int *invert_list;             /* Invert values for series Mappings */
+   int forward1;                 /* Use forward direction for Mapping 1? */
+   int forward2;                 /* Use forward direction for Mapping 2? */
+   int i;                        /* Output coordinate index */
+   int imap;                     /* Index of Mapping in series */
+   int j;                        /* Input coordinate index */
+   int nin1;                     /* No. input coordinates for Mapping 1 */
+   int nin;                      /* No. input coordinates */
+   int nmap;                     /* Number of Mappings in series */
+   int nout1;                    /* No. output coordinates for Mapping 1 */
+   int nout;                     /* No. output coordinates */
+   int npoint;                   /* Number of points */
+   int point;                    /* Point index */
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* Obtain a pointer to the CmpMap, and get the dimensions of the
+   problem. */
+   map = (AstCmpMap *) this;
+   nin = astGetNcoord( in );
+   nout = forward ? astGetNout( this ) : astGetNin( this );
+   npoint = astGetNpoint( in );
+   ptr_jac = astGetPoints( jac );
+
+/* Determine the direction in which each component Mapping is to be
+   used, in the same way as astTransform. */
+   if ( astGetInvert( map ) ) forward = !forward;
+   forward1 = forward;
+   forward2 = forward;
+   if ( map->invert1 != astGetInvert( map->map1 ) ) forward1 = !forward1;
+   if ( map->invert2 != astGetInvert( map->map2 ) ) forward2 = !forward2;
+
+/* Mappings in series. */
+/* ------------------- */
+/* As in astTransform, pass the points through a flat list of the
+   Mappings to be applied in series, accumulating the Jacobian of the
+   Mappings applied so far using the chain rule. */
+   if ( map->series ) {
+      if ( map->plan ) {
+         JacobianSeries( in, forward, map->plan->nmap, map->plan->map_list,
+                         map->plan->invert_list, jac, status );
+      } else {
+         nmap = 0;
+         map_list = NULL;
+         invert_list = NULL;
+         (void) astMapList( map->map1, 1, map->invert1, &nmap, &map_list,
+                            &invert_list );
+         (void) astMapList( map->map2, 1, map->invert2, &nmap, &map_list,
+                            &invert_list );
+
+         JacobianSeries( in, forward, nmap, map_list, invert_list, jac,
+                         status );
+
+         for ( imap = 0; imap < nmap; imap++ ) {
+            map_list[ imap ] = astAnnul( map_list[ imap ] );
+         }
+         map_list = astFree( map_list );
+         invert_list = astFree( invert_list );
+      }
+
+/* Mappings in parallel. */
+/* --------------------- */
+/* Find the Jacobian of each component Mapping, using the corresponding
+   subset of the input coordinates, and store it in the corresponding
+   diagonal block of the returned Jacobian. All other elements are
+   zero. */
+   } else {
+      nin1 = forward1 ? astGetNin( map->map1 ) : astGetNout( map->map1 );
+      nout1 = forward1 ? astGetNout( map->map1 ) : astGetNin( map->map1 );
+
+      temp = astPointSet( npoint, nin1, "", status );
+      astSetSubPoints( in, 0, 0, temp );
+      jac_a = astJacobianPoints( map->map1, temp, forward1, NULL );
+      temp = astDelete( temp );
+
+      temp = astPointSet( npoint, nin - nin1, "", status );
+      astSetSubPoints( in, 0, nin1, temp );
+      jac_b = astJacobianPoints( map->map2, temp, forward2, NULL );
+      temp = astDelete( temp );
+
+      ptr_a = astGetPoints( jac_a );
+      ptr_b = astGetPoints( jac_b );
+      if ( astOK ) {
+         for ( i = 0; i < nout; i++ ) {
+            for ( j = 0; j < nin; j++ ) {
+               if ( i < nout1 && j < nin1 ) {
+                  (void) memcpy( ptr_jac[ i*nin + j ],
+                                 ptr_a[ i*nin1 + j ],
+                                 sizeof( double )*(size_t) npoint );
+               } else if ( i >= nout1 && j >= nin1 ) {
+                  (void) memcpy( ptr_jac[ i*nin + j ],
+                                 ptr_b[ ( i - nout1 )*( nin - nin1 ) + j - nin1 ],
+                                 sizeof( double )*(size_t) npoint );
+               } else {
+                  for ( point = 0; point < npoint; point++ ) {
+                     ptr_jac[ i*nin + j ][ point ] = 0.0;
+                  }
+               }
+            }
+         }
+      }
+      jac_a = astAnnul( jac_a );
+      jac_b = astAnnul( jac_b );
+   }
+}
+
 static double Rate( AstMapping *this, double *at, int ax1, int ax2, int *status ){
 /*
 *  Name:
@@ -3639,6 +4019,40 @@ static AstMapping *Simplify( AstMapping *this_mapping, int *status ) {
    return result;
 }
 
+static int ThreadSafe( AstMapping *this_mapping, int *status ){
+/*
+*  Name:
+*     ThreadSafe
+
+*  Purpose:
+*     Check if a CmpMap can transform points in several threads at once.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "cmpmap.h"
+*     int ThreadSafe( AstMapping *this, int *status )
+
+*  Class Membership:
+*     CmpMap member function (over-rides the protected astThreadSafe
+*     method inherited from the Mapping class).
+
+*  Description:
+*     This function returns a non-zero value if both component Mappings
+*     can safely be used by several threads at once.
+
+*  Parameters:
+*     this
+*        Pointer to the CmpMap.
+*     status
+*        Pointer to the inherited status variable.
+*/
+   AstCmpMap *this;
+   this = (AstCmpMap *) this_mapping;
+   return astThreadSafe( this->map1 ) && astThreadSafe( this->map2 );
+}
+
 static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
                                int forward, AstPointSet *out, int *status ) {
 /*
@@ -3697,26 +4111,21 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
 
 /* Local Variables: */
    AstCmpMap *map;               /* Pointer to CmpMap to be applied */
+   AstMapping **map_list;        /* Mappings to be applied in series */
    AstPointSet *result;          /* Pointer to output PointSet */
    AstPointSet *temp1;           /* Pointer to temporary PointSet */
    AstPointSet *temp2;           /* Pointer to temporary PointSet */
-   AstPointSet *temp;            /* Pointer to temporary PointSet */
+   int *invert_list;             /* Invert values for series Mappings */
    int forward1;                 /* Use forward direction for Mapping 1? */
    int forward2;                 /* Use forward direction for Mapping 2? */
-   int ipoint1;                  /* Index of first point in batch */
-   int ipoint2;                  /* Index of last point in batch */
+   int imap;                     /* Index of Mapping in series */
    int nin1;                     /* No. input coordinates for Mapping 1 */
    int nin2;                     /* No. input coordinates for Mapping 2 */
-   int nin;                      /* No. input coordinates supplied */
+   int nmap;                     /* Number of Mappings in series */
    int nout1;                    /* No. output coordinates for Mapping 1 */
    int nout2;                    /* No. output coordinates for Mapping 2 */
-   int nout;                     /* No. output coordinates supplied */
-   int np;                       /* Number of points in batch */
    int npoint;                   /* Number of points to be transformed */
 
-/* Local Constants: */
-   const int nbatch = 2048;      /* Maximum points in a batch */
-
 /* Check the global error status. */
    if ( !astOK ) return NULL;
 
@@ -3751,56 +4160,39 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
 
 /* Mappings in series. */
 /* ------------------- */
-/* If required, use the two component Mappings in series. To do this, we must
-   apply one Mapping followed by the other, which means storing an intermediate
-   result. Since this function may be invoked recursively and have to store an
-   intermediate result on each occasion, the memory required may become
-   excessive when transforming large numbers of points. To overcome this, we
-   split the points up into smaller batches. */
+/* If required, use the two component Mappings in series. Rather than
+   recursing into any nested CmpMaps (which would create a new
+   intermediate PointSet at every level), we pass the points through a
+   single flat list of the Mappings to be applied in series. If the
+   CmpMap was created by astCompile, this list is stored in the CmpMap.
+   Otherwise, we obtain it by decomposing the two component Mappings
+   (we use the component Mappings rather than the CmpMap itself so that
+   the CmpMap is always expanded at least one level, since astMapList
+   will not expand CmpMaps for which astDoNotSimplify is true). */
    if ( astOK ) {
       if ( map->series ) {
-
-/* Obtain the numbers of input and output coordinates. */
-         nin = astGetNcoord( in );
-         nout = astGetNcoord( result );
-
-/* Loop to process all the points in batches, of maximum size nbatch points. */
-         for ( ipoint1 = 0; ipoint1 < npoint; ipoint1 += nbatch ) {
-
-/* Calculate the index of the final point in the batch and deduce the number of
-   points (np) to be processed in this batch. */
-            ipoint2 = ipoint1 + nbatch - 1;
-            if ( ipoint2 > npoint - 1 ) ipoint2 = npoint - 1;
-            np = ipoint2 - ipoint1 + 1;
-
-/* Create temporary PointSets to describe the input and output points for this
-   batch. */
-            temp1 = astPointSet( np, nin, "", status );
-            temp2 = astPointSet( np, nout, "", status );
-
-/* Associate the required subsets of the input and output coordinates with the
-   two PointSets. */
-            astSetSubPoints( in, ipoint1, 0, temp1 );
-            astSetSubPoints( result, ipoint1, 0, temp2 );
-
-/* Apply the two Mappings in sequence and in the required order and direction.
-   Store the intermediate result in a temporary PointSet (temp) which is
-   created by the first Mapping applied. */
-            if ( forward ) {
-               temp = astTransform( map->map1, temp1, forward1, NULL );
-               (void) astTransform( map->map2, temp, forward2, temp2 );
-            } else {
-               temp = astTransform( map->map2, temp1, forward2, NULL );
-               (void) astTransform( map->map1, temp, forward1, temp2 );
+         if ( map->plan ) {
+            TransformSeries( in, forward, map->plan->nmap,
+                             map->plan->map_list, map->plan->invert_list,
+                             result, status );
+         } else {
+            nmap = 0;
+            map_list = NULL;
+            invert_list = NULL;
+            (void) astMapList( map->map1, 1, map->invert1, &nmap, &map_list,
+                               &invert_list );
+            (void) astMapList( map->map2, 1, map->invert2, &nmap, &map_list,
+                               &invert_list );
+
+            TransformSeries( in, forward, nmap, map_list, invert_list,
+                             result, status );
+
+/* Annul the Mapping pointers and free the lists. */
+            for ( imap = 0; imap < nmap; imap++ ) {
+               map_list[ imap ] = astAnnul( map_list[ imap ] );
             }
-
-/* Delete the temporary PointSets after processing each batch of points. */
-            temp = astDelete( temp );
-            temp1 = astDelete( temp1 );
-            temp2 = astDelete( temp2 );
-
-/* Quit processing batches if an error occurs. */
-            if ( !astOK ) break;
+            map_list = astFree( map_list );
+            invert_list = astFree( invert_list );
          }
 
 /* Mappings in parallel. */
@@ -3864,6 +4256,338 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
    return result;
 }
 
+static void TransformSeries( AstPointSet *in, int forward, int nmap,
+                             AstMapping **map_list, const int *invert_list,
+                             AstPointSet *out, int *status ) {
+/*
+*  Name:
+*     TransformSeries
+
+*  Purpose:
+*     Transform a set of points using a list of Mappings in series.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "cmpmap.h"
+*     void TransformSeries( AstPointSet *in, int forward, int nmap,
+*                           AstMapping **map_list, const int *invert_list,
+*                           AstPointSet *out, int *status )
+
+*  Class Membership:
+*     CmpMap member function.
+
+*  Description:
+*     This function passes a set of points through a list of Mappings
+*     (as returned by astMapList) applied in series. The points are
+*     processed in batches small enough for the intermediate results to
+*     stay in cache, using a pair of scratch buffers which are re-used
+*     for alternate Mappings and for all batches.
+
+*  Parameters:
+*     in
+*        Pointer to the PointSet holding the input coordinate values.
+*     forward
+*        A non-zero value indicates that the forward transformation
+*        implemented by the list of Mappings should be applied, while a
+*        zero value requests the inverse transformation.
+*     nmap
+*        The number of Mappings in the list.
+*     map_list
+*        Array of "nmap" Mapping pointers. When applied in order, with
+*        the Invert values given in "invert_list", these implement the
+*        forward transformation.
+*     invert_list
+*        Array of "nmap" Invert values to be used with the Mappings in
+*        "map_list".
+*     out
+*        Pointer to the PointSet which is to receive the output
+*        coordinate values.
+*     status
+*        Pointer to the inherited status variable.
+*/
+
+/* Local Variables: */
+   AstMapping **stage_map;       /* Mappings in order of application */
+   AstPointSet **stage_ps;       /* Intermediate result for each Mapping */
+   AstPointSet *temp1;           /* Input points for a batch */
+   AstPointSet *temp2;           /* Output points for a batch */
+   double **ptr;                 /* Pointers to intermediate coordinates */
+   double *work[ 2 ];            /* Scratch buffers for intermediate results */
+   int *stage_fwd;               /* Direction to use for each Mapping */
+   int icoord;                   /* Coordinate index */
+   int imap;                     /* Index of Mapping in series */
+   int ipoint1;                  /* Index of first point in batch */
+   int ipoint2;                  /* Index of last point in batch */
+   int jmap;                     /* Index of Mapping in map_list */
+   int maxcoord;                 /* Max. no. of intermediate coordinates */
+   int nb;                       /* Number of points in a full batch */
+   int ncoord;                   /* No. of intermediate coordinates */
+   int np;                       /* Number of points in batch */
+   int npoint;                   /* Number of points to be transformed */
+
+/* Local Constants: */
+   const int nbatch = 2048;      /* Maximum points in a batch */
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* Allocate arrays to hold the direction in which each Mapping is to be
+   used (in the order in which they are to be applied) and a PointSet
+   describing the intermediate result produced by each Mapping other than
+   the last. */
+   stage_map = astMalloc( sizeof( AstMapping * )*(size_t) nmap );
+   stage_fwd = astMalloc( sizeof( int )*(size_t) nmap );
+   stage_ps = astCalloc( nmap, sizeof( AstPointSet * ) );
+   if ( astOK ) {
+
+/* Store the Mappings in the order in which they are to be applied. If
+   the inverse transformation is required, this means reversing the
+   list and using each Mapping in the opposite direction. Also allow for
+   any changes in the Invert attribute of each Mapping since the list
+   was obtained. */
+      for ( imap = 0; imap < nmap; imap++ ) {
+         jmap = forward ? imap : nmap - 1 - imap;
+         stage_map[ imap ] = map_list[ jmap ];
+         stage_fwd[ imap ] = ( invert_list[ jmap ] ==
+                               astGetInvert( map_list[ jmap ] ) );
+         if ( !forward ) stage_fwd[ imap ] = !stage_fwd[ imap ];
+      }
+
+/* Find the largest number of coordinates in any intermediate result. */
+      maxcoord = 0;
+      for ( imap = 0; imap < nmap - 1; imap++ ) {
+         ncoord = stage_fwd[ imap ] ? astGetNout( stage_map[ imap ] ) :
+                                      astGetNin( stage_map[ imap ] );
+         if ( ncoord > maxcoord ) maxcoord = ncoord;
+      }
+
+/* Allocate the two scratch buffers, and an array of coordinate pointers. */
+      npoint = astGetNpoint( in );
+      nb = ( npoint < nbatch ) ? npoint : nbatch;
+      work[ 0 ] = astMalloc( sizeof( double )*(size_t)( nb*maxcoord ) );
+      work[ 1 ] = astMalloc( sizeof( double )*(size_t)( nb*maxcoord ) );
+      ptr = astMalloc( sizeof( double * )*(size_t) maxcoord );
+
+/* Create a PointSet for each intermediate result, using the two scratch
+   buffers for alternate Mappings so that the input to each Mapping is
+   never over-written by its own output. */
+      for ( imap = 0; imap < nmap - 1 && astOK; imap++ ) {
+         ncoord = stage_fwd[ imap ] ? astGetNout( stage_map[ imap ] ) :
+                                      astGetNin( stage_map[ imap ] );
+         for ( icoord = 0; icoord < ncoord; icoord++ ) {
+            ptr[ icoord ] = work[ imap % 2 ] + icoord*nb;
+         }
+         stage_ps[ imap ] = astPointSet( nb, ncoord, "", status );
+         astSetPoints( stage_ps[ imap ], ptr );
+      }
+
+/* Create PointSets to describe the input and output points for each
+   batch. */
+      temp1 = astPointSet( nb, astGetNcoord( in ), "", status );
+      temp2 = astPointSet( nb, astGetNcoord( out ), "", status );
+
+/* Loop to process all the points in batches, of maximum size nbatch points. */
+      for ( ipoint1 = 0; ipoint1 < npoint && astOK; ipoint1 += nbatch ) {
+
+/* Calculate the index of the final point in the batch and deduce the number of
+   points (np) to be processed in this batch. If this is a short final
+   batch, reduce the size of all the PointSets to match. */
+         ipoint2 = ipoint1 + nbatch - 1;
+         if ( ipoint2 > npoint - 1 ) ipoint2 = npoint - 1;
+         np = ipoint2 - ipoint1 + 1;
+         if ( np < nb ) {
+            astSetNpoint( temp1, np );
+            astSetNpoint( temp2, np );
+            for ( imap = 0; imap < nmap - 1; imap++ ) {
+               astSetNpoint( stage_ps[ imap ], np );
+            }
+         }
+
+/* Associate the required subsets of the input and output coordinates with the
+   two PointSets. */
+         astSetSubPoints( in, ipoint1, 0, temp1 );
+         astSetSubPoints( out, ipoint1, 0, temp2 );
+
+/* Apply each Mapping in turn, in the required direction. */
+         for ( imap = 0; imap < nmap; imap++ ) {
+            (void) astTransform( stage_map[ imap ],
+                                 imap ? stage_ps[ imap - 1 ] : temp1,
+                                 stage_fwd[ imap ],
+                                 ( imap < nmap - 1 ) ? stage_ps[ imap ] : temp2 );
+         }
+      }
+
+/* Delete the PointSets and free the scratch buffers. */
+      temp1 = astDelete( temp1 );
+      temp2 = astDelete( temp2 );
+      for ( imap = 0; imap < nmap - 1; imap++ ) {
+         if ( stage_ps[ imap ] ) stage_ps[ imap ] = astDelete( stage_ps[ imap ] );
+      }
+      work[ 0 ] = astFree( work[ 0 ] );
+      work[ 1 ] = astFree( work[ 1 ] );
+      ptr = astFree( ptr );
+   }
+
+/* Free the remaining work space. */
+   stage_map = astFree( stage_map );
+   stage_fwd = astFree( stage_fwd );
+   stage_ps = astFree( stage_ps );
+}
+
+static void JacobianSeries( AstPointSet *in, int forward, int nmap,
+                            AstMapping **map_list, const int *invert_list,
+                            AstPointSet *jac, int *status ) {
+/*
+*  Name:
+*     JacobianSeries
+
+*  Purpose:
+*     Find the Jacobian of a list of Mappings applied in series.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "cmpmap.h"
+*     void JacobianSeries( AstPointSet *in, int forward, int nmap,
+*                          AstMapping **map_list, const int *invert_list,
+*                          AstPointSet *jac, int *status )
+
+*  Class Membership:
+*     CmpMap member function.
+
+*  Description:
+*     This function finds the Jacobian matrix at a set of points of the
+*     transformation formed by applying a list of Mappings in series.
+*     The Jacobian of each Mapping is found at the positions produced by
+*     the preceding Mappings, and is combined with the Jacobian of the
+*     preceding Mappings using the chain rule. An element of the result
+*     is bad if any of the elements used to form it are bad.
+
+*  Parameters:
+*     in
+*        Pointer to the PointSet holding the positions at which the
+*        Jacobian is required.
+*     forward
+*        A non-zero value indicates that the Mappings are to be applied
+*        in the forward direction. A zero value indicates that they are
+*        to be applied in the inverse direction (i.e. in reverse order).
+*     nmap
+*        The number of Mappings in the list.
+*     map_list
+*        Array of pointers to the Mappings (as returned by astMapList).
+*     invert_list
+*        Array holding the Invert value to use with each Mapping (as
+*        returned by astMapList).
+*     jac
+*        Pointer to the PointSet in which to store the Jacobian.
+*     status
+*        Pointer to the inherited status variable.
+*/
+
+/* Local Variables: */
+   AstMapping *stage_map;        /* Mapping being applied */
+   AstPointSet *cur;             /* Positions produced by previous Mappings */
+   AstPointSet *jac_k;           /* Jacobian of current Mapping */
+   AstPointSet *jac_prev;        /* Jacobian of previous Mappings */
+   AstPointSet *next;            /* Positions produced by current Mapping */
+   AstPointSet *prod;            /* Jacobian of Mappings so far */
+   double **ptr_k;               /* Pointers to jac_k values */
+   double **ptr_prev;            /* Pointers to jac_prev values */
+   double **ptr_prod;            /* Pointers to prod values */
+   double ja;                    /* Element of previous Jacobian */
+   double jb;                    /* Element of current Jacobian */
+   double sum;                   /* Sum of products */
+   int i;                        /* Output coordinate index */
+   int imap;                     /* Index of Mapping in series */
+   int j;                        /* Input coordinate index */
+   int jmap;                     /* Index of Mapping in map_list */
+   int k;                        /* Intermediate coordinate index */
+   int nin;                      /* Number of input coordinates */
+   int nmid;                     /* Number of intermediate coordinates */
+   int nout;                     /* Number of output coordinates */
+   int npoint;                   /* Number of points */
+   int point;                    /* Point index */
+   int stage_fwd;                /* Direction to use for stage_map */
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* Initialise. */
+   nin = astGetNcoord( in );
+   npoint = astGetNpoint( in );
+   cur = astClone( in );
+   jac_prev = NULL;
+
+/* Apply each Mapping in turn, in the required direction (allowing for
+   any changes in the Invert attribute of each Mapping since the list
+   was obtained, as in astTransform). */
+   for ( imap = 0; imap < nmap && astOK; imap++ ) {
+      jmap = forward ? imap : nmap - 1 - imap;
+      stage_map = map_list[ jmap ];
+      stage_fwd = ( invert_list[ jmap ] == astGetInvert( stage_map ) );
+      if ( !forward ) stage_fwd = !stage_fwd;
+
+/* Find the Jacobian of the current Mapping at the current positions.
+   If this is the only Mapping, store it directly in the returned
+   PointSet. */
+      if ( !jac_prev && imap == nmap - 1 ) {
+         (void) astJacobianPoints( stage_map, cur, stage_fwd, jac );
+         break;
+      }
+      jac_k = astJacobianPoints( stage_map, cur, stage_fwd, NULL );
+
+/* Combine it with the Jacobian of the previous Mappings. The result is
+   stored in the returned PointSet if this is the last Mapping. */
+      if ( !jac_prev ) {
+         jac_prev = jac_k;
+      } else {
+         nmid = astGetNcoord( jac_prev )/nin;
+         nout = astGetNcoord( jac_k )/nmid;
+         prod = ( imap == nmap - 1 ) ? astClone( jac ) :
+                astPointSet( npoint, nout*nin, "", status );
+         ptr_k = astGetPoints( jac_k );
+         ptr_prev = astGetPoints( jac_prev );
+         ptr_prod = astGetPoints( prod );
+         if ( astOK ) {
+            for ( i = 0; i < nout; i++ ) {
+               for ( j = 0; j < nin; j++ ) {
+                  for ( point = 0; point < npoint; point++ ) {
+                     sum = 0.0;
+                     for ( k = 0; k < nmid; k++ ) {
+                        ja = ptr_prev[ k*nin + j ][ point ];
+                        jb = ptr_k[ i*nmid + k ][ point ];
+                        if ( ja == AST__BAD || jb == AST__BAD ) {
+                           sum = AST__BAD;
+                           break;
+                        }
+                        sum += ja*jb;
+                     }
+                     ptr_prod[ i*nin + j ][ point ] = sum;
+                  }
+               }
+            }
+         }
+         jac_k = astAnnul( jac_k );
+         jac_prev = astAnnul( jac_prev );
+         jac_prev = prod;
+      }
+
+/* Transform the current positions, ready for the next Mapping. */
+      if ( imap < nmap - 1 ) {
+         next = astTransform( stage_map, cur, stage_fwd, NULL );
+         cur = astAnnul( cur );
+         cur = next;
+      }
+   }
+
+/* Free resources. */
+   if ( jac_prev ) jac_prev = astAnnul( jac_prev );
+   cur = astAnnul( cur );
+}
+
 /* Copy constructor. */
 /* ----------------- */
 static void Copy( const AstObject *objin, AstObject *objout, int *status ) {
@@ -3915,6 +4639,10 @@ static void Copy( const AstObject *objin, AstObject *objout, int *status ) {
    out->map1 = NULL;
    out->map2 = NULL;
 
+/* The compiled list of Mappings (if any) refers to the input component
+   Mappings, so it is not copied. */
+   out->plan = NULL;
+
 /* Make copies of these Mappings and store pointers to them in the output
    CmpMap structure. */
    out->map1 = astCopy( in->map1 );
@@ -3960,6 +4688,9 @@ static void Delete( AstObject *obj, int *status ) {
 /* Obtain a pointer to the CmpMap structure. */
    this = (AstCmpMap *) obj;
 
+/* Free any compiled list of Mappings. */
+   this->plan = FreePlan( this->plan, status );
+
 /* Annul the pointers to the component Mappings. */
    this->map1 = astAnnul( this->map1 );
    this->map2 = astAnnul( this->map2 );
@@ -4544,6 +5275,10 @@ AstCmpMap *astInitCmpMap_( void *mem, size_t size, int init,
    constraining this flag to be 0 or 1. */
          new->series = ( series != 0 );
 
+/* Initialise the compiled list of Mappings (this is only created by
+   astCompile). */
+         new->plan = NULL;
+
 /* If an error occurred, clean up by annulling the Mapping pointers and
    deleting the new object. */
          if ( !astOK ) {
@@ -4690,6 +5425,9 @@ AstCmpMap *astLoadCmpMap_( void *mem, size_t size,
       new->series = astReadInt( channel, "series", 1 );
       new->series = ( new->series != 0 );
 
+/* The compiled list of Mappings is not stored in a dump. */
+      new->plan = NULL;
+
 /* First Invert flag. */
 /* ------------------ */
       new->invert1 = astReadInt( channel, "inva", 0 );
@@ -44,6 +44,8 @@
 
 *  Methods Over-Ridden:
 *     Public:
+*        astCompile
+*           Prepare a CmpMap for fast repeated use.
 *        astSimplify
 *           Simplify a CmpMap.
 *
@@ -174,6 +176,7 @@ typedef struct AstCmpMap {
    char invert1;                  /* Inversion flag for first Mapping */
    char invert2;                  /* Inversion flag for second Mapping */
    char series;                   /* Connect in series (else in parallel)? */
+   struct AstCmpMapPlan *plan;    /* Compiled list of series Mappings (or NULL) */
 } AstCmpMap;
 
 /* Virtual function table. */
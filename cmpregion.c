@@ -177,9 +177,7 @@ static void (*parent_regclearattrib)( AstRegion *, const char *, char **, int *
 static void (* parent_resetcache)( AstRegion *, int * );
 static int (* parent_getobjsize)( AstObject *, int * );
 
-#if defined(THREAD_SAFE)
 static int (* parent_managelock)( AstObject *, int, int, AstObject **, int * );
-#endif
 
 
 #ifdef THREAD_SAFE
@@ -249,9 +247,7 @@ static void SetMeshSize( AstRegion *, int, int * );
 static void SetRegFS( AstRegion *, AstFrame *, int * );
 static void XORCheck( AstCmpRegion *, int * );
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *, int, int, AstObject **, int * );
-#endif
 
 
 /* Member functions. */
@@ -1256,10 +1252,8 @@ void astInitCmpRegionVtab_(  AstCmpRegionVtab *vtab, const char *name, int *stat
    parent_getobjsize = object->GetObjSize;
    object->GetObjSize = GetObjSize;
 
-#if defined(THREAD_SAFE)
    parent_managelock = object->ManageLock;
    object->ManageLock = ManageLock;
-#endif
 
    parent_clearclosed = region->ClearClosed;
    region->ClearClosed = ClearClosed;
@@ -1308,7 +1302,6 @@ void astInitCmpRegionVtab_(  AstCmpRegionVtab *vtab, const char *name, int *stat
    }
 }
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *this_object, int mode, int extra,
                        AstObject **fail, int *status ) {
 /*
@@ -1401,7 +1394,6 @@ static int ManageLock( AstObject *this_object, int mode, int extra,
    return result;
 
 }
-#endif
 
 static AstRegion *MatchRegion( AstRegion *this, int ifrm, AstRegion *that,
                                const char *method, int *status ) {
@@ -1457,6 +1449,7 @@ static AstRegion *MatchRegion( AstRegion *this, int ifrm, AstRegion *that,
    AstFrame *frm;             /* Current Frame from "fs" */
    AstFrameSet *fs;           /* FrameSet connecting that to this */
    AstMapping *map;           /* Base->Current Mapping from "fs" */
+   AstRegion *reg;            /* Region to use in place of "this" */
    AstRegion *result;         /* Returned pointer */
 
 /* Initialise */
@@ -1467,14 +1460,18 @@ static AstRegion *MatchRegion( AstRegion *this, int ifrm, AstRegion *that,
    if ( !astOK || !this || !that ) return result;
 
 /* Temporarily invert "this" if we are matching its base Frame (since the
-   astConvert method matches current Frames). */
-   if( ifrm == AST__BASE ) astInvert( this );
+   astConvert method matches current Frames). A frozen Region may be in
+   use by other threads, so invert a copy of it instead. */
+   reg = (AstRegion *) astCopyIfFrozen( this, ( ifrm == AST__BASE ) !=
+                                              astGetInvert( this ) );
+   if( ifrm == AST__BASE ) astInvert( reg );
 
 /* Find a FrameSet connecting the current Frames of the two Regions */
-   fs = astConvert( that, this, "" );
+   fs = astConvert( that, reg, "" );
 
 /* Re-instate the original Frame indices in "this" if required. */
-   if( ifrm == AST__BASE ) astInvert( this );
+   if( ifrm == AST__BASE ) astInvert( reg );
+   reg = astAnnul( reg );
 
 /* Check a conversion path was found. */
    if( fs ) {
@@ -1505,9 +1505,7 @@ static void (* parent_clearattrib)( AstObject *, const char *, int * );
 static void (* parent_setattrib)( AstObject *, const char *, int * );
 static int (* parent_write)( AstChannel *, AstObject *, int * );
 static AstObject *(* parent_read)( AstChannel *, int * );
-#if defined(THREAD_SAFE)
 static int (* parent_managelock)( AstObject *, int, int, AstObject **, int * );
-#endif
 
 /* Strings to describe each data type. These should be in the order implied
    by the corresponding macros (eg AST__FLOAT, etc). */
@@ -1993,9 +1991,7 @@ static void SetTableSource( AstFitsChan *,
                                       AstFitsChan *, const char *, int, int, int * ), int * );
 static void TabSourceWrap( void (*)( void ),
                            AstFitsChan *, const char *, int, int, int * );
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *, int, int, AstObject **, int * );
-#endif
 
 /* Member functions. */
 /* ================= */
@@ -17822,10 +17818,8 @@ void astInitFitsChanVtab_(  AstFitsChanVtab *vtab, const char *name, int *status
    channel = (AstChannelVtab *) vtab;
    parent_getobjsize = object->GetObjSize;
    object->GetObjSize = GetObjSize;
-#if defined(THREAD_SAFE)
    parent_managelock = object->ManageLock;
    object->ManageLock = ManageLock;
-#endif
    parent_clearattrib = object->ClearAttrib;
    object->ClearAttrib = ClearAttrib;
    parent_getattrib = object->GetAttrib;
@@ -21523,7 +21517,6 @@ static void MakeInvertable( double **fullmat, int n, double *dim, int *status ){
       if( unused && dim[ i ] == 1.0 ) fullmat[ i ][ i ] = 1.0;
    }
 }
-#if defined(THREAD_SAFE)
 
 static int ManageLock( AstObject *this_object, int mode, int extra,
                        AstObject **fail, int *status ) {
@@ -21617,7 +21610,6 @@ static int ManageLock( AstObject *this_object, int mode, int extra,
    if( !result ) result = astManageLock( this->keywords, mode, extra, fail );
    return result;
 }
-#endif
 
 static int Match( const char *test, const char *temp, int maxfld, int *fields,
                   int *nfld, const char *method, const char *class, int *status ){
@@ -133,9 +133,7 @@ static int (* parent_equal)( AstObject *, AstObject *, int * );
 static int (* parent_getobjsize)( AstObject *, int * );
 static void (* parent_addcolumn)( AstTable *, const char *, int, int, int *, const char *, int * );
 
-#if defined(THREAD_SAFE)
 static int (* parent_managelock)( AstObject *, int, int, AstObject **, int * );
-#endif
 
 
 /* Define macros for accessing each item of thread specific global data. */
@@ -191,9 +189,7 @@ static void PutColumnData( AstFitsTable *, const char *, int, size_t, void *, in
 static void PutTableHeader( AstFitsTable *, AstFitsChan *, int * );
 static void UpdateHeader( AstFitsTable *, const char *, int * );
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *, int, int, AstObject **, int * );
-#endif
 
 /* Member functions. */
 /* ================= */
@@ -1624,10 +1620,8 @@ void astInitFitsTableVtab_(  AstFitsTableVtab *vtab, const char *name, int *stat
    parent_getobjsize = object->GetObjSize;
    object->GetObjSize = GetObjSize;
 
-#if defined(THREAD_SAFE)
    parent_managelock = object->ManageLock;
    object->ManageLock = ManageLock;
-#endif
 
    parent_addcolumn = table->AddColumn;
    table->AddColumn = AddColumn;
@@ -1722,7 +1716,6 @@ static char *MakeKey( const char *column, int irow, char *buf, int len,
    return result;
 }
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *this_object, int mode, int extra,
                        AstObject **fail, int *status ) {
 /*
@@ -1814,7 +1807,6 @@ static int ManageLock( AstObject *this_object, int mode, int extra,
    return result;
 
 }
-#endif
 
 static void PurgeHeader( AstFitsTable *this, int *status ) {
 /*
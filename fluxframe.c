@@ -163,9 +163,7 @@ static void (* parent_setsystem)( AstFrame *, AstSystemType, int * );
 static void (* parent_clearsystem)( AstFrame *, int * );
 static void (* parent_clearunit)( AstFrame *, int, int * );
 
-#if defined(THREAD_SAFE)
 static int (* parent_managelock)( AstObject *, int, int, AstObject **, int * );
-#endif
 
 /* Define macros for accessing each item of thread specific global data. */
 #ifdef THREAD_SAFE
@@ -256,9 +254,7 @@ static int TestSpecVal( AstFluxFrame *, int * );
 static void ClearSpecVal( AstFluxFrame *, int * );
 static void SetSpecVal( AstFluxFrame *, double, int * );
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *, int, int, AstObject **, int * );
-#endif
 
 /* Member functions. */
 /* ================= */
@@ -1806,10 +1802,8 @@ void astInitFluxFrameVtab_(  AstFluxFrameVtab *vtab, const char *name, int *stat
    parent_testattrib = object->TestAttrib;
    object->TestAttrib = TestAttrib;
 
-#if defined(THREAD_SAFE)
    parent_managelock = object->ManageLock;
    object->ManageLock = ManageLock;
-#endif
 
    parent_getdomain = frame->GetDomain;
    frame->GetDomain = GetDomain;
@@ -1874,7 +1868,6 @@ void astInitFluxFrameVtab_(  AstFluxFrameVtab *vtab, const char *name, int *stat
    }
 }
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *this_object, int mode, int extra,
                        AstObject **fail, int *status ) {
 /*
@@ -1966,7 +1959,6 @@ static int ManageLock( AstObject *this_object, int mode, int extra,
    return result;
 
 }
-#endif
 
 static int MakeFluxMapping( AstFluxFrame *target, AstFluxFrame *result,
                             AstSystemType align_sys, AstMapping **map, int *status ) {
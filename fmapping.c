@@ -14,9 +14,12 @@
 *     a public FORTRAN 77 interface to the Mapping class.
 
 *  Routines Defined:
+*     AST_CHEBYAPPROX
+*     AST_COMPILE
 *     AST_DECOMPOSE
 *     AST_INVERT
 *     AST_ISAMAPPING
+*     AST_JACOBIAN
 *     AST_LINEARMAPPING
 *     AST_REBIN<X>
 *     AST_REBINSEQ<X>
@@ -29,6 +32,7 @@
 *     AST_TRAN1
 *     AST_TRAN2
 *     AST_TRANGRID
+*     AST_TRANGRIDF
 *     AST_TRANN
 *     AST_RATE
 
@@ -213,6 +217,43 @@ static void ast_resample_ukern1( double offset, const double params[],
 /* ============================ */
 /* These functions implement the remainder of the FORTRAN interface. */
 
+F77_INTEGER_FUNCTION(ast_chebyapprox)( INTEGER(THIS),
+                                       DOUBLE_ARRAY(LBND),
+                                       DOUBLE_ARRAY(UBND),
+                                       DOUBLE(ACC),
+                                       INTEGER(MAXORDER),
+                                       INTEGER(MAXTILE),
+                                       DOUBLE(FITACC),
+                                       INTEGER(STATUS) ) {
+   GENPTR_INTEGER(THIS)
+   GENPTR_DOUBLE_ARRAY(LBND)
+   GENPTR_DOUBLE_ARRAY(UBND)
+   GENPTR_DOUBLE(ACC)
+   GENPTR_INTEGER(MAXORDER)
+   GENPTR_INTEGER(MAXTILE)
+   GENPTR_DOUBLE(FITACC)
+   F77_INTEGER_TYPE(RESULT);
+
+   astAt( "AST_CHEBYAPPROX", NULL, 0 );
+   astWatchSTATUS(
+      RESULT = astP2I( astChebyApprox( astI2P( *THIS ), LBND, UBND, *ACC,
+                                       *MAXORDER, *MAXTILE, FITACC ) );
+   )
+   return RESULT;
+}
+
+F77_INTEGER_FUNCTION(ast_compile)( INTEGER(THIS),
+                                   INTEGER(STATUS) ) {
+   GENPTR_INTEGER(THIS)
+   F77_INTEGER_TYPE(RESULT);
+
+   astAt( "AST_COMPILE", NULL, 0 );
+   astWatchSTATUS(
+      RESULT = astP2I( astCompile( astI2P( *THIS ) ) );
+   )
+   return RESULT;
+}
+
 F77_SUBROUTINE(ast_decompose)( INTEGER(THIS),
                                INTEGER(MAP1),
                                INTEGER(MAP2),
@@ -249,6 +290,31 @@ F77_SUBROUTINE(ast_invert)( INTEGER(THIS),
    )
 }
 
+F77_SUBROUTINE(ast_jacobian)( INTEGER(THIS),
+                              INTEGER(NPOINT),
+                              INTEGER(NCOORD_IN),
+                              INTEGER(INDIM),
+                              DOUBLE_ARRAY(IN),
+                              LOGICAL(FORWARD),
+                              INTEGER(JACDIM),
+                              DOUBLE_ARRAY(JAC),
+                              INTEGER(STATUS) ) {
+   GENPTR_INTEGER(THIS)
+   GENPTR_INTEGER(NPOINT)
+   GENPTR_INTEGER(NCOORD_IN)
+   GENPTR_INTEGER(INDIM)
+   GENPTR_DOUBLE_ARRAY(IN)
+   GENPTR_LOGICAL(FORWARD)
+   GENPTR_INTEGER(JACDIM)
+   GENPTR_DOUBLE_ARRAY(JAC)
+
+   astAt( "AST_JACOBIAN", NULL, 0 );
+   astWatchSTATUS(
+      astJacobian( astI2P( *THIS ), *NPOINT, *NCOORD_IN, *INDIM,
+                   (const double *)IN, F77_ISTRUE( *FORWARD ), *JACDIM, JAC );
+   )
+}
+
 F77_LOGICAL_FUNCTION(ast_isamapping)( INTEGER(THIS),
                                       INTEGER(STATUS) ) {
    GENPTR_INTEGER(THIS)
@@ -702,6 +768,38 @@ F77_SUBROUTINE(ast_trangrid)( INTEGER(THIS),
    )
 }
 
+F77_SUBROUTINE(ast_trangridf)( INTEGER(THIS),
+                               INTEGER(NCOORD_IN),
+                               INTEGER_ARRAY(LBND),
+                               INTEGER_ARRAY(UBND),
+                               DOUBLE(TOL),
+                               INTEGER(MAXPIX),
+                               LOGICAL(FORWARD),
+                               INTEGER(NCOORD_OUT),
+                               INTEGER(OUTDIM),
+                               REAL_ARRAY(OUT),
+                               REAL(BADVAL),
+                               INTEGER(STATUS) ) {
+   GENPTR_INTEGER(THIS)
+   GENPTR_INTEGER(NCOORD_IN)
+   GENPTR_INTEGER_ARRAY(LBND)
+   GENPTR_INTEGER_ARRAY(UBND)
+   GENPTR_DOUBLE(TOL)
+   GENPTR_INTEGER(MAXPIX)
+   GENPTR_LOGICAL(FORWARD)
+   GENPTR_INTEGER(NCOORD_OUT)
+   GENPTR_INTEGER(OUTDIM)
+   GENPTR_REAL_ARRAY(OUT)
+   GENPTR_REAL(BADVAL)
+
+   astAt( "AST_TRANGRIDF", NULL, 0 );
+   astWatchSTATUS(
+      astTranGridF( astI2P( *THIS ), *NCOORD_IN, LBND, UBND, *TOL, *MAXPIX,
+                    F77_ISTRUE( *FORWARD ), *NCOORD_OUT, *OUTDIM, OUT,
+                    *BADVAL );
+   )
+}
+
 F77_SUBROUTINE(ast_trann)( INTEGER(THIS),
                            INTEGER(NPOINT),
                            INTEGER(NCOORD_IN),
@@ -78,6 +78,7 @@ c     - astConvert: Determine how to convert between two coordinate systems
 c     - astDistance: Calculate the distance between two points in a Frame
 c     - astFindFrame: Find a coordinate system with specified characteristics
 c     - astFormat: Format a coordinate value for a Frame axis
+c     - astFormatArray: Format an array of coordinate values for a Frame axis
 c     - astGetActiveUnit: Determines how the Unit attribute will be used
 c     - astIntersect: Find the intersection between two geodesic curves
 c     - astMatchAxes: Find any corresponding axes in two Frames
@@ -89,6 +90,7 @@ c     - astPickAxes: Create a new Frame by picking axes from an existing one
 c     - astResolve: Resolve a vector into two orthogonal components
 c     - astSetActiveUnit: Specify how the Unit attribute should be used
 c     - astUnformat: Read a formatted coordinate value for a Frame axis
+c     - astUnformatArray: Read an array of formatted values for a Frame axis
 f     - AST_ANGLE: Find the angle subtended by two points at a third point
 f     - AST_AXANGLE: Find the angle from an axis, to a line through two points
 f     - AST_AXDISTANCE: Calculate the distance between two axis values
@@ -736,9 +738,7 @@ static void (* parent_setattrib)( AstObject *, const char *, int * );
 static void (* parent_cleanattribs)( AstObject *, int * );
 static int (* parent_getobjsize)( AstObject *, int * );
 
-#if defined(THREAD_SAFE)
 static int (* parent_managelock)( AstObject *, int, int, AstObject **, int * );
-#endif
 
 /* Define a variable to hold a SkyFrame which will be used for formatting
    and unformatting ObsLat and ObsLon values. */
@@ -827,6 +827,7 @@ static AstPointSet *Transform( AstMapping *, AstPointSet *, int, AstPointSet *,
 static char *CleanDomain( char *, int * );
 static const char *Abbrev( AstFrame *, int, const char *, const char *, const char *, int * );
 static const char *Format( AstFrame *, int, double, int * );
+static void FormatArray( AstFrame *, int, int, const double *, int, char *, int * );
 static const char *GetAttrib( AstObject *, const char *, int * );
 static const char *GetDefaultLabel( int, int * );
 static const char *GetDefaultSymbol( AstFrame *, int, int * );
@@ -952,6 +953,7 @@ static int TestTitle( AstFrame *, int * );
 static int TestUnit( AstFrame *, int, int * );
 static int IsUnitFrame( AstFrame *, int * );
 static int Unformat( AstFrame *, int, const char *, double *, int * );
+static int UnformatArray( AstFrame *, int, int, const char *const [], double *, int * );
 static int ValidateAxis( AstFrame *, int, int, const char *, int * );
 static AstSystemType ValidateSystem( AstFrame *, AstSystemType, const char *, int * );
 static AstSystemType SystemCode( AstFrame *, const char *, int * );
@@ -1003,9 +1005,7 @@ static void SetUnit( AstFrame *, int, const char *, int * );
 static void NewUnit( AstAxis *, const char *, const char *, const char *, const char *, int * );
 static void ValidateAxisSelection( AstFrame *, int, const int *, const char *, int * );
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *, int, int, AstObject **, int * );
-#endif
 
 /* Member functions. */
 /* ================= */
@@ -4342,6 +4342,92 @@ static const char *Format( AstFrame *this, int axis, double value, int *status )
    return result;
 }
 
+static void FormatArray( AstFrame *this, int axis, int npoint,
+                         const double *value, int len, char *buf,
+                         int *status ) {
+/*
+*+
+*  Name:
+*     astFormatArray
+
+*  Purpose:
+*     Format an array of coordinate values for a Frame axis.
+
+*  Type:
+*     Protected virtual function.
+
+*  Synopsis:
+*     #include "frame.h"
+*     void astFormatArray( AstFrame *this, int axis, int npoint,
+*                          const double *value, int len, char *buf )
+
+*  Class Membership:
+*     Frame method.
+
+*  Description:
+*     This function formats an array of coordinate values for a Frame
+*     axis, storing the resulting strings in a buffer supplied by the
+*     caller. Each string is identical to that which astFormat would
+*     return for the corresponding value, but the Frame's attributes
+*     are examined only once, rather than once for each value.
+
+*  Parameters:
+*     this
+*        Pointer to the Frame.
+*     axis
+*        The number of the Frame axis for which formatting is to be
+*        performed (axis numbering starts at zero for the first axis).
+*     npoint
+*        The number of values to be formatted.
+*     value
+*        Pointer to an array of "npoint" coordinate values.
+*     len
+*        The number of characters reserved in "buf" for each formatted
+*        value, including the terminating null. Longer strings are
+*        truncated to "len-1" characters.
+*     buf
+*        Pointer to a buffer of at least "npoint*len" characters. The
+*        formatted version of "value[i]" is returned as a null-terminated
+*        string starting at "buf[i*len]".
+
+*  Notes:
+*     - Classes which over-ride the astFormat method should also
+*     over-ride this method.
+*-
+
+*  Implementation Notes:
+*     - This function implements the basic astFormatArray method
+*     available via the protected interface to the Frame class. The
+*     public interface to this method is provided by the
+*     astFormatArrayId_ function.
+*/
+
+/* Local Variables: */
+   AstAxis *ax;                  /* Pointer to Axis object */
+   int digits_set;               /* Axis Digits attribute set? */
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* Validate the axis index and obtain a pointer to the required Axis. */
+   (void) astValidateAxis( this, axis, 1, "astFormatArray" );
+   ax = astGetAxis( this, axis );
+
+/* Over-ride the Axis Digits attribute if it has not been set, as in the
+   Format function, but only once for the whole array. */
+   digits_set = astTestAxisDigits( ax );
+   if ( !digits_set ) astSetAxisDigits( ax, astGetDigits( this ) );
+
+/* Format the values. */
+   astAxisFormatArray( ax, npoint, value, len, buf );
+
+/* Clear any Axis attributes that were temporarily over-ridden. */
+   if ( !digits_set ) astClearAxisDigits( ax );
+
+/* Annul the Axis pointer. */
+   ax = astAnnul( ax );
+}
+
 static AstPointSet *FrameGrid( AstFrame *this, int size, const double *lbnd,
                                const double *ubnd, int *status ){
 /*
@@ -6039,6 +6125,7 @@ void astInitFrameVtab_(  AstFrameVtab *vtab, const char *name, int *status ) {
    vtab->MatchAxes = MatchAxes;
    vtab->MatchAxesX = MatchAxesX;
    vtab->Format = Format;
+   vtab->FormatArray = FormatArray;
    vtab->Centre = Centre;
    vtab->Gap = Gap;
    vtab->GetAxis = GetAxis;
@@ -6111,6 +6198,7 @@ void astInitFrameVtab_(  AstFrameVtab *vtab, const char *name, int *status ) {
    vtab->TestTitle = TestTitle;
    vtab->TestUnit = TestUnit;
    vtab->Unformat = Unformat;
+   vtab->UnformatArray = UnformatArray;
    vtab->ValidateAxis = ValidateAxis;
    vtab->ValidateAxisSelection = ValidateAxisSelection;
    vtab->ValidateSystem = ValidateSystem;
@@ -6195,10 +6283,8 @@ void astInitFrameVtab_(  AstFrameVtab *vtab, const char *name, int *status ) {
    parent_cleanattribs = object->CleanAttribs;
    object->CleanAttribs = CleanAttribs;
 
-#if defined(THREAD_SAFE)
    parent_managelock = object->ManageLock;
    object->ManageLock = ManageLock;
-#endif
 
 /* Store replacement pointers for methods which will be over-ridden by
    new member functions implemented here. */
@@ -6867,7 +6953,6 @@ static void LineOffset( AstFrame *this, AstLineDef *line, double par,
    }
 }
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *this_object, int mode, int extra,
                        AstObject **fail, int *status ) {
 /*
@@ -6965,7 +7050,6 @@ static int ManageLock( AstObject *this_object, int mode, int extra,
    return result;
 
 }
-#endif
 
 static int *MapSplit( AstMapping *this_map, int nin, const int *in, AstMapping **map, int *status ){
 /*
@@ -11525,6 +11609,123 @@ static int Unformat( AstFrame *this, int axis, const char *string,
    return nc;
 }
 
+static int UnformatArray( AstFrame *this, int axis, int npoint,
+                          const char *const strings[], double *value,
+                          int *status ) {
+/*
+*+
+*  Name:
+*     astUnformatArray
+
+*  Purpose:
+*     Read an array of formatted coordinate values for a Frame axis.
+
+*  Type:
+*     Protected virtual function.
+
+*  Synopsis:
+*     #include "frame.h"
+*     int astUnformatArray( AstFrame *this, int axis, int npoint,
+*                           const char *const strings[], double *value )
+
+*  Class Membership:
+*     Frame method.
+
+*  Description:
+*     This function reads an array of formatted coordinate values for a
+*     Frame axis (supplied as strings) and returns the equivalent
+*     numerical values. Each string is interpreted as by astUnformat,
+*     but the Frame's attributes are examined only once, rather than
+*     once for each string.
+
+*  Parameters:
+*     this
+*        Pointer to the Frame.
+*     axis
+*        The number of the Frame axis for which the coordinate values
+*        are to be read (axis numbering starts at zero for the first
+*        axis).
+*     npoint
+*        The number of strings to be read.
+*     strings
+*        An array of "npoint" pointers to null-terminated strings, each
+*        holding a formatted coordinate value.
+*     value
+*        Pointer to an array in which to return the "npoint" coordinate
+*        values read.
+
+*  Returned Value:
+*     The number of strings that were read successfully. A string is
+*     read successfully only if all its characters are used in forming
+*     the coordinate value (leading and trailing white space is
+*     ignored). AST__BAD is returned in "value" for any other string.
+
+*  Notes:
+*     - Classes which over-ride the astUnformat method should also
+*     over-ride this method.
+*     - A value of zero will be returned if this function is invoked
+*     with the global error status set, or if it should fail for any
+*     reason.
+*-
+
+*  Implementation Notes:
+*     - This function implements the basic astUnformatArray method
+*     available via the protected interface to the Frame class. The
+*     public interface to this method is provided by the
+*     astUnformatArrayId_ function.
+*/
+
+/* Local Variables: */
+   AstAxis *ax;                  /* Pointer to Axis object */
+   const char *label;            /* Pointer to axis label string */
+   int digits_set;               /* Axis Digits attribute set? */
+   int result;                   /* Number of strings read */
+   int status_value;             /* AST error status */
+
+/* Initialise. */
+   result = 0;
+
+/* Check the global error status. */
+   if ( !astOK ) return result;
+
+/* Validate the axis index and obtain a pointer to the required Axis. */
+   (void) astValidateAxis( this, axis, 1, "astUnformatArray" );
+   ax = astGetAxis( this, axis );
+
+/* Over-ride the Axis Digits attribute if it has not been set, as in the
+   Unformat function, but only once for the whole array. */
+   digits_set = astTestAxisDigits( ax );
+   if ( !digits_set ) astSetAxisDigits( ax, astGetDigits( this ) );
+
+/* Read the coordinate values. */
+   if ( astOK ) {
+      result = astAxisUnformatArray( ax, npoint, strings, value );
+
+/* If an error occurred, report a contextual error message containing
+   the axis label. */
+      if ( !astOK ) {
+         status_value = astStatus;
+         astClearStatus;
+         label = astGetLabel( this, axis );
+         astSetStatus( status_value );
+         astError( status_value, "%s(%s): Unable to read \"%s\" values.", status,
+                   "astUnformatArray", astGetClass( this ), label );
+      }
+   }
+
+/* Clear any Axis attributes that were temporarily over-ridden. */
+   if ( !digits_set ) astClearAxisDigits( ax );
+
+/* Annul the Axis pointer. */
+   ax = astAnnul( ax );
+
+/* Return zero if an error occurred. */
+   if ( !astOK ) result = 0;
+
+/* Return the result. */
+   return result;
+}
+
 static int ValidateAxis( AstFrame *this, int axis, int fwd, const char *method,
                          int *status ) {
 /*
@@ -15017,6 +15218,11 @@ const char *astFormat_( AstFrame *this, int axis, double value, int *status ) {
    if ( !astOK ) return NULL;
    return (**astMEMBER(this,Frame,Format))( this, axis, value, status );
 }
+void astFormatArray_( AstFrame *this, int axis, int npoint, const double *value,
+                      int len, char *buf, int *status ) {
+   if ( !astOK ) return;
+   (**astMEMBER(this,Frame,FormatArray))( this, axis, npoint, value, len, buf, status );
+}
 double astCentre_( AstFrame *this, int axis, double value, double gap, int *status ) {
    if ( !astOK ) return 0.0;
    return (**astMEMBER(this,Frame,Centre))( this, axis, value, gap, status );
@@ -15157,6 +15363,7 @@ void astOverlay_( AstFrame *template, const int *template_axes,
 }
 void astPermAxes_( AstFrame *this, const int perm[], int *status ) {
    if ( !astOK ) return;
+   if ( astCheckFrozen( this, "astPermAxes" ) ) return;
    (**astMEMBER(this,Frame,PermAxes))( this, perm, status );
 }
 AstFrame *astPickAxes_( AstFrame *this, int naxes, const int axes[],
@@ -15200,6 +15407,11 @@ int astUnformat_( AstFrame *this, int axis, const char *string,
    if ( !astOK ) return 0;
    return (**astMEMBER(this,Frame,Unformat))( this, axis, string, value, status );
 }
+int astUnformatArray_( AstFrame *this, int axis, int npoint,
+                       const char *const strings[], double *value, int *status ) {
+   if ( !astOK ) return 0;
+   return (**astMEMBER(this,Frame,UnformatArray))( this, axis, npoint, strings, value, status );
+}
 int astValidateAxis_( AstFrame *this, int axis, int fwd, const char *method, int *status ) {
    if ( !astOK ) return 0;
    return (**astMEMBER(this,Frame,ValidateAxis))( this, axis, fwd, method, status );
@@ -15253,7 +15465,9 @@ void astSetFrameFlags_( AstFrame *this, int value, int *status ) {
 AstFrame *PickAxesId_( AstFrame *, int, const int[], AstMapping **, int * );
 AstFrame *astFrameId_( int, const char *, ... );
 const char *astFormatId_( AstFrame *, int, double, int * );
+int astUnformatArrayId_( AstFrame *, int, int, const char *const [], double *, int * );
 int astUnformatId_( AstFrame *, int, const char *, double *, int * );
+void astFormatArrayId_( AstFrame *, int, int, const double *, int, char *, int * );
 void astPermAxesId_( AstFrame *, const int[], int * );
 
 /* Special interface function implementations. */
@@ -15392,6 +15606,100 @@ f     reason.
 
 }
 
+void astFormatArrayId_( AstFrame *this, int axis, int npoint,
+                        const double *value, int len, char *buf,
+                        int *status ) {
+/*
+*++
+*  Name:
+c     astFormatArray
+
+*  Purpose:
+*     Format an array of coordinate values for a Frame axis.
+
+*  Type:
+*     Public virtual function.
+
+*  Synopsis:
+c     #include "frame.h"
+c     void astFormatArray( AstFrame *this, int axis, int npoint,
+c                          const double *value, int len, char *buf )
+
+*  Class Membership:
+*     Frame method.
+
+*  Description:
+*     This function formats an array of coordinate values for a Frame
+*     axis, storing the resulting strings in a buffer supplied by the
+*     caller. Each string is identical to that which astFormat would
+*     return for the corresponding value.
+*
+*     The Frame's attributes (including any Format string associated
+*     with the axis) are examined and parsed only once, so this
+*     function is much faster than calling astFormat once for each
+*     value when many values are to be formatted, such as when writing
+*     a catalogue.
+
+*  Parameters:
+c     this
+*        Pointer to the Frame.
+c     axis
+*        The number of the Frame axis for which formatting is to be
+*        performed (axis numbering starts at 1 for the first axis).
+c     npoint
+*        The number of values to be formatted.
+c     value
+*        Pointer to an array of "npoint" coordinate values.
+c     len
+*        The number of characters reserved in "buf" for each formatted
+*        value, including the terminating null character. Formatted
+*        values that are too long are truncated to "len-1" characters.
+c     buf
+*        Pointer to a buffer of at least "npoint*len" characters. On
+*        exit, the formatted version of "value[i]" is held as a
+*        null-terminated string starting at "buf[i*len]".
+
+*  Applicability:
+*     Frame
+*        This function applies to all Frames.
+*     FrameSet
+*        The formatting applied is determined by the FrameSet's current
+*        Frame (as specified by the Current attribute).
+
+*  Notes:
+*     - This function is only available through the C interface.
+*     - The contents of "buf" are undefined if this function is invoked
+*     with the AST error status set, or if it should fail for any
+*     reason.
+*--
+
+*  Implementation Notes:
+*     This function implements the public interface for the
+*     astFormatArray method. It is identical to astFormatArray_ except
+*     that the axis index is decremented by 1 before use, and that the
+*     number of points and the string length are validated.
+*/
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* Validate the number of points and the string length. */
+   if ( npoint < 0 ) {
+      astError( AST__NPTIN, "astFormatArray(%s): Number of values to be "
+                "formatted (%d) is invalid.", status, astGetClass( this ),
+                npoint );
+   } else if ( len < 1 ) {
+      astError( AST__NCHIN, "astFormatArray(%s): Number of characters "
+                "for each formatted value (%d) is invalid.", status,
+                astGetClass( this ), len );
+
+/* Invoke the normal astFormatArray_ function, adjusting the axis index to
+   become zero-based. */
+   } else {
+      astFormatArray( this, axis - 1, npoint, value, len, buf );
+   }
+}
+
 AstFrame *astFrameId_( int naxes, const char *options, ... ) {
 /*
 *++
@@ -16053,6 +16361,104 @@ f     for any reason.
    return astUnformat( this, axis - 1, string, value );
 }
 
+int astUnformatArrayId_( AstFrame *this, int axis, int npoint,
+                         const char *const strings[], double *value,
+                         int *status ) {
+/*
+*++
+*  Name:
+c     astUnformatArray
+
+*  Purpose:
+*     Read an array of formatted coordinate values for a Frame axis.
+
+*  Type:
+*     Public virtual function.
+
+*  Synopsis:
+c     #include "frame.h"
+c     int astUnformatArray( AstFrame *this, int axis, int npoint,
+c                           const char *const strings[], double *value )
+
+*  Class Membership:
+*     Frame method.
+
+*  Description:
+*     This function reads an array of formatted coordinate values
+*     (given as character strings) for a Frame axis and returns the
+*     equivalent numerical values. Each string is interpreted in the
+*     same way as by astUnformat.
+*
+*     The Frame's attributes (including any Format string associated
+*     with the axis) are examined and parsed only once, so this
+*     function is much faster than calling astUnformat once for each
+*     string when many values are to be read, such as when reading a
+*     catalogue.
+
+*  Parameters:
+c     this
+*        Pointer to the Frame.
+c     axis
+*        The number of the Frame axis for which the coordinate values
+*        are to be read (axis numbering starts at 1 for the first axis).
+c     npoint
+*        The number of strings to be read.
+c     strings
+*        An array of "npoint" pointers to null-terminated strings, each
+*        containing a formatted coordinate value.
+c     value
+*        Pointer to an array in which the "npoint" coordinate values
+*        read will be returned.
+
+*  Returned Value:
+c     astUnformatArray()
+*        The number of strings that were read successfully. A string is
+*        only read successfully if all its characters are used in
+*        forming the coordinate value (leading and trailing white space
+*        is ignored). The value AST__BAD is returned for any string that
+*        is not read successfully.
+
+*  Applicability:
+*     Frame
+*        This function applies to all Frames.
+*     FrameSet
+*        The input formats accepted by a FrameSet are determined by
+*        its current Frame (as specified by the Current attribute).
+
+*  Notes:
+*     - This function is only available through the C interface.
+*     - Unlike astUnformat, a string containing additional text after
+*     the coordinate value is not read successfully.
+*     - The string "<bad>" is read successfully, and generates the value
+*     AST__BAD.
+*     - A value of zero will be returned if this function is invoked
+*     with the AST error status set, or if it should fail for any
+*     reason.
+*--
+
+*  Implementation Notes:
+*     This function implements the public interface for the
+*     astUnformatArray method. It is identical to astUnformatArray_
+*     except that the axis index is decremented by 1 before use, and
+*     that the number of points is validated.
+*/
+
+/* Check the global error status. */
+   if ( !astOK ) return 0;
+
+/* Validate the number of points. */
+   if ( npoint < 0 ) {
+      astError( AST__NPTIN, "astUnformatArray(%s): Number of values to be "
+                "read (%d) is invalid.", status, astGetClass( this ),
+                npoint );
+      return 0;
+   }
+
+/* Invoke the normal astUnformatArray_ function, adjusting the axis index
+   to become zero-based. */
+   return astUnformatArray( this, axis - 1, npoint, strings, value );
+}
+
 
 
 
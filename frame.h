@@ -237,6 +237,8 @@
 *           Find a coordinate system with specified characteristics
 *        astFormat
 *           Format a coordinate value for a Frame axis.
+*        astFormatArray
+*           Format an array of coordinate values for a Frame axis.
 *        astNorm
 *           Normalise a set of Frame coordinates.
 *        astOffset
@@ -251,6 +253,8 @@
 *           Resolve a vector into two orthogonal components.
 *        astUnformat
 *           Read a formatted coordinate value for a Frame axis.
+*        astUnformatArray
+*           Read an array of formatted coordinate values for a Frame axis.
 
 *     Protected:
 *        astAbbrev
@@ -679,6 +683,7 @@ typedef struct AstFrameVtab {
    AstPointSet *(* ResolvePoints)( AstFrame *, const double [], const double [], AstPointSet *, AstPointSet *, int * );
    const char *(* Abbrev)( AstFrame *, int, const char *, const char *, const char *, int * );
    const char *(* Format)( AstFrame *, int, double, int * );
+   void (* FormatArray)( AstFrame *, int, int, const double *, int, char *, int * );
    const char *(* GetDomain)( AstFrame *, int * );
    const char *(* GetFormat)( AstFrame *, int, int * );
    const char *(* GetLabel)( AstFrame *, int, int * );
@@ -724,6 +729,7 @@ typedef struct AstFrameVtab {
    int (* TestTitle)( AstFrame *, int * );
    int (* TestUnit)( AstFrame *, int, int * );
    int (* Unformat)( AstFrame *, int, const char *, double *, int * );
+   int (* UnformatArray)( AstFrame *, int, int, const char *const [], double *, int * );
    int (* ValidateAxis)( AstFrame *, int, int, const char *, int * );
    AstSystemType (* ValidateSystem)( AstFrame *, AstSystemType, const char *, int * );
    AstSystemType (* SystemCode)( AstFrame *, const char *, int * );
@@ -927,11 +933,15 @@ void astNormBox_( AstFrame *, double *, double *, AstMapping *, int * );
 AstFrame *astPickAxes_( AstFrame *, int, const int[], AstMapping **, int * );
 const char *astFormat_( AstFrame *, int, double, int * );
 int astUnformat_( AstFrame *, int, const char *, double *, int * );
+int astUnformatArray_( AstFrame *, int, int, const char *const [], double *, int * );
+void astFormatArray_( AstFrame *, int, int, const double *, int, char *, int * );
 void astPermAxes_( AstFrame *, const int[], int * );
 #else
 AstFrame *astPickAxesId_( AstFrame *, int, const int[], AstMapping **, int * );
 const char *astFormatId_( AstFrame *, int, double, int * );
 int astUnformatId_( AstFrame *, int, const char *, double *, int * );
+int astUnformatArrayId_( AstFrame *, int, int, const char *const [], double *, int * );
+void astFormatArrayId_( AstFrame *, int, int, const double *, int, char *, int * );
 void astPermAxesId_( AstFrame *, const int[], int * );
 #endif
 
@@ -1170,6 +1180,10 @@ astINVOKE(V,astPermAxes_(astCheckFrame(this),perm,STATUS_PTR))
 astINVOKE(O,astPickAxes_(astCheckFrame(this),naxes,axes,(AstMapping **)(map),STATUS_PTR))
 #define astUnformat(this,axis,string,value) \
 astINVOKE(V,astUnformat_(astCheckFrame(this),axis,string,value,STATUS_PTR))
+#define astFormatArray(this,axis,npoint,value,len,buf) \
+astINVOKE(V,astFormatArray_(astCheckFrame(this),axis,npoint,value,len,buf,STATUS_PTR))
+#define astUnformatArray(this,axis,npoint,strings,value) \
+astINVOKE(V,astUnformatArray_(astCheckFrame(this),axis,npoint,strings,value,STATUS_PTR))
 #else
 #define astFormat(this,axis,value) \
 astINVOKE(V,astFormatId_(astCheckFrame(this),axis,value,STATUS_PTR))
@@ -1179,6 +1193,10 @@ astINVOKE(V,astPermAxesId_(astCheckFrame(this),perm,STATUS_PTR))
 astINVOKE(O,astPickAxesId_(astCheckFrame(this),naxes,axes,(AstMapping **)(map),STATUS_PTR))
 #define astUnformat(this,axis,string,value) \
 astINVOKE(V,astUnformatId_(astCheckFrame(this),axis,string,value,STATUS_PTR))
+#define astFormatArray(this,axis,npoint,value,len,buf) \
+astINVOKE(V,astFormatArrayId_(astCheckFrame(this),axis,npoint,value,len,buf,STATUS_PTR))
+#define astUnformatArray(this,axis,npoint,strings,value) \
+astINVOKE(V,astUnformatArrayId_(astCheckFrame(this),axis,npoint,strings,value,STATUS_PTR))
 #endif
 
 #if defined(astCLASS)            /* Protected */
@@ -807,9 +807,7 @@ static void (* parent_clear)( AstObject *, const char *, int * );
 static int (* parent_getusedefs)( AstObject *, int * );
 static void (* parent_vset)( AstObject *, const char *, char **, va_list, int * );
 
-#if defined(THREAD_SAFE)
 static int (* parent_managelock)( AstObject *, int, int, AstObject **, int * );
-#endif
 
 /* Define macros for accessing each item of thread specific global data. */
 #ifdef THREAD_SAFE
@@ -871,6 +869,7 @@ static AstFrameSet *ConvertX( AstFrame *, AstFrame *, const char *, int * );
 static AstFrameSet *FindFrame( AstFrame *, AstFrame *, const char *, int * );
 static AstLineDef *LineDef( AstFrame *, const double[2], const double[2], int * );
 static AstMapping *CombineMaps( AstMapping *, int, AstMapping *, int, int, int * );
+static AstMapping *Compile( AstMapping *, int * );
 static AstMapping *GetMapping( AstFrameSet *, int, int, int * );
 static AstMapping *RemoveRegions( AstMapping *, int * );
 static AstMapping *Simplify( AstMapping *, int * );
@@ -878,10 +877,12 @@ static AstObject *Cast( AstObject *, AstObject *, int * );
 static AstPointSet *FrameGrid( AstFrame *, int, const double *, const double *, int * );
 static AstPointSet *ResolvePoints( AstFrame *, const double [], const double [], AstPointSet *, AstPointSet *, int * );
 static AstPointSet *Transform( AstMapping *, AstPointSet *, int, AstPointSet *, int * );
+static void JacobianPoints( AstMapping *, AstPointSet *, int, AstPointSet *, int * );
 static AstSystemType SystemCode( AstFrame *, const char *, int * );
 static AstSystemType ValidateSystem( AstFrame *, AstSystemType, const char *, int * );
 static const char *Abbrev( AstFrame *, int, const char *, const char *, const char *, int * );
 static const char *Format( AstFrame *, int, double, int * );
+static void FormatArray( AstFrame *, int, int, const double *, int, char *, int * );
 static const char *GetAttrib( AstObject *, const char *, int * );
 static const char *GetDomain( AstFrame *, int * );
 static const char *GetFormat( AstFrame *, int, int * );
@@ -903,6 +904,7 @@ static double Offset2( AstFrame *, const double[2], double, double, double[2], i
 static double Rate( AstMapping *, double *, int, int, int * );
 static int *MapSplit( AstMapping *, int, const int *, AstMapping **, int * );
 static int Equal( AstObject *, AstObject *, int * );
+static int ThreadSafe( AstMapping *, int * );
 static int Fields( AstFrame *, int, const char *, const char *, int, char **, int *, double *, int * );
 static int ForceCopy( AstFrameSet *, int, int * );
 static int GetActiveUnit( AstFrame *, int * );
@@ -949,6 +951,7 @@ static int TestSymbol( AstFrame *, int, int * );
 static int TestTitle( AstFrame *, int * );
 static int TestUnit( AstFrame *, int, int * );
 static int Unformat( AstFrame *, int, const char *, double *, int * );
+static int UnformatArray( AstFrame *, int, int, const char *const [], double *, int * );
 static int ValidateAxis( AstFrame *, int, int, const char *, int * );
 static int ValidateFrameIndex( AstFrameSet *, int, const char *, int * );
 static void AddFrame( AstFrameSet *, int, AstMapping *, AstFrame *, int * );
@@ -1073,9 +1076,7 @@ static int TestVariant( AstFrameSet *, int * );
 static void ClearVariant( AstFrameSet *, int * );
 static void SetVariant( AstFrameSet *, const char *, int * );
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *, int, int, AstObject **, int * );
-#endif
 
 /* Member functions. */
 /* ================= */
@@ -2950,6 +2951,63 @@ static void ClearVariant( AstFrameSet *this, int *status ) {
 
 }
 
+static AstMapping *Compile( AstMapping *this_mapping, int *status ) {
+/*
+*  Name:
+*     Compile
+
+*  Purpose:
+*     Prepare a FrameSet for fast repeated use.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "frameset.h"
+*     AstMapping *Compile( AstMapping *this, int *status )
+
+*  Class Membership:
+*     FrameSet method (over-rides the astCompile method inherited from
+*     the Mapping class).
+
+*  Description:
+*     This function returns a compiled copy of the Mapping from the base
+*     Frame of the FrameSet to its current Frame. This is the Mapping
+*     used when the FrameSet is used to transform points.
+
+*  Parameters:
+*     this
+*        Pointer to the FrameSet.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     A new pointer to the compiled Mapping.
+
+*  Notes:
+*     - A NULL pointer will be returned if this function is invoked with
+*     the global error status set, or if it should fail for any reason.
+*/
+
+/* Local Variables: */
+   AstMapping *map;              /* Base to current Mapping */
+   AstMapping *result;           /* Pointer to returned Mapping */
+
+/* Check the global error status. */
+   if ( !astOK ) return NULL;
+
+/* Obtain the Mapping from the base Frame to the current Frame, and
+   compile it. */
+   map = astGetMapping( (AstFrameSet *) this_mapping, AST__BASE,
+                        AST__CURRENT );
+   result = astCompile( map );
+   map = astAnnul( map );
+
+/* Return the result, deleting it if an error occurred. */
+   if ( !astOK ) result = astAnnul( result );
+   return result;
+}
+
 static AstMapping *CombineMaps( AstMapping *mapping1, int invert1,
                                 AstMapping *mapping2, int invert2,
                                 int series, int *status ) {
@@ -3040,9 +3098,10 @@ static AstMapping *CombineMaps( AstMapping *mapping1, int invert1,
    copy = ( ( mapping1 == mapping2 ) && ( invert1 != invert2 ) );
 
 /* Clone the first Mapping pointer. Do likewise for the second but
-   make a copy instead if necessary. */
-   map1 = astClone( mapping1 );
-   map2 = copy ? astCopy( mapping2 ) : astClone( mapping2 );
+   make a copy instead if necessary. A frozen Mapping may be in use by
+   other threads, so also use a copy if its Invert flag needs changing. */
+   map1 = astCopyIfFrozen( mapping1, invert1 );
+   map2 = copy ? astCopy( mapping2 ) : astCopyIfFrozen( mapping2, invert2 );
 
 /* If the Invert value for the first Mapping needs changing, make the
    change. */
@@ -4272,6 +4331,76 @@ static const char *Format( AstFrame *this_frame, int axis, double value, int *st
    return result;
 }
 
+static void FormatArray( AstFrame *this_frame, int axis, int npoint,
+                         const double *value, int len, char *buf,
+                         int *status ) {
+/*
+*  Name:
+*     FormatArray
+
+*  Purpose:
+*     Format an array of coordinate values for a FrameSet axis.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "frameset.h"
+*     void FormatArray( AstFrame *this, int axis, int npoint,
+*                       const double *value, int len, char *buf,
+*                       int *status )
+
+*  Class Membership:
+*     FrameSet member function (over-rides the astFormatArray method
+*     inherited from the Frame class).
+
+*  Description:
+*     This function formats an array of coordinate values for a
+*     FrameSet axis, storing the resulting strings in a buffer supplied by
+*     the caller. The formatting applied is the same as for astFormat.
+
+*  Parameters:
+*     this
+*        Pointer to the FrameSet.
+*     axis
+*        The number of the axis (zero-based) for which formatting is
+*        to be performed.
+*     npoint
+*        The number of values to be formatted.
+*     value
+*        Pointer to an array of "npoint" coordinate values.
+*     len
+*        The number of characters reserved in "buf" for each formatted
+*        value, including the terminating null.
+*     buf
+*        Pointer to a buffer of at least "npoint*len" characters. The
+*        formatted version of "value[i]" is returned as a null-terminated
+*        string starting at "buf[i*len]".
+*     status
+*        Pointer to the inherited status variable.
+*/
+
+/* Local Variables: */
+   AstFrame *fr;                 /* Pointer to current Frame */
+   AstFrameSet *this;            /* Pointer to the FrameSet structure */
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* Obtain a pointer to the FrameSet structure. */
+   this = (AstFrameSet *) this_frame;
+
+/* Validate the axis index. */
+   (void) astValidateAxis( this, axis, 1, "astFormatArray" );
+
+/* Obtain a pointer to the FrameSet's current Frame and invoke the
+   astFormatArray method for this Frame. Annul the Frame pointer
+   afterwards. */
+   fr = astGetFrame( this, AST__CURRENT );
+   astFormatArray( fr, axis, npoint, value, len, buf );
+   fr = astAnnul( fr );
+}
+
 static double Gap( AstFrame *this_frame, int axis, double gap, int *ntick, int *status ) {
 /*
 *  Name:
@@ -6041,10 +6170,8 @@ void astInitFrameSetVtab_(  AstFrameSetVtab *vtab, const char *name, int *status
    parent_getusedefs = object->GetUseDefs;
    object->GetUseDefs = GetUseDefs;
 
-#if defined(THREAD_SAFE)
    parent_managelock = object->ManageLock;
    object->ManageLock = ManageLock;
-#endif
 
 /* Store replacement pointers for methods which will be over-ridden by
    new member functions implemented here. */
@@ -6066,7 +6193,10 @@ void astInitFrameSetVtab_(  AstFrameSetVtab *vtab, const char *name, int *status
    mapping->GetTranForward = GetTranForward;
    mapping->GetTranInverse = GetTranInverse;
    mapping->Rate = Rate;
+   mapping->JacobianPoints = JacobianPoints;
+   mapping->ThreadSafe = ThreadSafe;
    mapping->ReportPoints = ReportPoints;
+   mapping->Compile = Compile;
    mapping->RemoveRegions = RemoveRegions;
    mapping->Simplify = Simplify;
    mapping->Transform = Transform;
@@ -6098,6 +6228,7 @@ void astInitFrameSetVtab_(  AstFrameSetVtab *vtab, const char *name, int *status
    frame->Fields = Fields;
    frame->FindFrame = FindFrame;
    frame->Format = Format;
+   frame->FormatArray = FormatArray;
    frame->FrameGrid = FrameGrid;
    frame->Centre = Centre;
    frame->Gap = Gap;
@@ -6167,6 +6298,7 @@ void astInitFrameSetVtab_(  AstFrameSetVtab *vtab, const char *name, int *status
    frame->TestTitle = TestTitle;
    frame->TestUnit = TestUnit;
    frame->Unformat = Unformat;
+   frame->UnformatArray = UnformatArray;
    frame->ValidateAxis = ValidateAxis;
    frame->ValidateAxisSelection = ValidateAxisSelection;
    frame->ValidateSystem = ValidateSystem;
@@ -6791,7 +6923,6 @@ static const char *GetAllVariants( AstFrameSet *this, int *status ) {
    return result;
 }
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *this_object, int mode, int extra,
                        AstObject **fail, int *status ) {
 /*
@@ -6892,7 +7023,6 @@ static int ManageLock( AstObject *this_object, int mode, int extra,
    return result;
 
 }
-#endif
 
 static int *MapSplit( AstMapping *this_map, int nin, const int *in, AstMapping **map, int *status ){
 /*
@@ -8064,6 +8194,63 @@ static void PrimaryFrame( AstFrame *this_frame, int axis1,
    }
 }
 
+static void JacobianPoints( AstMapping *this, AstPointSet *in, int forward,
+                            AstPointSet *jac, int *status ) {
+/*
+*  Name:
+*     JacobianPoints
+
+*  Purpose:
+*     Find the Jacobian matrix of a Mapping at a set of points.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "frameset.h"
+*     void JacobianPoints( AstMapping *this, AstPointSet *in, int forward,
+*                          AstPointSet *jac, int *status )
+
+*  Class Membership:
+*     FrameSet member function (over-rides the astJacobianPoints protected
+*     method inherited from the Mapping class).
+
+*  Description:
+*     This function finds the Jacobian matrix of the forward or inverse
+*     transformation of a FrameSet at each of the points in a PointSet,
+*     by invoking the astJacobianPoints method of the Mapping between
+*     its base and current Frames.
+
+*  Parameters:
+*     this
+*        Pointer to the FrameSet.
+*     in
+*        Pointer to the PointSet holding the positions at which the
+*        Jacobian is required.
+*     forward
+*        A non-zero value indicates that the Jacobian of the forward
+*        coordinate transformation is required, while a zero value
+*        requests the Jacobian of the inverse transformation.
+*     jac
+*        Pointer to the PointSet in which to store the Jacobian.
+*     status
+*        Pointer to the inherited status variable.
+*/
+
+/* Local Variables: */
+   AstMapping *map;              /* Pointer to the base->current Mapping */
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* Obtain the Mapping between the base and current Frames in the
+   FrameSet (note this takes account of whether the FrameSet has been
+   inverted), and invoke its astJacobianPoints method. */
+   map = astGetMapping( (AstFrameSet *) this, AST__BASE, AST__CURRENT );
+   (void) astJacobianPoints( map, in, forward, jac );
+   map = astAnnul( map );
+}
+
 static double Rate( AstMapping *this_mapping, double *at, int ax1, int ax2, int *status ){
 /*
 *  Name:
@@ -9882,10 +10069,7 @@ static AstMapping *Simplify( AstMapping *this_mapping, int *status ) {
    AstMapping *result;           /* Result pointer to return */
    AstMapping *tmp;              /* Temporary Mapping pointer */
    int inode;                    /* Loop counter for FrameSet nodes */
-   int inv;                      /* Mapping Invert attribute value */
    int invert;                   /* Invert flag value */
-   int set;                      /* Invert attribute set? */
-   int simpler;                  /* Simplification achieved? */
 
 /* Initialise. */
    result = NULL;
@@ -9896,65 +10080,57 @@ static AstMapping *Simplify( AstMapping *this_mapping, int *status ) {
 /* Obtain a pointer to the FrameSet structure. */
    this = (AstFrameSet *) this_mapping;
 
-/* Make a copy of the FrameSet, since we may alter it (this is a deep
-   copy, which is a minor limitation of the current implementation). */
-   new = astCopy( this );
-
 /* Loop to examine each of the Mappings between the Frames in the
-   copy. */
-   simpler = 0;
-   for ( inode = 1; astOK && ( inode < new->nnode ); inode++ ) {
+   FrameSet. A copy of the FrameSet is made only when the first Mapping
+   that can be simplified is found, since we then need to alter it
+   (this is a deep copy, which is a minor limitation of the current
+   implementation). */
+   new = NULL;
+   for ( inode = 1; astOK && ( inode < this->nnode ); inode++ ) {
 
 /* Obtain the Mapping pointer and associated invert flag. */
-      map = new->map[ inode - 1 ];
-      invert = new->invert[ inode - 1 ];
-
-/* Determine if the Mapping's Invert attribute is set, and obtain its
-   value. */
-      set = astTestInvert( map );
-      inv = astGetInvert( map );
-
-/* If necessary, set the required value for the Invert attribute. */
-      if ( inv != invert ) astSetInvert( map, invert );
-
-/* Simplify the Mapping. */
-      tmp = astSimplify( map );
-
-/* If necessary, restore the original state of the Mapping's Invert
-   attribute. */
-      if ( inv != invert ) {
-         if ( set ) {
-            astSetInvert( map, inv );
-         } else {
-            astClearInvert( map );
-         }
+      map = astClone( this->map[ inode - 1 ] );
+      invert = this->invert[ inode - 1 ];
+
+/* If the Mapping's Invert attribute already has the required value,
+   simplify it directly. This allows any simplified Mapping stored in it
+   by a previous invocation of astSimplify to be re-used. Otherwise,
+   simplify a copy of the Mapping in which the required value has been
+   set, so that the original Mapping (which may be in use elsewhere) is
+   not altered. */
+      if ( astGetInvert( map ) != invert ) {
+         tmp = astCopy( map );
+         (void) astAnnul( map );
+         map = tmp;
+         astSetInvert( map, invert );
       }
+      tmp = astSimplify( map );
 
 /* Test if simplification was performed. */
-      if ( astOK ) {
-         if ( tmp != map ) {
+      if ( astOK && ( tmp != map ) ) {
 
-/* If so, annul the original Mapping pointer and substitute the new
-   one. Also set a new invert flag to accompany it. */
+/* If so, make a copy of the FrameSet if this has not already been done,
+   annul its original Mapping pointer and substitute the new one. Also
+   set a new invert flag to accompany it. */
+         if ( !new ) new = astCopy( this );
+         if ( astOK ) {
             (void) astAnnul( new->map[ inode - 1 ] );
             new->map[ inode - 1 ] = astClone( tmp );
             new->invert[ inode - 1 ] = astGetInvert( tmp );
-
-/* Note if any Mapping within the FrameSet is simplified. */
-            simpler = 1;
          }
       }
 
-/* Annul the pointer to the simplified Mapping. */
+/* Annul the Mapping pointers. */
       tmp = astAnnul( tmp );
+      map = astAnnul( map );
    }
 
 /* If simplification was possible, clone a pointer to the new
    FrameSet. Otherwise clone a pointer to the original one. */
-   if ( astOK ) result = astClone( simpler ? new : this );
+   if ( astOK ) result = astClone( new ? new : this );
 
-/* Annul the new FrameSet pointer. */
-   new = astAnnul( new );
+/* Annul any new FrameSet pointer. */
+   if ( new ) new = astAnnul( new );
 
 /* If an error occurred, annul the returned pointer. */
    if ( !astOK ) result = astAnnul( result );
@@ -10956,6 +11132,40 @@ static void TidyNodes( AstFrameSet *this, int *status ) {
    }
 }
 
+static int ThreadSafe( AstMapping *this_mapping, int *status ){
+/*
+*  Name:
+*     ThreadSafe
+
+*  Purpose:
+*     Check if a FrameSet can transform points in several threads at once.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "frameset.h"
+*     int ThreadSafe( AstMapping *this, int *status )
+
+*  Class Membership:
+*     FrameSet member function (over-rides the protected astThreadSafe
+*     method inherited from the Mapping class).
+
+*  Description:
+*     This function always returns zero, since the FrameSet Transform
+*     method temporarily changes the Invert attribute of the Mappings
+*     within the FrameSet when finding the Mapping between the base and
+*     current Frames.
+
+*  Parameters:
+*     this
+*        Pointer to the FrameSet.
+*     status
+*        Pointer to the inherited status variable.
+*/
+   return 0;
+}
+
 static AstPointSet *Transform( AstMapping *this_mapping, AstPointSet *in,
                                int forward, AstPointSet *out, int *status ) {
 /*
@@ -11160,6 +11370,87 @@ static int Unformat( AstFrame *this_frame, int axis, const char *string,
    return nc;
 }
 
+static int UnformatArray( AstFrame *this_frame, int axis, int npoint,
+                          const char *const strings[], double *value,
+                          int *status ) {
+/*
+*  Name:
+*     UnformatArray
+
+*  Purpose:
+*     Read an array of formatted coordinate values for a FrameSet axis.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "frameset.h"
+*     int UnformatArray( AstFrame *this, int axis, int npoint,
+*                        const char *const strings[], double *value,
+*                        int *status )
+
+*  Class Membership:
+*     FrameSet member function (over-rides the astUnformatArray method
+*     inherited from the Frame class).
+
+*  Description:
+*     This function reads an array of formatted coordinate values for
+*     a FrameSet axis (supplied as strings) and returns the equivalent
+*     numerical values. Each string is interpreted as by astUnformat.
+
+*  Parameters:
+*     this
+*        Pointer to the FrameSet.
+*     axis
+*        The number of the axis (zero-based) for which the coordinate
+*        values are to be read.
+*     npoint
+*        The number of strings to be read.
+*     strings
+*        An array of "npoint" pointers to null-terminated strings, each
+*        holding a formatted coordinate value.
+*     value
+*        Pointer to an array in which to return the "npoint" coordinate
+*        values read.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     The number of strings that were read successfully (see
+*     astUnformatArray).
+*/
+
+/* Local Variables: */
+   AstFrame *fr;                 /* Pointer to current Frame */
+   AstFrameSet *this;            /* Pointer to the FrameSet structure */
+   int result;                   /* Number of strings read */
+
+/* Initialise. */
+   result = 0;
+
+/* Check the global error status. */
+   if ( !astOK ) return result;
+
+/* Obtain a pointer to the FrameSet structure. */
+   this = (AstFrameSet *) this_frame;
+
+/* Validate the axis index. */
+   (void) astValidateAxis( this, axis, 1, "astUnformatArray" );
+
+/* Obtain a pointer to the FrameSet's current Frame and invoke the
+   astUnformatArray method for this Frame. Annul the Frame pointer
+   afterwards. */
+   fr = astGetFrame( this, AST__CURRENT );
+   result = astUnformatArray( fr, axis, npoint, strings, value );
+   fr = astAnnul( fr );
+
+/* Return zero if an error occurred. */
+   if ( !astOK ) result = 0;
+
+/* Return the result. */
+   return result;
+}
+
 static int ValidateAxis( AstFrame *this_frame, int axis, int fwd,
                          const char *method, int *status ) {
 /*
@@ -12947,6 +13238,7 @@ AstFrameSet *astLoadFrameSet_( void *mem, size_t size,
 void astAddFrame_( AstFrameSet *this, int iframe, AstMapping *map,
                    AstFrame *frame, int *status ) {
    if ( !astOK ) return;
+   if ( astCheckFrozen( this, "astAddFrame" ) ) return;
    (**astMEMBER(this,FrameSet,AddFrame))( this, iframe, map, frame, status );
 }
 void astClearBase_( AstFrameSet *this, int *status ) {
@@ -12987,18 +13279,22 @@ int astGetNframe_( AstFrameSet *this, int *status ) {
 }
 void astRemapFrame_( AstFrameSet *this, int iframe, AstMapping *map, int *status ) {
    if ( !astOK ) return;
+   if ( astCheckFrozen( this, "astRemapFrame" ) ) return;
    (**astMEMBER(this,FrameSet,RemapFrame))( this, iframe, map, status );
 }
 void astAddVariant_( AstFrameSet *this, AstMapping *map, const char *name, int *status ) {
    if ( !astOK ) return;
+   if ( astCheckFrozen( this, "astAddVariant" ) ) return;
    (**astMEMBER(this,FrameSet,AddVariant))( this, map, name, status );
 }
 void astMirrorVariants_( AstFrameSet *this, int iframe, int *status ) {
    if ( !astOK ) return;
+   if ( astCheckFrozen( this, "astMirrorVariants" ) ) return;
    (**astMEMBER(this,FrameSet,MirrorVariants))( this, iframe, status );
 }
 void astRemoveFrame_( AstFrameSet *this, int iframe, int *status ) {
    if ( !astOK ) return;
+   if ( astCheckFrozen( this, "astRemoveFrame" ) ) return;
    (**astMEMBER(this,FrameSet,RemoveFrame))( this, iframe, status );
 }
 void astSetBase_( AstFrameSet *this, int ibase, int *status ) {
@@ -117,6 +117,8 @@
 *     Public:
 *        astClear
 *           Clear attribute values for a FrameSet.
+*        astCompile
+*           Prepare a FrameSet for fast repeated use.
 *        astConvert
 *           Determine how to convert between two coordinate systems.
 *        astDistance
@@ -141,9 +141,7 @@ static void (* parent_setregfs)( AstRegion *, AstFrame *, int * );
 static void (* parent_setunc)( AstRegion *, AstRegion *, int * );
 static void (* parent_resetcache)( AstRegion *, int * );
 
-#if defined(THREAD_SAFE)
 static int (* parent_managelock)( AstObject *, int, int, AstObject **, int * );
-#endif
 
 
 #ifdef THREAD_SAFE
@@ -205,9 +203,7 @@ static void ResetCache( AstRegion *this, int * );
 static void SetRegFS( AstRegion *, AstFrame *, int * );
 static void SetUnc( AstRegion *, AstRegion *, int * );
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *, int, int, AstObject **, int * );
-#endif
 
 /* Member functions. */
 /* ================= */
@@ -774,10 +770,8 @@ void astInitIntervalVtab_(  AstIntervalVtab *vtab, const char *name, int *status
    mapping = (AstMappingVtab *) vtab;
    region = (AstRegionVtab *) vtab;
 
-#if defined(THREAD_SAFE)
    parent_managelock = object->ManageLock;
    object->ManageLock = ManageLock;
-#endif
 
    parent_transform = mapping->Transform;
    mapping->Transform = Transform;
@@ -894,7 +888,6 @@ void IntervalPoints( AstInterval *this, double *lbnd, double *ubnd,
    }
 }
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *this_object, int mode, int extra,
                        AstObject **fail, int *status ) {
 /*
@@ -986,7 +979,6 @@ static int ManageLock( AstObject *this_object, int mode, int extra,
    return result;
 
 }
-#endif
 
 static int MapMerge( AstMapping *this, int where, int series, int *nmap,
                      AstMapping ***map_list, int **invert_list, int *status ) {
@@ -224,6 +224,7 @@ static void Copy( const AstObject *, AstObject *, int * );
 static void Delete( AstObject *, int * );
 static void Dump( AstObject *, AstChannel *, int * );
 static int Equal( AstObject *, AstObject *, int * );
+static int ThreadSafe( AstMapping *, int * );
 static void IntraReg( const char *, int, int, void (*)( AstMapping *, int, int, const double *[], int, int, double *[] ), void (*)( void (*)( AstMapping *, int, int, const double *[], int, int, double *[] ), AstMapping *, int, int, const double *[], int, int, double *[], int * ), unsigned int, const char *, const char *, const char *, int * );
 static void SetAttrib( AstObject *, const char *, int * );
 static void SetIntraFlag( AstIntraMap *, const char *, int * );
@@ -711,6 +712,7 @@ void astInitIntraMapVtab_(  AstIntraMapVtab *vtab, const char *name, int *status
    new member functions implemented here. */
    object->Equal = Equal;
    mapping->MapMerge = MapMerge;
+   mapping->ThreadSafe = ThreadSafe;
 
 /* Store pointers to inherited methods that will be invoked explicitly
    by this class. */
@@ -1771,6 +1773,39 @@ static int TestAttrib( AstObject *this_object, const char *attrib, int *status )
    return result;
 }
 
+static int ThreadSafe( AstMapping *this_mapping, int *status ){
+/*
+*  Name:
+*     ThreadSafe
+
+*  Purpose:
+*     Check if an IntraMap can transform points in several threads at once.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "intramap.h"
+*     int ThreadSafe( AstMapping *this, int *status )
+
+*  Class Membership:
+*     IntraMap member function (over-rides the protected astThreadSafe
+*     method inherited from the Mapping class).
+
+*  Description:
+*     This function always returns zero, since the IntraMap Transform
+*     method invokes a transformation function supplied by the user,
+*     which may not be thread safe.
+
+*  Parameters:
+*     this
+*        Pointer to the IntraMap.
+*     status
+*        Pointer to the inherited status variable.
+*/
+   return 0;
+}
+
 static AstPointSet *Transform( AstMapping *this_mapping, AstPointSet *in,
                                int forward, AstPointSet *out, int *status ) {
 /*
@@ -370,9 +370,7 @@ static int (* parent_testattrib)( AstObject *, const char *, int * );
 static void (* parent_clearattrib)( AstObject *, const char *, int * );
 static void (* parent_setattrib)( AstObject *, const char *, int * );
 
-#if defined(THREAD_SAFE)
 static int (* parent_managelock)( AstObject *, int, int, AstObject **, int * );
-#endif
 
 /* Define macros for accessing each item of thread specific global data. */
 #ifdef THREAD_SAFE
@@ -571,9 +569,7 @@ static int TestMapLocked( AstKeyMap *, int * );
 static void ClearMapLocked( AstKeyMap *, int * );
 static void SetMapLocked( AstKeyMap *, int, int * );
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *, int, int, AstObject **, int * );
-#endif
 
 /* Member functions. */
 /* ================= */
@@ -3634,10 +3630,8 @@ void astInitKeyMapVtab_(  AstKeyMapVtab *vtab, const char *name, int *status ) {
    parent_testattrib = object->TestAttrib;
    object->TestAttrib = TestAttrib;
 
-#if defined(THREAD_SAFE)
    parent_managelock = object->ManageLock;
    object->ManageLock = ManageLock;
-#endif
 
 /* Declare the destructor, copy constructor and dump function. */
    astSetDelete( vtab, Delete );
@@ -3789,7 +3783,6 @@ static int KeyCmp( const char *key1, const char *key2 ) {
    return result;
 }
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *this_object, int mode, int extra,
                        AstObject **fail, int *status ) {
 /*
@@ -3904,7 +3897,6 @@ static int ManageLock( AstObject *this_object, int mode, int extra,
    return result;
 
 }
-#endif
 
 static void MapCopy( AstKeyMap *this, AstKeyMap *that, int *status ) {
 /*
@@ -1465,6 +1465,8 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
    double d1;                    /* Offset to I1 value */
    double d2;                    /* Offset to I2 value */
    double fract;                 /* Fractional interpolation distance */
+   double last_in;               /* Last input value transformed */
+   double last_out;              /* Last output value produced */
    double scale;                 /* Normalising scale factor */
    double value_in;              /* Input coordinate value */
    double value_out;             /* Output coordinate value */
@@ -1526,7 +1528,11 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
 /* Calculate the scale factor required. */
          scale = 1.0 / map->inc;
 
-/* Loop to transform each input point. */
+/* Loop to transform each input point. The last input and output values
+   are retained in local variables (rather than in the LutMap structure)
+   so that the LutMap can be used by several threads at once. */
+         last_in = AST__BAD;
+         last_out = AST__BAD;
          for ( point = 0; point < npoint; point++ ) {
 
 /* Extract the input coordinate value. */
@@ -1534,8 +1540,8 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
 
 /* First check if this is the same value as we transformed last. If
    so, re-use the last result. */
-            if ( value_in == map->last_fwd_in ) {
-               value_out = map->last_fwd_out;
+            if ( value_in == last_in ) {
+               value_out = last_out;
 
 /* Check for bad input coordinates and generate a bad result if
    necessary. */
@@ -1599,9 +1605,9 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
             ptr_out[ 0 ][ point ] = value_out;
 
 /* Retain the input and output coordinate values for possible re-use
-   in future. */
-            map->last_fwd_in = value_in;
-            map->last_fwd_out = value_out;
+   by the next point. */
+            last_in = value_in;
+            last_out = value_out;
          }
 
 /* Inverse transformation. */
@@ -1627,7 +1633,11 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
          near = ( astGetLutInterp( map ) == NEAR );
          nlutm1 = nlut - 1;
 
-/* Loop to transform each input point. */
+/* Loop to transform each input point. The last input and output values
+   are retained in local variables (rather than in the LutMap structure)
+   so that the LutMap can be used by several threads at once. */
+         last_in = AST__BAD;
+         last_out = AST__BAD;
          for ( point = 0; point < npoint; point++ ) {
 
 /* Extract the input coordinate value. */
@@ -1635,8 +1645,8 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
 
 /* First check if this is the same value as we transformed last. If
    so, re-use the last result. */
-            if ( value_in == map->last_inv_in ) {
-               value_out = map->last_inv_out;
+            if ( value_in == last_in ) {
+               value_out = last_out;
 
 /* Check for bad input coordinates and generate a bad result if
    necessary. */
@@ -1728,9 +1738,9 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
             ptr_out[ 0 ][ point ] = value_out;
 
 /* Retain the input and output coordinate values for possible re-use
-   in future. */
-            map->last_inv_in = value_in;
-            map->last_inv_out = value_out;
+   by the next point. */
+            last_in = value_in;
+            last_out = value_out;
          }
       }
    }
@@ -2412,12 +2422,6 @@ AstLutMap *astInitLutMap_( void *mem, size_t size, int init,
          for ( ilut = 0; ilut < nlut; ilut++, p++ ) {
             if( !astISFINITE(*p) ) *p = AST__BAD;
          }
-
-/* Initialise the retained input and output coordinate values. */
-         new->last_fwd_in = AST__BAD;
-         new->last_fwd_out = AST__BAD;
-         new->last_inv_in = AST__BAD;
-         new->last_inv_out = AST__BAD;
       }
 
 /* If an error occurred, clean up by deleting the new LutMap. */
@@ -2582,12 +2586,6 @@ AstLutMap *astLoadLutMap_( void *mem, size_t size,
             new->lut[ ilut ] = astReadDouble( channel, buff, AST__BAD );
          }
 
-/* Initialise the retained input and output coordinate values. */
-         new->last_fwd_in = AST__BAD;
-         new->last_fwd_out = AST__BAD;
-         new->last_inv_in = AST__BAD;
-         new->last_inv_out = AST__BAD;
-
 /* See if the array is monotonic increasing or decreasing. */
          (void) GetMonotonic( new->nlut, new->lut, &(new->nluti),
                               &(new->luti), &(new->flagsi), &(new->indexi),
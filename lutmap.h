@@ -157,10 +157,6 @@ typedef struct AstLutMap {
    double *lut;                 /* Pointer to lookup table */
    double *luti;                /* Reduced lookup table for inverse trans. */
    double inc;                  /* Input increment between table entries */
-   double last_fwd_in;          /* Last input value (forward transfm.) */
-   double last_fwd_out;         /* Last output value (forward transfm.) */
-   double last_inv_in;          /* Last input value (inverse transfm.) */
-   double last_inv_out;         /* Last output value (inverse transfm.) */
    double start;                /* Input value for first table entry */
    int *flagsi;                 /* Flags indicating adjacent bad values */
    int *indexi;                 /* Translates reduced to original indices */
@@ -99,10 +99,16 @@
 
 *  New Methods Defined:
 *     Public:
+*        astChebyApprox
+*           Create a fast piecewise Chebyshev approximation to a Mapping.
+*        astCompile
+*           Prepare a Mapping for fast repeated use.
 *        astDecompose
 *           Decompose a Mapping into two component Mappings.
 *        astInvert
 *           Invert a Mapping.
+*        astJacobian
+*           Find the Jacobian matrix of a Mapping at many positions.
 *        astLinearApprox
 *           Form a linear approximation to a Mapping
 *        astMapBox
@@ -117,6 +123,10 @@
 *           Rebin a region of a sequence of data grids.
 *        astResample<X>
 *           Resample a region of a data grid.
+*        astResampleMany<X> (C only)
+*           Resample a region of several co-registered data grids.
+*        astResample8<X> (C only)
+*           Resample a region of a data grid using 64-bit bounds.
 *        astSimplify
 *           Simplify a Mapping.
 *        astTran1
@@ -125,6 +135,10 @@
 *           Transform 2-dimensional coordinates.
 *        astTranGrid
 *           Transform an N-dimensional regular grid of positions.
+*        astTranGridF
+*           Transform a grid of positions, returning single precision values.
+*        astTranGrid8 (C only)
+*           Transform a grid of positions using 64-bit bounds.
 *        astTranN
 *           Transform N-dimensional coordinates.
 *        astTranP (C only)
@@ -151,6 +165,10 @@
 *        astGetTranInverse
 *           Determine if a Mapping can perform an "inverse" coordinate
 *           transformation.
+*        astJacobianPoints
+*           Find the Jacobian matrix of a Mapping at a set of points.
+*        astLinearJacobian
+*           Store a constant Jacobian matrix at a set of points.
 *        astMapList
 *           Decompose a Mapping into a sequence of simpler Mappings.
 *        astMapSplit
@@ -159,14 +177,21 @@
 *           Simplify a sequence of Mappings.
 *        astReportPoints
 *           Report the effect of transforming a set of points using a Mapping.
+*        astResetSimplify
+*           Discard any stored result of simplifying a Mapping.
 *        astSetInvert
 *           Set the Invert attribute value for a Mapping.
 *        astSetReport
 *           Set the Report attribute value for a Mapping.
+*        astSlabPix
+*           Get or set the maximum number of pixels in each slab of a
+*           large array.
 *        astTestInvert
 *           Test if an Invert attribute value has been set for a Mapping.
 *        astTestReport
 *           Test if an Report attribute value has been set for a Mapping.
+*        astThreadSafe
+*           Can a Mapping transform points in several threads at once?
 *        astTransform
 *           Transform a set of points.
 
@@ -365,6 +390,9 @@
 #define AST__DISVAR (4096)       /* Generate distribution (not mean) variance? */
 #define AST__NONORM (8192)       /* No normalisation required at end? */
 #define AST__PARWGT (16384)      /* Use supplied constant weight? */
+#define AST__USEPLAN (32768)     /* Store and re-use resampling plan? */
+#define AST__KERNTAB (65536)     /* Tabulate 1-d interpolation kernel? */
+#define AST__BLOCKTAB (131072)   /* Use summed-area table for block averaging? */
 
 /* These macros identify standard sub-pixel interpolation algorithms
    for use by astResample<X>. They are used by giving the macro's
@@ -431,6 +459,10 @@ typedef struct AstMapping {
    char report;                   /* Report when converting coordinates? */
    char tran_forward;             /* Forward transformation defined? */
    char tran_inverse;             /* Inverse transformation defined? */
+   struct AstResamplePlan *plan;  /* Stored resampling plan (or NULL) */
+   struct AstMapBoxes *boxes;     /* Stored astMapBox results (or NULL) */
+   struct AstMapping *simplified; /* Stored result of astSimplify (or NULL) */
+   char simplified_invert;        /* Invert value when "simplified" was made */
 } AstMapping;
 
 /* Virtual function table. */
@@ -447,11 +479,15 @@ typedef struct AstMappingVtab {
    AstClassIdentifier id;
 
 /* Properties (e.g. methods) specific to this class. */
+   AstMapping *(* ChebyApprox)( AstMapping *, const double[], const double[], double, int, int, double *, int * );
+   AstMapping *(* Compile)( AstMapping *, int * );
    AstMapping *(* RemoveRegions)( AstMapping *, int * );
    AstMapping *(* Simplify)( AstMapping *, int * );
    AstPointSet *(* Transform)( AstMapping *, AstPointSet *, int, AstPointSet *, int * );
+   void (* JacobianPoints)( AstMapping *, AstPointSet *, int, AstPointSet *, int * );
    double (* Rate)( AstMapping *, double *, int, int, int * );
    int (* DoNotSimplify)( AstMapping *, int * );
+   int (* ThreadSafe)( AstMapping *, int * );
    int (* GetInvert)( AstMapping *, int * );
    int (* GetIsSimple)( AstMapping *, int * );
    int (* GetNin)( AstMapping *, int * );
@@ -469,6 +505,7 @@ typedef struct AstMappingVtab {
    void (* ClearReport)( AstMapping *, int * );
    void (* Decompose)( AstMapping *, AstMapping **, AstMapping **, int *, int *, int *, int * );
    void (* Invert)( struct AstMapping *, int * );
+   void (* Jacobian)( AstMapping *, int, int, int, const double *, int, int, double *, int * );
    void (* MapBox)( AstMapping *, const double [], const double [], int, int, double *, double *, double [], double [], int * );
    int (* MapList)( AstMapping *, int, int, int *, AstMapping ***, int **, int * );
    int *(* MapSplit)( AstMapping *, int, const int *, AstMapping **, int * );
@@ -478,6 +515,8 @@ typedef struct AstMappingVtab {
    void (* Tran1)( AstMapping *, int, const double [], int, double [], int * );
    void (* Tran2)( AstMapping *, int, const double [], const double [], int, double [], double [], int * );
    void (* TranGrid)( AstMapping *, int, const int[], const int[], double, int, int, int, int, double *, int * );
+   void (* TranGridF)( AstMapping *, int, const int[], const int[], double, int, int, int, int, float *, float, int * );
+   void (* TranGrid8)( AstMapping *, int, const int64_t[], const int64_t[], double, int, int, int, int64_t, double *, int * );
    void (* TranN)( AstMapping *, int, int, int, const double *, int, int, int, double *, int * );
    void (* TranP)( AstMapping *, int, int, const double *[], int, int, double *[], int * );
 
@@ -487,6 +526,19 @@ typedef struct AstMappingVtab {
                         void (*)( void ), const double [], int, double, int, \
                         Xtype, int, const int [], const int [], \
                         const int [], const int [], Xtype [], Xtype [], int * ); \
+   int (* ResampleMany##X)( AstMapping *, int, const int [], const int [], \
+                            int, const Xtype *const [], const Xtype *const [], \
+                            int, void (*)( void ), const double [], int, \
+                            double, int, Xtype, int, const int [], \
+                            const int [], const int [], const int [], \
+                            Xtype *const [], Xtype *const [], int * ); \
+   int64_t (* Resample8##X)( AstMapping *, int, const int64_t [], \
+                             const int64_t [], const Xtype [], \
+                             const Xtype [], int, void (*)( void ), \
+                             const double [], int, double, int, Xtype, int, \
+                             const int64_t [], const int64_t [], \
+                             const int64_t [], const int64_t [], Xtype [], \
+                             Xtype [], int * ); \
 
 DECLARE_GENERIC_ALL(B,signed char)
 DECLARE_GENERIC_ALL(D,double)
@@ -588,6 +640,19 @@ void astInitMappingGlobals_( AstMappingGlobals * );
                         void (*)( void ), const double [], int, double, int, \
                         Xtype, int, const int [], const int [], \
                         const int [], const int [], Xtype [], Xtype [], int * ); \
+   int astResampleMany##X##_( AstMapping *, int, const int [], const int [], \
+                            int, const Xtype *const [], const Xtype *const [], \
+                            int, void (*)( void ), const double [], int, \
+                            double, int, Xtype, int, const int [], \
+                            const int [], const int [], const int [], \
+                            Xtype *const [], Xtype *const [], int * ); \
+   int64_t astResample8##X##_( AstMapping *, int, const int64_t [], \
+                               const int64_t [], const Xtype [], \
+                               const Xtype [], int, void (*)( void ), \
+                               const double [], int, double, int, Xtype, int, \
+                               const int64_t [], const int64_t [], \
+                               const int64_t [], const int64_t [], Xtype [], \
+                               Xtype [], int * ); \
 
 PROTO_GENERIC_ALL(B,signed char)
 PROTO_GENERIC_ALL(D,double)
@@ -631,14 +696,19 @@ PROTO_GENERIC_DFI(LD,long double)
 
 #undef PROTO_GENERIC_DFI
 
+AstMapping *astChebyApprox_( AstMapping *, const double[], const double[], double, int, int, double *, int * );
+AstMapping *astCompile_( AstMapping *, int * );
 AstMapping *astRemoveRegions_( AstMapping *, int * );
 AstMapping *astSimplify_( AstMapping *, int * );
 void astInvert_( AstMapping *, int * );
+void astJacobian_( AstMapping *, int, int, int, const double *, int, int, double *, int * );
 int astLinearApprox_( AstMapping *, const double *, const double *, double, double *, int * );
 int astQuadApprox_( AstMapping *, const double[2], const double[2], int, int, double *, double *, int * );
 void astTran1_( AstMapping *, int, const double [], int, double [], int * );
 void astTran2_( AstMapping *, int, const double [], const double [], int, double [], double [], int * );
 void astTranGrid_( AstMapping *, int, const int[], const int[], double, int, int, int, int, double *, int * );
+void astTranGridF_( AstMapping *, int, const int[], const int[], double, int, int, int, int, float *, float, int * );
+void astTranGrid8_( AstMapping *, int, const int64_t[], const int64_t[], double, int, int, int, int64_t, double *, int * );
 void astTranN_( AstMapping *, int, int, int, const double *, int, int, int, double *, int * );
 void astTranP_( AstMapping *, int, int, const double *[], int, int, double *[], int * );
 
@@ -656,6 +726,11 @@ void astMapSplitId_( AstMapping *, int, const int *, int *, AstMapping **, int *
 
 #if defined(astCLASS)            /* Protected */
 int astRateState_( int, int * );
+int astSlabPix_( int, int * );
+void astResetSimplify_( AstMapping *, int * );
+AstMapping *astCopyIfFrozen_( AstMapping *, int, int * );
+AstPointSet *astJacobianPoints_( AstMapping *, AstPointSet *, int, AstPointSet *, int * );
+void astLinearJacobian_( AstPointSet *, int, const double *, AstPointSet *, int * );
 AstPointSet *astTransform_( AstMapping *, AstPointSet *, int, AstPointSet *, int * );
 int astGetInvert_( AstMapping *, int * );
 int astGetIsSimple_( AstMapping *, int * );
@@ -666,6 +741,7 @@ int astGetTranForward_( AstMapping *, int * );
 int astGetTranInverse_( AstMapping *, int * );
 int astGetIsLinear_( AstMapping *, int * );
 int astDoNotSimplify_( AstMapping *, int * );
+int astThreadSafe_( AstMapping *, int * );
 int astMapMerge_( AstMapping *, int, int, int *, AstMapping ***, int **, int * );
 int astTestInvert_( AstMapping *, int * );
 int astTestReport_( AstMapping *, int * );
@@ -719,6 +795,10 @@ astINVOKE(O,astLoadMapping_(mem,size,vtab,name,astCheckChannel(channel),STATUS_P
 #if HAVE_LONG_DOUBLE     /* Not normally implemented */
 #define astResampleLD(this,ndim_in,lbnd_in,ubnd_in,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var) \
 astINVOKE(V,astResampleLD_(astCheckMapping(this),ndim_in,lbnd_in,ubnd_in,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var,STATUS_PTR))
+#define astResampleManyLD(this,ndim_in,lbnd_in,ubnd_in,nplane,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var) \
+astINVOKE(V,astResampleManyLD_(astCheckMapping(this),ndim_in,lbnd_in,ubnd_in,nplane,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var,STATUS_PTR))
+#define astResample8LD(this,ndim_in,lbnd_in,ubnd_in,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var) \
+astINVOKE(V,astResample8LD_(astCheckMapping(this),ndim_in,lbnd_in,ubnd_in,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var,STATUS_PTR))
 #endif
 
 #define astInvert(this) \
@@ -771,6 +851,59 @@ astINVOKE(V,astResampleUS_(astCheckMapping(this),ndim_in,lbnd_in,ubnd_in,in,in_v
 astINVOKE(V,astResampleB_(astCheckMapping(this),ndim_in,lbnd_in,ubnd_in,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var,STATUS_PTR))
 #define astResampleUB(this,ndim_in,lbnd_in,ubnd_in,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var) \
 astINVOKE(V,astResampleUB_(astCheckMapping(this),ndim_in,lbnd_in,ubnd_in,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var,STATUS_PTR))
+#define astResampleManyD(this,ndim_in,lbnd_in,ubnd_in,nplane,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var) \
+astINVOKE(V,astResampleManyD_(astCheckMapping(this),ndim_in,lbnd_in,ubnd_in,nplane,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var,STATUS_PTR))
+#define astResample8D(this,ndim_in,lbnd_in,ubnd_in,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var) \
+astINVOKE(V,astResample8D_(astCheckMapping(this),ndim_in,lbnd_in,ubnd_in,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var,STATUS_PTR))
+#define astResampleManyF(this,ndim_in,lbnd_in,ubnd_in,nplane,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var) \
+astINVOKE(V,astResampleManyF_(astCheckMapping(this),ndim_in,lbnd_in,ubnd_in,nplane,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var,STATUS_PTR))
+#define astResample8F(this,ndim_in,lbnd_in,ubnd_in,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var) \
+astINVOKE(V,astResample8F_(astCheckMapping(this),ndim_in,lbnd_in,ubnd_in,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var,STATUS_PTR))
+#define astResampleManyL(this,ndim_in,lbnd_in,ubnd_in,nplane,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var) \
+astINVOKE(V,astResampleManyL_(astCheckMapping(this),ndim_in,lbnd_in,ubnd_in,nplane,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var,STATUS_PTR))
+#define astResample8L(this,ndim_in,lbnd_in,ubnd_in,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var) \
+astINVOKE(V,astResample8L_(astCheckMapping(this),ndim_in,lbnd_in,ubnd_in,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var,STATUS_PTR))
+#define astResampleManyUL(this,ndim_in,lbnd_in,ubnd_in,nplane,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var) \
+astINVOKE(V,astResampleManyUL_(astCheckMapping(this),ndim_in,lbnd_in,ubnd_in,nplane,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var,STATUS_PTR))
+#define astResample8UL(this,ndim_in,lbnd_in,ubnd_in,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var) \
+astINVOKE(V,astResample8UL_(astCheckMapping(this),ndim_in,lbnd_in,ubnd_in,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var,STATUS_PTR))
+#define astResampleManyI(this,ndim_in,lbnd_in,ubnd_in,nplane,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var) \
+astINVOKE(V,astResampleManyI_(astCheckMapping(this),ndim_in,lbnd_in,ubnd_in,nplane,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var,STATUS_PTR))
+#define astResample8I(this,ndim_in,lbnd_in,ubnd_in,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var) \
+astINVOKE(V,astResample8I_(astCheckMapping(this),ndim_in,lbnd_in,ubnd_in,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var,STATUS_PTR))
+#define astResampleManyUI(this,ndim_in,lbnd_in,ubnd_in,nplane,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var) \
+astINVOKE(V,astResampleManyUI_(astCheckMapping(this),ndim_in,lbnd_in,ubnd_in,nplane,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var,STATUS_PTR))
+#define astResample8UI(this,ndim_in,lbnd_in,ubnd_in,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var) \
+astINVOKE(V,astResample8UI_(astCheckMapping(this),ndim_in,lbnd_in,ubnd_in,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var,STATUS_PTR))
+#define astResampleManyK(this,ndim_in,lbnd_in,ubnd_in,nplane,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var) \
+astINVOKE(V,astResampleManyK_(astCheckMapping(this),ndim_in,lbnd_in,ubnd_in,nplane,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var,STATUS_PTR))
+#define astResample8K(this,ndim_in,lbnd_in,ubnd_in,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var) \
+astINVOKE(V,astResample8K_(astCheckMapping(this),ndim_in,lbnd_in,ubnd_in,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var,STATUS_PTR))
+#define astResampleManyUK(this,ndim_in,lbnd_in,ubnd_in,nplane,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var) \
+astINVOKE(V,astResampleManyUK_(astCheckMapping(this),ndim_in,lbnd_in,ubnd_in,nplane,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var,STATUS_PTR))
+#define astResample8UK(this,ndim_in,lbnd_in,ubnd_in,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var) \
+astINVOKE(V,astResample8UK_(astCheckMapping(this),ndim_in,lbnd_in,ubnd_in,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var,STATUS_PTR))
+#define astResampleManyS(this,ndim_in,lbnd_in,ubnd_in,nplane,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var) \
+astINVOKE(V,astResampleManyS_(astCheckMapping(this),ndim_in,lbnd_in,ubnd_in,nplane,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var,STATUS_PTR))
+#define astResample8S(this,ndim_in,lbnd_in,ubnd_in,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var) \
+astINVOKE(V,astResample8S_(astCheckMapping(this),ndim_in,lbnd_in,ubnd_in,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var,STATUS_PTR))
+#define astResampleManyUS(this,ndim_in,lbnd_in,ubnd_in,nplane,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var) \
+astINVOKE(V,astResampleManyUS_(astCheckMapping(this),ndim_in,lbnd_in,ubnd_in,nplane,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var,STATUS_PTR))
+#define astResample8US(this,ndim_in,lbnd_in,ubnd_in,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var) \
+astINVOKE(V,astResample8US_(astCheckMapping(this),ndim_in,lbnd_in,ubnd_in,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var,STATUS_PTR))
+#define astResampleManyB(this,ndim_in,lbnd_in,ubnd_in,nplane,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var) \
+astINVOKE(V,astResampleManyB_(astCheckMapping(this),ndim_in,lbnd_in,ubnd_in,nplane,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var,STATUS_PTR))
+#define astResample8B(this,ndim_in,lbnd_in,ubnd_in,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var) \
+astINVOKE(V,astResample8B_(astCheckMapping(this),ndim_in,lbnd_in,ubnd_in,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var,STATUS_PTR))
+#define astResampleManyUB(this,ndim_in,lbnd_in,ubnd_in,nplane,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var) \
+astINVOKE(V,astResampleManyUB_(astCheckMapping(this),ndim_in,lbnd_in,ubnd_in,nplane,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var,STATUS_PTR))
+#define astResample8UB(this,ndim_in,lbnd_in,ubnd_in,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var) \
+astINVOKE(V,astResample8UB_(astCheckMapping(this),ndim_in,lbnd_in,ubnd_in,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var,STATUS_PTR))
+#define astChebyApprox(this,lbnd,ubnd,acc,maxorder,maxtile,fitacc) \
+astINVOKE(O,astChebyApprox_(astCheckMapping(this),lbnd,ubnd,acc,maxorder,maxtile,fitacc,STATUS_PTR))
+#define astCompile(this) astINVOKE(O,astCompile_(astCheckMapping(this),STATUS_PTR))
+#define astJacobian(this,npoint,ncoord_in,indim,in,forward,jacdim,jac) \
+astINVOKE(V,astJacobian_(astCheckMapping(this),npoint,ncoord_in,indim,in,forward,jacdim,jac,STATUS_PTR))
 #define astRemoveRegions(this) astINVOKE(O,astRemoveRegions_(astCheckMapping(this),STATUS_PTR))
 #define astSimplify(this) astINVOKE(O,astSimplify_(astCheckMapping(this),STATUS_PTR))
 #define astTran1(this,npoint,xin,forward,xout) \
@@ -779,6 +912,10 @@ astINVOKE(V,astTran1_(astCheckMapping(this),npoint,xin,forward,xout,STATUS_PTR))
 astINVOKE(V,astTran2_(astCheckMapping(this),npoint,xin,yin,forward,xout,yout,STATUS_PTR))
 #define astTranGrid(this,ncoord_in,lbnd,ubnd,tol,maxpix,forward,ncoord_out,outdim,out) \
 astINVOKE(V,astTranGrid_(astCheckMapping(this),ncoord_in,lbnd,ubnd,tol,maxpix,forward,ncoord_out,outdim,out,STATUS_PTR))
+#define astTranGridF(this,ncoord_in,lbnd,ubnd,tol,maxpix,forward,ncoord_out,outdim,out,badval) \
+astINVOKE(V,astTranGridF_(astCheckMapping(this),ncoord_in,lbnd,ubnd,tol,maxpix,forward,ncoord_out,outdim,out,badval,STATUS_PTR))
+#define astTranGrid8(this,ncoord_in,lbnd,ubnd,tol,maxpix,forward,ncoord_out,outdim,out) \
+astINVOKE(V,astTranGrid8_(astCheckMapping(this),ncoord_in,lbnd,ubnd,tol,maxpix,forward,ncoord_out,outdim,out,STATUS_PTR))
 #define astTranN(this,npoint,ncoord_in,indim,in,forward,ncoord_out,outdim,out) \
 astINVOKE(V,astTranN_(astCheckMapping(this),npoint,ncoord_in,indim,in,forward,ncoord_out,outdim,out,STATUS_PTR))
 #define astTranP(this,npoint,ncoord_in,ptr_in,forward,ncoord_out,ptr_out) \
@@ -806,6 +943,11 @@ astINVOKE(V,astMapSplitId_(astCheckMapping(this),nin,in,out,map,STATUS_PTR))
 
 #if defined(astCLASS)            /* Protected */
 #define astRateState(disabled) astRateState_(disabled,STATUS_PTR)
+#define astSlabPix(newval) astSlabPix_(newval,STATUS_PTR)
+#define astResetSimplify(this) \
+astINVOKE(V,astResetSimplify_(astCheckMapping(this),STATUS_PTR))
+#define astCopyIfFrozen(this,invert) \
+astINVOKE(O,astCopyIfFrozen_(astCheckMapping(this),invert,STATUS_PTR))
 #define astClearInvert(this) \
 astINVOKE(V,astClearInvert_(astCheckMapping(this),STATUS_PTR))
 #define astClearReport(this) \
@@ -842,12 +984,18 @@ astINVOKE(V,astTestInvert_(astCheckMapping(this),STATUS_PTR))
 astINVOKE(V,astTestReport_(astCheckMapping(this),STATUS_PTR))
 #define astDoNotSimplify(this) \
 astINVOKE(V,astDoNotSimplify_(astCheckMapping(this),STATUS_PTR))
+#define astThreadSafe(this) \
+astINVOKE(V,astThreadSafe_(astCheckMapping(this),STATUS_PTR))
 
 /* Since a NULL PointSet pointer is acceptable here, we must omit the argument
    checking in that case. (But unfortunately, "out" then gets evaluated
    twice - this is unlikely to matter, but is there a better way?) */
 #define astTransform(this,in,forward,out) \
 astINVOKE(O,astTransform_(astCheckMapping(this),astCheckPointSet(in),forward,(out)?astCheckPointSet(out):NULL,STATUS_PTR))
+#define astJacobianPoints(this,in,forward,jac) \
+astINVOKE(O,astJacobianPoints_(astCheckMapping(this),astCheckPointSet(in),forward,(jac)?astCheckPointSet(jac):NULL,STATUS_PTR))
+#define astLinearJacobian(in,nout,matrix,jac) \
+astLinearJacobian_(astCheckPointSet(in),nout,matrix,astCheckPointSet(jac),STATUS_PTR)
 #endif
 #endif
 
@@ -333,6 +333,11 @@ typedef enum {
    OP_OR,                        /* Boolean OR */
    OP_XOR,                       /* Boolean exclusive OR */
 
+/* Fused operations (generated only by the code optimiser). */
+   OP_MULADD,                    /* Multiply then add [= x1*x2+x3] */
+   OP_ADDMUL,                    /* Add a product [= x1+x2*x3] */
+   OP_STVAR,                     /* Store result in a temporary variable */
+
 /* Null operation. */
    OP_NULL                       /* Null operation */
 } Oper;
@@ -354,6 +359,29 @@ typedef struct {
    const Oper opcode;            /* Resulting operation code */
 } Symbol;
 
+/* This structure describes a node in the expression graph built by the
+   OptimiseCode function from the opcodes of a set of compiled functions. */
+typedef struct {
+   Oper op;                      /* Operation code */
+   double con;                   /* Constant consumed by the opcode */
+   int arg;                      /* Index of first argument in argument list */
+   int narg;                     /* Number of arguments */
+   int next;                     /* Next node with the same operation code */
+   int nuse;                     /* Number of references to the node */
+   int random;                   /* Does the node use random numbers? */
+   int var;                      /* Variable holding node value (or -1) */
+} CodeNode;
+
+/* This structure holds the opcodes and constants for a function while
+   they are being generated by the OptimiseCode function. */
+typedef struct {
+   int *code;                    /* Opcodes (first element is the count) */
+   double *con;                  /* Constants */
+   int ncon;                     /* Number of constants */
+   int depth;                    /* Current stack depth */
+   int maxdepth;                 /* Maximum stack depth */
+} CodeBuffer;
+
 /* This initialises an array of Symbol structures to hold data on all
    the supported symbols. The order is not important, but symbols are
    arranged here in approximate order of descending evaluation
@@ -599,10 +627,13 @@ static double Poisson( Rcontext *, double, int * );
 static double Rand( Rcontext *, int * );
 static int DefaultSeed( const Rcontext *, int * );
 static int Equal( AstObject *, AstObject *, int * );
+static int ThreadSafe( AstMapping *, int * );
 static int GetSeed( AstMathMap *, int * );
 static int GetSimpFI( AstMathMap *, int * );
 static int GetSimpIF( AstMathMap *, int * );
+static int MakeNode( CodeNode **, int *, int **, int *, int *, Oper, double, int, const int *, int * );
 static int MapMerge( AstMapping *, int, int, int *, AstMapping ***, int **, int * );
+static int OpcodeArgs( Oper, double );
 static int TestAttrib( AstObject *, const char *, int * );
 static int TestSeed( AstMathMap *, int * );
 static int TestSimpFI( AstMathMap *, int * );
@@ -613,14 +644,18 @@ static void ClearSeed( AstMathMap *, int * );
 static void ClearSimpFI( AstMathMap *, int * );
 static void ClearSimpIF( AstMathMap *, int * );
 static void CompileExpression( const char *, const char *, const char *, int, const char *[], int **, double **, int *, int * );
-static void CompileMapping( const char *, const char *, int, int, int, const char *[], int, const char *[], int ***, int ***, double ***, double ***, int *, int *, int * );
+static void CompileMapping( const char *, const char *, int, int, int, const char *[], int, const char *[], int ***, int ***, double ***, double ***, int *, int *, int *, int *, int * );
 static void Copy( const AstObject *, AstObject *, int * );
+static void CountUses( CodeNode *, const int *, int );
 static void Delete( AstObject *, int * );
 static void Dump( AstObject *, AstChannel *, int * );
+static void EmitNode( CodeNode *, const int *, int, int, int *, CodeBuffer *, int * );
+static void EmitOpcode( CodeBuffer *, Oper, double, int * );
 static void EvaluateFunction( Rcontext *, int, const double **, const int *, const double *, int, double *, int * );
 static void EvaluationSort( const double [], int, int [], int **, int *, int * );
 static void ExtractExpressions( const char *, const char *, int, const char *[], int, char ***, int * );
 static void ExtractVariables( const char *, const char *, int, const char *[], int, int, int, int, int, char ***, int * );
+static void OptimiseCode( int, int, int **, double **, int *, int *, int * );
 static void ParseConstant( const char *, const char *, const char *, int, int *, double *, int * );
 static void ParseName( const char *, int, int *, int * );
 static void ParseVariable( const char *, const char *, const char *, int, int, const char *[], int *, int *, int * );
@@ -1138,7 +1173,8 @@ static void CompileMapping( const char *method, const char *class,
                             int ninv, const char *invfun[],
                             int ***fwdcode, int ***invcode,
                             double ***fwdcon, double ***invcon,
-                            int *fwdstack, int *invstack, int *status ) {
+                            int *fwdstack, int *invstack,
+                            int *fwdtemp, int *invtemp, int *status ) {
 /*
 *  Name:
 *     CompileMapping
@@ -1157,7 +1193,8 @@ static void CompileMapping( const char *method, const char *class,
 *                          int ninv, const char *invfun[],
 *                          int ***fwdcode, int ***invcode,
 *                          double ***fwdcon, double ***invcon,
-*                          int *fwdstack, int *invstack, int *status )
+*                          int *fwdstack, int *invstack,
+*                          int *fwdtemp, int *invtemp, int *status )
 
 *  Class Membership:
 *     MathMap member function.
@@ -1166,7 +1203,8 @@ static void CompileMapping( const char *method, const char *class,
 *     This function checks and compiles the transformation functions required
 *     to create a MathMap. It produces sequences of operation codes (opcodes)
 *     and numerical constants which may subsequently be used to evaluate the
-*     functions on a push-down stack.
+*     functions on a push-down stack. The code for each transformation
+*     direction is optimised (see OptimiseCode).
 
 *  Parameters:
 *     method
@@ -1259,14 +1297,23 @@ static void CompileMapping( const char *method, const char *class,
 *     invstack
 *        Pointer to an int in which to return the size of the push-down stack
 *        required to evaluate the inverse transformation functions.
+*     fwdtemp
+*        Pointer to an int in which to return the number of temporary
+*        variables required to evaluate the forward transformation
+*        functions, in addition to the variables they define.
+*     invtemp
+*        Pointer to an int in which to return the number of temporary
+*        variables required to evaluate the inverse transformation
+*        functions, in addition to the variables they define.
 *     status
 *        Pointer to the inherited status variable.
 
 *  Notes:
 *     - A value of NULL will be returned for the "*fwdcode", "*invcode",
 *     "*fwdcon" and "*invcon" pointers and a value of zero will be returned
-*     for the "*fwdstack" and "*invstack" values if this function is invoked
-*     with the global error status set, or if it should fail for any reason.
+*     for the "*fwdstack", "*invstack", "*fwdtemp" and "*invtemp" values if
+*     this function is invoked with the global error status set, or if it
+*     should fail for any reason.
 */
 
 /* Local Variables: */
@@ -1284,6 +1331,8 @@ static void CompileMapping( const char *method, const char *class,
    *invcon = NULL;
    *fwdstack = 0;
    *invstack = 0;
+   *fwdtemp = 0;
+   *invtemp = 0;
    nvar = 0;
 
 /* Check the global error status. */
@@ -1360,6 +1409,10 @@ static void CompileMapping( const char *method, const char *class,
             *fwdstack = ( *fwdstack > stacksize ) ? *fwdstack : stacksize;
          }
       }
+
+/* Optimise the resulting code, sharing common sub-expressions between
+   all the forward functions. */
+      OptimiseCode( nin, nfwd, *fwdcode, *fwdcon, fwdstack, fwdtemp, status );
    }
 
 /* Free the memory containing the extracted expressions and variables. */
@@ -1433,6 +1486,10 @@ static void CompileMapping( const char *method, const char *class,
             *invstack = ( *invstack > stacksize ) ? *invstack : stacksize;
          }
       }
+
+/* Optimise the resulting code, sharing common sub-expressions between
+   all the inverse functions. */
+      OptimiseCode( nout, ninv, *invcode, *invcon, invstack, invtemp, status );
    }
 
 /* Free the memory containing the extracted expressions and variables. */
@@ -1448,6 +1505,56 @@ static void CompileMapping( const char *method, const char *class,
       FREE_POINTER_ARRAY( *invcon, ninv )
       *fwdstack = 0;
       *invstack = 0;
+      *fwdtemp = 0;
+      *invtemp = 0;
+   }
+}
+
+static void CountUses( CodeNode *node, const int *args, int inode ) {
+/*
+*  Name:
+*     CountUses
+
+*  Purpose:
+*     Count the references to each node in an expression graph.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "mathmap.h"
+*     void CountUses( CodeNode *node, const int *args, int inode )
+
+*  Class Membership:
+*     MathMap member function.
+
+*  Description:
+*     This function records a single reference to a node in the
+*     expression graph built by OptimiseCode. If this is the first
+*     reference to the node, it is also applied recursively to each of the
+*     node's arguments. On exit, the "nuse" component of each node that
+*     can be reached from the roots passed to this function holds the
+*     number of times its value is required.
+
+*  Parameters:
+*     node
+*        Pointer to the array of nodes. The "nuse" components should be
+*        zero on the first invocation.
+*     args
+*        Pointer to the array holding the argument indices for all nodes.
+*     inode
+*        Index of the node being referenced.
+*/
+
+/* Local Variables: */
+   int iarg;                     /* Loop counter for arguments */
+
+/* Increment the reference count. If this is the first reference, also
+   count the references made by this node to its arguments. */
+   if ( node[ inode ].nuse++ == 0 ) {
+      for ( iarg = 0; iarg < node[ inode ].narg; iarg++ ) {
+         CountUses( node, args, args[ node[ inode ].arg + iarg ] );
+      }
    }
 }
 
@@ -1561,6 +1668,185 @@ static int DefaultSeed( const Rcontext *context, int *status ) {
    return (int) bits;
 }
 
+static void EmitNode( CodeNode *node, const int *args, int inode,
+                      int rootvar, int *tempvar, CodeBuffer *buf,
+                      int *status ) {
+/*
+*  Name:
+*     EmitNode
+
+*  Purpose:
+*     Generate the opcodes which evaluate a node in an expression graph.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "mathmap.h"
+*     void EmitNode( CodeNode *node, const int *args, int inode,
+*                    int rootvar, int *tempvar, CodeBuffer *buf,
+*                    int *status )
+
+*  Class Membership:
+*     MathMap member function.
+
+*  Description:
+*     This function appends to a buffer the opcodes and constants needed
+*     to evaluate a node in the expression graph built by OptimiseCode,
+*     leaving the node's value on the top of the evaluation stack.
+*
+*     If the node's value has already been stored in a variable, it is
+*     simply loaded from that variable. Otherwise, the node's arguments
+*     are evaluated recursively, followed by the node's own opcode. A
+*     product whose value is needed only by a sum is combined with the
+*     sum into a single fused opcode. If the node's value is needed
+*     more than once, it is then stored in a variable for later re-use.
+
+*  Parameters:
+*     node
+*        Pointer to the array of nodes. The "var" component of the node
+*        is updated if its value is stored in a variable.
+*     args
+*        Pointer to the array holding the argument indices for all nodes.
+*     inode
+*        Index of the node to be evaluated.
+*     rootvar
+*        The index of the variable which will receive the value of the
+*        function being evaluated, if the node is the root of that
+*        function. Otherwise -1.
+*     tempvar
+*        Pointer to an int holding the index of the next unused
+*        temporary variable. It is incremented if a temporary variable is
+*        used to store the node's value.
+*     buf
+*        Pointer to the buffer which receives the opcodes and constants.
+*     status
+*        Pointer to the inherited status variable.
+*/
+
+/* Local Variables: */
+   CodeNode *this;               /* Pointer to node being evaluated */
+   const int *argv;              /* Pointer to node argument indices */
+   const int *mulargv;           /* Pointer to product argument indices */
+   int iarg;                     /* Loop counter for arguments */
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* If the node's value is already available in a variable, just load
+   it. */
+   this = node + inode;
+   if ( this->var >= 0 ) {
+      EmitOpcode( buf, OP_LDVAR, (double) this->var, status );
+      return;
+   }
+
+/* Sums in which one of the arguments is a product that is not needed
+   anywhere else are evaluated using a fused opcode. The arguments are
+   still evaluated in their original order. */
+   argv = args + this->arg;
+   if ( this->op == OP_ADD && node[ argv[ 0 ] ].op == OP_MUL &&
+        node[ argv[ 0 ] ].nuse == 1 ) {
+      mulargv = args + node[ argv[ 0 ] ].arg;
+      EmitNode( node, args, mulargv[ 0 ], -1, tempvar, buf, status );
+      EmitNode( node, args, mulargv[ 1 ], -1, tempvar, buf, status );
+      EmitNode( node, args, argv[ 1 ], -1, tempvar, buf, status );
+      EmitOpcode( buf, OP_MULADD, 0.0, status );
+
+   } else if ( this->op == OP_ADD && node[ argv[ 1 ] ].op == OP_MUL &&
+               node[ argv[ 1 ] ].nuse == 1 ) {
+      mulargv = args + node[ argv[ 1 ] ].arg;
+      EmitNode( node, args, argv[ 0 ], -1, tempvar, buf, status );
+      EmitNode( node, args, mulargv[ 0 ], -1, tempvar, buf, status );
+      EmitNode( node, args, mulargv[ 1 ], -1, tempvar, buf, status );
+      EmitOpcode( buf, OP_ADDMUL, 0.0, status );
+
+/* Otherwise, evaluate each argument and then apply the node's own
+   opcode. */
+   } else {
+      for ( iarg = 0; iarg < this->narg; iarg++ ) {
+         EmitNode( node, args, argv[ iarg ], -1, tempvar, buf, status );
+      }
+      EmitOpcode( buf, this->op, this->con, status );
+   }
+
+/* If the node's value will be needed again, note the variable that will
+   hold it. A function's own result is held in the variable it defines,
+   but any other value must be copied into a new temporary variable. */
+   if ( this->nuse > 1 && this->narg > 0 ) {
+      if ( rootvar >= 0 ) {
+         this->var = rootvar;
+      } else {
+         this->var = ( *tempvar )++;
+         EmitOpcode( buf, OP_STVAR, (double) this->var, status );
+      }
+   }
+}
+
+static void EmitOpcode( CodeBuffer *buf, Oper op, double con, int *status ) {
+/*
+*  Name:
+*     EmitOpcode
+
+*  Purpose:
+*     Append an opcode to a buffer.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "mathmap.h"
+*     void EmitOpcode( CodeBuffer *buf, Oper op, double con, int *status )
+
+*  Class Membership:
+*     MathMap member function.
+
+*  Description:
+*     This function appends an opcode to the buffer used by OptimiseCode
+*     to accumulate the code for a function. If the opcode consumes a
+*     constant, the constant is appended to the buffer's constants. The
+*     current and maximum evaluation stack sizes are also updated.
+
+*  Parameters:
+*     buf
+*        Pointer to the buffer.
+*     op
+*        The opcode.
+*     con
+*        The constant consumed by the opcode. Ignored if the opcode does
+*        not consume a constant.
+*     status
+*        Pointer to the inherited status variable.
+*/
+
+/* Local Variables: */
+   int ncode;                    /* New number of opcodes */
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* Extend the opcode array and store the new opcode, updating the count
+   held in the first element. */
+   ncode = buf->code[ 0 ] + 1;
+   buf->code = astGrow( buf->code, ncode + 1, sizeof( int ) );
+   if ( astOK ) {
+      buf->code[ ncode ] = (int) op;
+      buf->code[ 0 ] = ncode;
+
+/* If required, extend the constants array and store the constant. */
+      if ( op == OP_LDCON || op == OP_LDVAR || op == OP_STVAR ||
+           op == OP_MAX || op == OP_MIN ) {
+         buf->con = astGrow( buf->con, buf->ncon + 1, sizeof( double ) );
+         if ( astOK ) buf->con[ buf->ncon++ ] = con;
+      }
+
+/* Each opcode replaces its arguments on the stack with a single
+   result. */
+      buf->depth += 1 - OpcodeArgs( op, con );
+      if ( buf->depth > buf->maxdepth ) buf->maxdepth = buf->depth;
+   }
+}
+
 static int Equal( AstObject *this_object, AstObject *that_object, int *status ) {
 /*
 *  Name:
@@ -1723,6 +2009,7 @@ static int Equal( AstObject *this_object, AstObject *that_object, int *status )
 
                   } else if( code == OP_LDCON ||
                              code == OP_LDVAR ||
+                             code == OP_STVAR ||
                              code == OP_MAX ||
                              code == OP_MIN ) {
 
@@ -1788,7 +2075,9 @@ static void EvaluateFunction( Rcontext *rcontext, int npoint,
 *        Pointer to an array of pointers to arrays of double (with "npoint"
 *        elements). These arrays should contain the input coordinate values,
 *        such that coordinate number "coord" for point number "point" can be
-*        found in "ptr_in[coord][point]".
+*        found in "ptr_in[coord][point]". Any arrays used to hold
+*        temporary variables (see OptimiseCode) are written to by the
+*        OP_STVAR opcode.
 *     code
 *        Pointer to an array of int containing the set of opcodes (cast to int)
 *        for the operations to be performed. The first element of this array
@@ -2118,6 +2407,44 @@ static void EvaluateFunction( Rcontext *rcontext, int npoint,
 /* Break out of the "case" block. */ \
       break;
 
+/* Three-argument operation. */
+/* ------------------------- */
+/* This macro performs a three-argument operation, which processes the
+   top three stack elements and produces a single result, resulting in
+   the stack size decreasing by two. The result is bad if any argument
+   is bad. */
+#define ARG_3(oper,function) \
+\
+/* Test for the required opcode value. */ \
+   case oper: \
+\
+/* Obtain pointers to the top three stack elements (vectors), decreasing \
+   the top of stack index by two. */ \
+      xv3 = stack[ tos-- ]; \
+      xv2 = stack[ tos-- ]; \
+      xv1 = stack[ tos ]; \
+\
+/* Loop to access each vector element, obtaining the argument values and \
+   a pointer to the element which is to receive the result. */ \
+      for ( point = 0; point < npoint; point++ ) { \
+         x1 = xv1[ point ]; \
+         x2 = xv2[ point ]; \
+         x3 = xv3[ point ]; \
+         y = xv1 + point; \
+\
+/* Perform the processing if no argument is bad, otherwise the result \
+   is bad. */ \
+         if ( ( x1 != AST__BAD ) && ( x2 != AST__BAD ) && \
+              ( x3 != AST__BAD ) ) { \
+            {function;} \
+         } else { \
+            *y = AST__BAD; \
+         } \
+      } \
+\
+/* Break out of the "case" block. */ \
+      break;
+
 /* Define arithmetic operations. */
 /* ============================= */
 /* We now define macros for performing some of the arithmetic
@@ -2720,6 +3047,29 @@ static void EvaluateFunction( Rcontext *rcontext, int npoint,
             ARG_2( OP_EQV,      *y = ( ( x1 != 0.0 ) == ( x2 != 0.0 ) ) )
             ARG_2B( OP_OR,      *y = TRISTATE_OR( x1, x2 ) )
             ARG_2( OP_XOR,      *y = ( ( x1 != 0.0 ) != ( x2 != 0.0 ) ) )
+
+/* Fused operations. */
+/* ----------------- */
+/* These combine a multiplication and an addition, giving the same
+   result as the separate operations. */
+            ARG_3( OP_MULADD,   *y = ( ( result = SAFE_MUL( x1, x2 ) ) ==
+                                       AST__BAD ) ? AST__BAD :
+                                     SAFE_ADD( result, x3 ) )
+            ARG_3( OP_ADDMUL,   *y = ( ( result = SAFE_MUL( x2, x3 ) ) ==
+                                       AST__BAD ) ? AST__BAD :
+                                     SAFE_ADD( x1, result ) )
+
+/* Storing a temporary variable involves obtaining the variable's index
+   by consuming a constant, and then copying the top of stack element
+   into the variable's values (leaving the stack unchanged). */
+            case OP_STVAR:
+               ivar = (int) ( con[ icon++ ] + 0.5 );
+               xv = stack[ tos ];
+               yv = (double *) ptr_in[ ivar ];
+               for ( point = 0; point < npoint; point++ ) {
+                  yv[ point ] = xv[ point ];
+               }
+               break;
          }
       }
    }
@@ -2739,6 +3089,7 @@ static void EvaluateFunction( Rcontext *rcontext, int npoint,
 #undef DO_ARG_2
 #undef ARG_2
 #undef ARG_2B
+#undef ARG_3
 #undef ABS
 #undef INT
 #undef CATCH_MATHS_OVERFLOW
@@ -3743,6 +4094,7 @@ void astInitMathMapVtab_(  AstMathMapVtab *vtab, const char *name, int *status )
    new member functions implemented here. */
    object->Equal = Equal;
    mapping->MapMerge = MapMerge;
+   mapping->ThreadSafe = ThreadSafe;
 
 /* Declare the copy constructor, destructor and class dump function. */
    astSetCopy( vtab, Copy );
@@ -3852,6 +4204,191 @@ static double LogGamma( double x, int *status ) {
    return result;
 }
 
+static int MakeNode( CodeNode **node, int *nnode, int **args, int *nargs,
+                     int *head, Oper op, double con, int narg,
+                     const int *argv, int *status ) {
+/*
+*  Name:
+*     MakeNode
+
+*  Purpose:
+*     Add an operation to an expression graph.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "mathmap.h"
+*     int MakeNode( CodeNode **node, int *nnode, int **args, int *nargs,
+*                   int *head, Oper op, double con, int narg,
+*                   const int *argv, int *status )
+
+*  Class Membership:
+*     MathMap member function.
+
+*  Description:
+*     This function returns the node in the expression graph built by
+*     OptimiseCode which represents the result of applying an operation
+*     to a set of existing nodes. The following simplifications are
+*     made before a node is created:
+*
+*     - "x*x" and "x**2" are replaced by "sqr(x)".
+*     - "qif(c,a,b)" is replaced by "a" or "b" if "c" is a constant (so
+*     long as the discarded expression does not use random numbers).
+*     - Operations on constant arguments are evaluated immediately (by
+*     EvaluateFunction, so that the result is identical to that which
+*     would otherwise be obtained) and replaced by the resulting
+*     constant. Operations involving random numbers are excluded.
+*
+*     An existing node is then returned if it represents the same
+*     operation applied to the same arguments, so that common
+*     sub-expressions are represented by a single node. Operations
+*     involving random numbers always produce a new node.
+
+*  Parameters:
+*     node
+*        Address of a pointer to the array of nodes. The array is
+*        extended if a new node is created.
+*     nnode
+*        Pointer to the number of nodes in the array.
+*     args
+*        Address of a pointer to the array holding the argument indices
+*        for all nodes. The array is extended if a new node is created.
+*     nargs
+*        Pointer to the number of elements in the "args" array.
+*     head
+*        Pointer to an array, indexed by opcode, holding the index of the
+*        most recently created node for each opcode (or -1).
+*     op
+*        The opcode.
+*     con
+*        The constant consumed by the opcode (or zero).
+*     narg
+*        The number of arguments.
+*     argv
+*        Pointer to an array holding the node index for each argument.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     The index of the node.
+
+*  Notes:
+*     - A value of -1 will be returned if this function is invoked with
+*     the global error status set, or if it should fail for any reason.
+*/
+
+/* Local Variables: */
+   CodeNode *new;                /* Pointer to new node */
+   const CodeNode *that;         /* Pointer to existing node */
+   double *tcon;                 /* Constants for evaluating a constant */
+   int *tcode;                   /* Opcodes for evaluating a constant */
+   int fold;                     /* Replace node by a constant? */
+   int iarg;                     /* Loop counter for arguments */
+   int inode;                    /* Index of existing node */
+   int random;                   /* Does the node use random numbers? */
+   int result;                   /* Returned node index */
+
+/* Initialise. */
+   result = -1;
+
+/* Check the global error status. */
+   if ( !astOK ) return result;
+
+/* Replace the square of any argument with the equivalent OP_SQR
+   operation. */
+   if ( ( op == OP_MUL && argv[ 0 ] == argv[ 1 ] ) ||
+        ( op == OP_POW && ( *node )[ argv[ 1 ] ].op == OP_LDCON &&
+                          ( *node )[ argv[ 1 ] ].con == 2.0 ) ) {
+      op = OP_SQR;
+      narg = 1;
+
+/* If a "qif" condition is constant, the result is simply one of the
+   other two arguments. */
+   } else if ( op == OP_QIF && ( *node )[ argv[ 0 ] ].op == OP_LDCON ) {
+      if ( ( *node )[ argv[ 0 ] ].con ) {
+         if ( !( *node )[ argv[ 2 ] ].random ) result = argv[ 1 ];
+      } else {
+         if ( !( *node )[ argv[ 1 ] ].random ) result = argv[ 2 ];
+      }
+      if ( result != -1 ) return result;
+   }
+
+/* See if the operation, or any of its arguments, uses random numbers,
+   and whether all the arguments are constant. */
+   random = ( op == OP_GAUSS || op == OP_POISS || op == OP_RAND );
+   fold = !random && ( op != OP_LDCON ) && ( op != OP_LDVAR );
+   for ( iarg = 0; iarg < narg; iarg++ ) {
+      that = *node + argv[ iarg ];
+      if ( that->random ) random = 1;
+      if ( that->op != OP_LDCON ) fold = 0;
+   }
+
+/* If the result is constant, evaluate it now using the same code that
+   would otherwise evaluate it for each point, and replace the operation
+   by a constant. */
+   if ( fold ) {
+      tcode = astMalloc( sizeof( int ) * (size_t) ( narg + 2 ) );
+      tcon = astMalloc( sizeof( double ) * (size_t) ( narg + 1 ) );
+      if ( astOK ) {
+         tcode[ 0 ] = narg + 1;
+         for ( iarg = 0; iarg < narg; iarg++ ) {
+            tcode[ iarg + 1 ] = OP_LDCON;
+            tcon[ iarg ] = ( *node )[ argv[ iarg ] ].con;
+         }
+         tcode[ narg + 1 ] = op;
+         tcon[ narg ] = con;
+         EvaluateFunction( NULL, 1, NULL, tcode, tcon, narg ? narg : 1,
+                           &con, status );
+         op = OP_LDCON;
+         narg = 0;
+      }
+      tcode = astFree( tcode );
+      tcon = astFree( tcon );
+   }
+
+/* Search for an existing node which performs the same operation on the
+   same arguments. Nodes which use random numbers are never re-used. */
+   if ( !random ) {
+      for ( inode = head[ op ]; inode != -1 && result == -1;
+            inode = ( *node )[ inode ].next ) {
+         that = *node + inode;
+         if ( that->narg == narg &&
+              !memcmp( &that->con, &con, sizeof( double ) ) ) {
+            for ( iarg = 0; iarg < narg; iarg++ ) {
+               if ( ( *args )[ that->arg + iarg ] != argv[ iarg ] ) break;
+            }
+            if ( iarg == narg ) result = inode;
+         }
+      }
+   }
+
+/* Otherwise, create a new node. */
+   if ( result == -1 && astOK ) {
+      *node = astGrow( *node, *nnode + 1, sizeof( CodeNode ) );
+      if ( narg > 0 ) *args = astGrow( *args, *nargs + narg, sizeof( int ) );
+      if ( astOK ) {
+         new = *node + *nnode;
+         new->op = op;
+         new->con = con;
+         new->arg = *nargs;
+         new->narg = narg;
+         new->next = head[ op ];
+         new->nuse = 0;
+         new->random = random;
+         new->var = -1;
+         for ( iarg = 0; iarg < narg; iarg++ ) {
+            ( *args )[ ( *nargs )++ ] = argv[ iarg ];
+         }
+         head[ op ] = *nnode;
+         result = ( *nnode )++;
+      }
+   }
+
+/* Return the result. */
+   return result;
+}
+
 static int MapMerge( AstMapping *this, int where, int series, int *nmap,
                      AstMapping ***map_list, int **invert_list, int *status ) {
 /*
@@ -4164,6 +4701,227 @@ static int MapMerge( AstMapping *this, int where, int series, int *nmap,
    return result;
 }
 
+static int OpcodeArgs( Oper op, double con ) {
+/*
+*  Name:
+*     OpcodeArgs
+
+*  Purpose:
+*     Return the number of arguments used by an opcode.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "mathmap.h"
+*     int OpcodeArgs( Oper op, double con )
+
+*  Class Membership:
+*     MathMap member function.
+
+*  Description:
+*     This function returns the number of values which an opcode removes
+*     from the evaluation stack before pushing its result.
+
+*  Parameters:
+*     op
+*        The opcode.
+*     con
+*        The constant consumed by the opcode. This is only used for
+*        opcodes which take a variable number of arguments.
+
+*  Returned Value:
+*     The number of arguments.
+*/
+
+/* Local Variables: */
+   int sym;                      /* Loop counter for symbols */
+
+/* Handle the opcodes whose arguments are not described by the symbol
+   table. OP_STVAR leaves the stack unchanged, which is equivalent to
+   taking one argument. */
+   if ( op == OP_MAX || op == OP_MIN ) return (int) ( con + 0.5 );
+   if ( op == OP_MULADD || op == OP_ADDMUL ) return 3;
+   if ( op == OP_STVAR ) return 1;
+
+/* Otherwise, find a symbol which produces the opcode and use its
+   effect on the stack size. */
+   for ( sym = 0; symbol[ sym ].text; sym++ ) {
+      if ( symbol[ sym ].opcode == op ) return 1 - symbol[ sym ].stackincrement;
+   }
+   return 0;
+}
+
+static void OptimiseCode( int nvar, int nfun, int **code, double **con,
+                          int *stacksize, int *ntemp, int *status ) {
+/*
+*  Name:
+*     OptimiseCode
+
+*  Purpose:
+*     Optimise the compiled functions for one direction of a MathMap.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "mathmap.h"
+*     void OptimiseCode( int nvar, int nfun, int **code, double **con,
+*                        int *stacksize, int *ntemp, int *status )
+
+*  Class Membership:
+*     MathMap member function.
+
+*  Description:
+*     This function replaces the opcodes and constants produced by
+*     CompileExpression for all the functions that implement one
+*     direction of a MathMap with equivalent code that requires less
+*     work per point.
+*
+*     The opcodes for all the functions are first combined into a single
+*     expression graph (see MakeNode), in which constant sub-expressions
+*     are evaluated once and identical sub-expressions are represented
+*     by a single node. New code is then generated for each function in
+*     turn (see EmitNode). A sub-expression that is used more than once,
+*     whether in the same function or in different functions, is
+*     evaluated only once and its value is stored in a variable for
+*     later re-use. If it is not the value of a function, a temporary
+*     variable is used. The temporary variables follow the variables
+*     defined by the functions themselves, and must be provided by the
+*     caller of EvaluateFunction.
+*
+*     The optimised code produces the same results as the original code,
+*     except that "x**2" is evaluated as "x*x" (which may differ from
+*     "pow(x,2)" in the least significant bit). Random numbers are drawn
+*     in the same order.
+
+*  Parameters:
+*     nvar
+*        The number of input variables for this direction.
+*     nfun
+*        The number of functions.
+*     code
+*        Pointer to an array of "nfun" pointers to the opcode arrays for
+*        the functions, as produced by CompileExpression. Each opcode
+*        array is freed and replaced by a new one.
+*     con
+*        Pointer to an array of "nfun" pointers to the constant arrays
+*        for the functions, as produced by CompileExpression. Each
+*        constant array is freed and replaced by a new one (which may be
+*        NULL if no constants are needed).
+*     stacksize
+*        Pointer to an int in which to return the size of the stack
+*        required to evaluate any of the optimised functions.
+*     ntemp
+*        Pointer to an int in which to return the number of temporary
+*        variables required to evaluate the optimised functions.
+*     status
+*        Pointer to the inherited status variable.
+*/
+
+/* Local Variables: */
+   CodeBuffer buf;               /* Buffer for optimised code */
+   CodeNode *node;               /* Array of expression graph nodes */
+   Oper op;                      /* Opcode */
+   double value;                 /* Constant consumed by opcode */
+   int *args;                    /* Array of argument node indices */
+   int *head;                    /* Most recent node for each opcode */
+   int *root;                    /* Root node of each function */
+   int *stk;                     /* Stack of node indices */
+   int icode;                    /* Loop counter for opcodes */
+   int icon;                     /* Counter for constants used */
+   int ifun;                     /* Loop counter for functions */
+   int iop;                      /* Loop counter for opcodes */
+   int narg;                     /* Number of opcode arguments */
+   int nargs;                    /* Number of elements in "args" */
+   int nnode;                    /* Number of nodes */
+   int tempvar;                  /* Index of next temporary variable */
+   int tos;                      /* Top of stack index */
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* Initialise. */
+   node = NULL;
+   args = NULL;
+   nnode = 0;
+   nargs = 0;
+   tempvar = nvar + nfun;
+
+/* Allocate work space. */
+   head = astMalloc( sizeof( int ) * (size_t) ( OP_NULL + 1 ) );
+   root = astMalloc( sizeof( int ) * (size_t) nfun );
+   if ( astOK ) {
+      for ( iop = 0; iop <= OP_NULL; iop++ ) head[ iop ] = -1;
+
+/* Build the expression graph by simulating the evaluation of each
+   function's opcodes, using a stack of node indices in place of the
+   stack of values. */
+      for ( ifun = 0; ifun < nfun && astOK; ifun++ ) {
+         stk = astMalloc( sizeof( int ) * (size_t) code[ ifun ][ 0 ] );
+         tos = -1;
+         icon = 0;
+         for ( icode = 1; icode <= code[ ifun ][ 0 ] && astOK; icode++ ) {
+            op = (Oper) code[ ifun ][ icode ];
+            if ( op == OP_NULL ) continue;
+            value = 0.0;
+            if ( op == OP_LDCON || op == OP_LDVAR ||
+                 op == OP_MAX || op == OP_MIN ) value = con[ ifun ][ icon++ ];
+            narg = OpcodeArgs( op, value );
+            tos -= narg;
+            stk[ tos + 1 ] = MakeNode( &node, &nnode, &args, &nargs, head,
+                                       op, value, narg, stk + tos + 1,
+                                       status );
+            tos++;
+         }
+         if ( astOK ) root[ ifun ] = stk[ 0 ];
+         stk = astFree( stk );
+      }
+
+/* Count the number of times the value of each node is required. */
+      if ( astOK ) {
+         for ( ifun = 0; ifun < nfun; ifun++ ) {
+            CountUses( node, args, root[ ifun ] );
+         }
+      }
+
+/* Generate new code for each function in turn, replacing the original
+   opcodes and constants. */
+      *stacksize = 0;
+      for ( ifun = 0; ifun < nfun && astOK; ifun++ ) {
+         buf.code = astMalloc( sizeof( int ) );
+         buf.con = NULL;
+         buf.ncon = 0;
+         buf.depth = 0;
+         buf.maxdepth = 0;
+         if ( astOK ) {
+            buf.code[ 0 ] = 0;
+            EmitNode( node, args, root[ ifun ], nvar + ifun, &tempvar, &buf,
+                      status );
+         }
+         if ( astOK ) {
+            code[ ifun ] = astFree( code[ ifun ] );
+            con[ ifun ] = astFree( con[ ifun ] );
+            code[ ifun ] = buf.code;
+            con[ ifun ] = buf.con;
+            if ( buf.maxdepth > *stacksize ) *stacksize = buf.maxdepth;
+         } else {
+            buf.code = astFree( buf.code );
+            buf.con = astFree( buf.con );
+         }
+      }
+   }
+
+/* Return the number of temporary variables used. */
+   *ntemp = tempvar - nvar - nfun;
+
+/* Free work space. */
+   node = astFree( node );
+   args = astFree( args );
+   head = astFree( head );
+   root = astFree( root );
+}
+
 static void ParseConstant( const char *method, const char *class,
                            const char *exprs, int istart, int *iend,
                            double *con, int *status ) {
@@ -5129,6 +5887,78 @@ static int TestAttrib( AstObject *this_object, const char *attrib, int *status )
    return result;
 }
 
+static int ThreadSafe( AstMapping *this_mapping, int *status ){
+/*
+*  Name:
+*     ThreadSafe
+
+*  Purpose:
+*     Check if a MathMap can transform points in several threads at once.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "mathmap.h"
+*     int ThreadSafe( AstMapping *this, int *status )
+
+*  Class Membership:
+*     MathMap member function (over-rides the protected astThreadSafe
+*     method inherited from the Mapping class).
+
+*  Description:
+*     This function returns zero if any of the MathMap's transformation
+*     functions use a random number generator (since the state of the
+*     generator is stored in the MathMap and is updated each time a random
+*     value is produced). Otherwise it returns a non-zero value.
+
+*  Parameters:
+*     this
+*        Pointer to the MathMap.
+*     status
+*        Pointer to the inherited status variable.
+*/
+
+/* Local Variables: */
+   AstMathMap *this;             /* Pointer to MathMap structure */
+   int **code;                   /* Array of opcode arrays */
+   int icode;                    /* Loop counter for opcodes */
+   int idir;                     /* Loop counter for directions */
+   int ifun;                     /* Loop counter for functions */
+   int nfun;                     /* Number of functions */
+   int opcode;                   /* Current opcode */
+   int result;                   /* Returned flag */
+
+/* Check the global error status. */
+   if ( !astOK ) return 0;
+
+/* Obtain a pointer to the MathMap structure. */
+   this = (AstMathMap *) this_mapping;
+
+/* Search the compiled code for both directions for any opcode that uses
+   the random number generator. */
+   result = 1;
+   for ( idir = 0; idir < 2 && result; idir++ ) {
+      code = idir ? this->invcode : this->fwdcode;
+      nfun = idir ? this->ninv : this->nfwd;
+      if ( !code ) continue;
+      for ( ifun = 0; ifun < nfun && result; ifun++ ) {
+         if ( !code[ ifun ] ) continue;
+         for ( icode = 1; icode <= code[ ifun ][ 0 ]; icode++ ) {
+            opcode = code[ ifun ][ icode ];
+            if ( opcode == OP_GAUSS || opcode == OP_POISS ||
+                 opcode == OP_RAND ) {
+               result = 0;
+               break;
+            }
+         }
+      }
+   }
+
+/* Return the result. */
+   return result;
+}
+
 static AstPointSet *Transform( AstMapping *map, AstPointSet *in,
                                int forward, AstPointSet *out, int *status ) {
 /*
@@ -5184,6 +6014,9 @@ static AstPointSet *Transform( AstMapping *map, AstPointSet *in,
 *     result. Any excess space will be ignored.
 */
 
+/* Local Constants: */
+#define NBLOCK 1024              /* Maximum number of points per block */
+
 /* Local Variables: */
    AstMathMap *this;             /* Pointer to MathMap to be applied */
    AstPointSet *result;          /* Pointer to output PointSet */
@@ -5191,13 +6024,20 @@ static AstPointSet *Transform( AstMapping *map, AstPointSet *in,
    double **ptr_in;              /* Pointer to input coordinate data */
    double **ptr_out;             /* Pointer to output coordinate data */
    double *work;                 /* Workspace for intermediate results */
+   int **code;                   /* Opcodes for each function */
+   int icode;                    /* Loop counter for opcodes */
    int idata;                    /* Loop counter for data pointer elements */
    int ifun;                     /* Loop counter for functions */
+   int nblock;                   /* Number of points in each block */
    int ncoord_in;                /* Number of coordinates per input point */
    int ncoord_out;               /* Number of coordinates per output point */
    int ndata;                    /* Number of data pointer elements filled */
    int nfun;                     /* Number of functions to evaluate */
+   int np;                       /* Number of points in current block */
    int npoint;                   /* Number of points */
+   int ntemp;                    /* Number of temporary variables */
+   int op;                       /* Opcode */
+   int point;                    /* Index of first point in current block */
 
 /* Check the global error status. */
    if ( !astOK ) return NULL;
@@ -5237,27 +6077,54 @@ static AstPointSet *Transform( AstMapping *map, AstPointSet *in,
    calculated. */
    nfun = forward ? this->nfwd : this->ninv;
 
-/* If intermediate results are to be calculated, then allocate
-   workspace to hold them (each intermediate result being a vector of
-   "npoint" double values). */
-   if ( nfun > ncoord_out ) {
+/* Also obtain the number of temporary variables used to hold
+   sub-expressions that are shared between functions. */
+   ntemp = forward ? this->fwdtemp : this->invtemp;
+
+/* The points are transformed in blocks of (at most) NBLOCK points.
+   All the functions are evaluated for one block before moving on to the
+   next. This means that the workspace needed for intermediate results
+   and for the evaluation stack does not depend on the number of points,
+   and is small enough to remain in the processor cache between one
+   operation and the next. However, if any function uses random numbers,
+   then all points are processed as a single block, so that the
+   sequence of random numbers used for each point is unchanged. */
+   code = forward ? this->fwdcode : this->invcode;
+   nblock = ( npoint < NBLOCK ) ? npoint : NBLOCK;
+   for ( ifun = 0; ifun < nfun && nblock < npoint; ifun++ ) {
+      for ( icode = 1; icode <= code[ ifun ][ 0 ]; icode++ ) {
+         op = code[ ifun ][ icode ];
+         if ( op == OP_GAUSS || op == OP_POISS || op == OP_RAND ) {
+            nblock = npoint;
+            break;
+         }
+      }
+   }
+   if ( nblock < 1 ) nblock = 1;
+
+/* If intermediate results or temporary variables are to be calculated,
+   then allocate workspace to hold them (each being a vector of "nblock"
+   double values). */
+   if ( nfun + ntemp > ncoord_out ) {
       work = astMalloc( sizeof( double) *
-                        (size_t) ( npoint * ( nfun - ncoord_out ) ) );
+                        (size_t) ( nblock * ( nfun + ntemp - ncoord_out ) ) );
    }
 
 /* Also allocate space for an array to hold pointers to the input
-   data, intermediate results and output data. */
-   data_ptr = astMalloc( sizeof( double * ) * (size_t) ( ncoord_in + nfun ) );
+   data, intermediate results, output data and temporary variables. */
+   data_ptr = astMalloc( sizeof( double * ) *
+                         (size_t) ( ncoord_in + nfun + ntemp ) );
 
-/* We now set up the "data_ptr" array to locate the data to be
-   processed. */
-   if ( astOK ) {
+/* Loop round each block of points. */
+   for ( point = 0; point < npoint && astOK; point += nblock ) {
+      np = ( npoint - point < nblock ) ? npoint - point : nblock;
 
-/* The first elements of this array point at the input data
-   vectors. */
+/* We now set up the "data_ptr" array to locate the data to be
+   processed. The first elements of this array point at the input data
+   for the current block. */
       ndata = 0;
       for ( idata = 0; idata < ncoord_in; idata++ ) {
-         data_ptr[ ndata++ ] = ptr_in[ idata ];
+         data_ptr[ ndata++ ] = ptr_in[ idata ] + point;
       }
 
 /* The following elements point at successive vectors within the
@@ -5265,13 +6132,19 @@ static AstPointSet *Transform( AstMapping *map, AstPointSet *in,
    arrays for intermediate results, and then as input arrays for
    subsequent calculations which use these results. */
       for ( idata = 0; idata < ( nfun - ncoord_out ); idata++ ) {
-         data_ptr[ ndata++ ] = work + ( idata * npoint );
+         data_ptr[ ndata++ ] = work + ( idata * nblock );
       }
 
-/* The final elements point at the output coordinate data arrays into
-   which the final results will be written. */
+/* The next elements point at the output coordinate data arrays into
+   which the final results for the current block will be written. */
       for ( idata = 0; idata < ncoord_out; idata++ ) {
-         data_ptr[ ndata++ ] = ptr_out[ idata ];
+         data_ptr[ ndata++ ] = ptr_out[ idata ] + point;
+      }
+
+/* Any temporary variables are held in the remainder of the workspace. */
+      for ( idata = 0; idata < ntemp; idata++ ) {
+         data_ptr[ ndata++ ] = work + ( ( nfun - ncoord_out + idata ) *
+                                        nblock );
       }
 
 /* Perform coordinate transformation. */
@@ -5286,9 +6159,8 @@ static AstPointSet *Transform( AstMapping *map, AstPointSet *in,
    "data_ptr" array (skipping the input data elements), while the
    function has access to all previous elements of the "data_ptr" array
    to locate the required input data. */
-         EvaluateFunction( &this->rcontext, npoint, (const double **) data_ptr,
-                           forward ? this->fwdcode[ ifun ] :
-                                     this->invcode[ ifun ],
+         EvaluateFunction( &this->rcontext, np, (const double **) data_ptr,
+                           code[ ifun ],
                            forward ? this->fwdcon[ ifun ] :
                                      this->invcon[ ifun ],
                            forward ? this->fwdstack : this->invstack,
@@ -5299,7 +6171,7 @@ static AstPointSet *Transform( AstMapping *map, AstPointSet *in,
 /* Free the array of data pointers and any workspace allocated for
    intermediate results. */
    data_ptr = astFree( data_ptr );
-   if ( nfun > ncoord_out ) work = astFree( work );
+   if ( nfun + ntemp > ncoord_out ) work = astFree( work );
 
 /* If an error occurred, then return a NULL pointer. If no output
    PointSet was supplied, also delete any new one that may have been
@@ -5310,6 +6182,9 @@ static AstPointSet *Transform( AstMapping *map, AstPointSet *in,
 
 /* Return a pointer to the output PointSet. */
    return result;
+
+/* Undefine macros local to this function. */
+#undef NBLOCK
 }
 
 static void ValidateSymbol( const char *method, const char *class,
@@ -7077,6 +7952,8 @@ AstMathMap *astInitMathMap_( void *mem, size_t size, int init,
    int **invcode;                /* Code for inverse functions */
    int fwdstack;                 /* Stack size for forward functions */
    int invstack;                 /* Stack size for inverse functions */
+   int fwdtemp;                  /* Temporary variables for forward functions */
+   int invtemp;                  /* Temporary variables for inverse functions */
 
 /* Initialise. */
    new = NULL;
@@ -7136,7 +8013,7 @@ AstMathMap *astInitMathMap_( void *mem, size_t size, int init,
                       nfwd, (const char **) fwdfun,
                       ninv, (const char **) invfun,
                       &fwdcode, &invcode, &fwdcon, &invcon,
-                      &fwdstack, &invstack, status );
+                      &fwdstack, &invstack, &fwdtemp, &invtemp, status );
 
 /* Initialise a Mapping structure (the parent class) as the first
    component within the MathMap structure, allocating memory if
@@ -7173,6 +8050,8 @@ AstMathMap *astInitMathMap_( void *mem, size_t size, int init,
          new->invcon = invcon;
          new->fwdstack = fwdstack;
          new->invstack = invstack;
+         new->fwdtemp = fwdtemp;
+         new->invtemp = invtemp;
          new->nfwd = nfwd;
          new->ninv = ninv;
          new->simp_fi = -INT_MAX;
@@ -7400,7 +8279,8 @@ AstMathMap *astLoadMathMap_( void *mem, size_t size,
                             new->ninv, (const char **) new->invfun,
                             &new->fwdcode, &new->invcode,
                             &new->fwdcon, &new->invcon,
-                            &new->fwdstack, &new->invstack, status );
+                            &new->fwdstack, &new->invstack,
+                            &new->fwdtemp, &new->invtemp, status );
          }
 
 /* If an error occurred, clean up by deleting the new MathMap. */
@@ -229,6 +229,8 @@ typedef struct AstMathMap {
    int **invcode;                /* Array of opcodes for inverse functions */
    int fwdstack;                 /* Stack size required by forward functions */
    int invstack;                 /* Stack size required by inverse functions */
+   int fwdtemp;                  /* Temporary variables for forward functions */
+   int invtemp;                  /* Temporary variables for inverse functions */
    int nfwd;                     /* Number of forward functions */
    int ninv;                     /* Number of inverse functions */
    int simp_fi;                  /* Forward-inverse MathMap pairs simplify? */
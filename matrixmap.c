@@ -276,6 +276,7 @@ static AstMatrixMap *MatZoom( AstMatrixMap *, AstZoomMap *, int, int, int * );
 static AstMatrixMap *MtrMult( AstMatrixMap *, AstMatrixMap *, int * );
 static AstMatrixMap *MtrRot( AstMatrixMap *, double, const double[], int * );
 static AstPointSet *Transform( AstMapping *, AstPointSet *, int, AstPointSet *, int * );
+static void JacobianPoints( AstMapping *, AstPointSet *, int, AstPointSet *, int * );
 static AstWinMap *MatWin2( AstMatrixMap *, AstWinMap *, int, int, int, int * );
 static double *InvertMatrix( int, int, int, double *, int * );
 static double Rate( AstMapping *, double *, int, int, int * );
@@ -1315,6 +1316,7 @@ void astInitMatrixMapVtab_(  AstMatrixMapVtab *vtab, const char *name, int *stat
    mapping->GetTranInverse = GetTranInverse;
    mapping->MapMerge = MapMerge;
    mapping->Rate = Rate;
+   mapping->JacobianPoints = JacobianPoints;
 
 /* Declare the destructor and copy constructor. */
    astSetDelete( (AstObjectVtab *) vtab, Delete );
@@ -4105,6 +4107,92 @@ static int PermOK( AstMapping *pm, int *status ){
    return astOK ? ret : 0;
 }
 
+static void JacobianPoints( AstMapping *this, AstPointSet *in, int forward,
+                            AstPointSet *jac, int *status ) {
+/*
+*  Name:
+*     JacobianPoints
+
+*  Purpose:
+*     Find the Jacobian matrix of a Mapping at a set of points.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "matrixmap.h"
+*     void JacobianPoints( AstMapping *this, AstPointSet *in, int forward,
+*                          AstPointSet *jac, int *status )
+
+*  Class Membership:
+*     MatrixMap member function (over-rides the astJacobianPoints protected
+*     method inherited from the Mapping class).
+
+*  Description:
+*     This function stores the Jacobian matrix of a MatrixMap (the
+*     forward or inverse matrix itself) at each of the points in a
+*     PointSet.
+
+*  Parameters:
+*     this
+*        Pointer to the MatrixMap.
+*     in
+*        Pointer to the PointSet holding the positions at which the
+*        Jacobian is required.
+*     forward
+*        A non-zero value indicates that the Jacobian of the forward
+*        coordinate transformation is required, while a zero value
+*        requests the Jacobian of the inverse transformation.
+*     jac
+*        Pointer to the PointSet in which to store the Jacobian.
+*     status
+*        Pointer to the inherited status variable.
+*/
+
+/* Local Variables: */
+   AstMatrixMap *map;            /* Pointer to MatrixMap */
+   double *jmatrix;              /* Jacobian matrix */
+   double *matrix;               /* Stored matrix elements */
+   int coord;                    /* Coordinate index */
+   int nax;                      /* Number of diagonal elements */
+   int nin;                      /* Number of input coordinates */
+   int nout;                     /* Number of output coordinates */
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* Get a pointer to the MatrixMap structure, and get the numbers of
+   inputs and outputs for the requested transformation. */
+   map = (AstMatrixMap *) this;
+   nin = astGetNcoord( in );
+   nout = forward ? astGetNout( this ) : astGetNin( this );
+
+/* Get a pointer to the array holding the required matrix elements,
+   according to the direction of mapping required. */
+   if ( astGetInvert( this ) ) forward = !forward;
+   matrix = forward ? map->f_matrix : map->i_matrix;
+
+/* Form the full Jacobian matrix. For full MatrixMaps this is just the
+   stored matrix. For unit and diagonal MatrixMaps, the matrix is zero
+   except for the leading diagonal elements. */
+   jmatrix = astCalloc( nin*nout, sizeof( double ) );
+   if ( astOK ) {
+      if ( map->form == FULL ) {
+         (void) memcpy( jmatrix, matrix, sizeof( double )*(size_t)( nin*nout ) );
+      } else {
+         nax = ( nin < nout ) ? nin : nout;
+         for ( coord = 0; coord < nax; coord++ ) {
+            jmatrix[ coord*( nin + 1 ) ] = ( map->form == UNIT ) ? 1.0 :
+                                                                   matrix[ coord ];
+         }
+      }
+
+/* Store the matrix at every point. */
+      astLinearJacobian( in, nout, jmatrix, jac );
+   }
+   jmatrix = astFree( jmatrix );
+}
+
 static double Rate( AstMapping *this, double *at, int ax1, int ax2, int *status ){
 /*
 *  Name:
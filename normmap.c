@@ -124,9 +124,7 @@ static int class_check;
 static AstPointSet *(* parent_transform)( AstMapping *, AstPointSet *, int, AstPointSet *, int * );
 static int *(* parent_mapsplit)( AstMapping *, int, const int *, AstMapping **, int * );
 
-#if defined(THREAD_SAFE)
 static int (* parent_managelock)( AstObject *, int, int, AstObject **, int * );
-#endif
 
 
 #ifdef THREAD_SAFE
@@ -174,9 +172,7 @@ static void Dump( AstObject *, AstChannel *, int * );
 static int Equal( AstObject *, AstObject *, int * );
 static int *MapSplit( AstMapping *, int, const int *, AstMapping **, int * );
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *, int, int, AstObject **, int * );
-#endif
 
 
 /* Member functions. */
@@ -328,10 +324,8 @@ void astInitNormMapVtab_(  AstNormMapVtab *vtab, const char *name, int *status )
 
    mapping->RemoveRegions = RemoveRegions;
 
-#if defined(THREAD_SAFE)
    parent_managelock = object->ManageLock;
    object->ManageLock = ManageLock;
-#endif
 
    parent_transform = mapping->Transform;
    mapping->Transform = Transform;
@@ -360,7 +354,6 @@ void astInitNormMapVtab_(  AstNormMapVtab *vtab, const char *name, int *status )
    }
 }
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *this_object, int mode, int extra,
                        AstObject **fail, int *status ) {
 /*
@@ -452,7 +445,6 @@ static int ManageLock( AstObject *this_object, int mode, int extra,
    return result;
 
 }
-#endif
 
 static int MapMerge( AstMapping *this, int where, int series, int *nmap,
                      AstMapping ***map_list, int **invert_list, int *status ) {
@@ -24,6 +24,7 @@
 *     All Objects have the following attributes:
 *
 *     - Class: Object class name
+*     - Frozen: Has the Object been frozen?
 *     - ID: Object identification string
 *     - Ident: Permanent Object identification string
 *     - Nobject: Number of Objects in class
@@ -46,6 +47,7 @@ c     - astEnd: End an AST context
 c     - astEscapes: Control whether graphical escape sequences are removed
 c     - astExempt: Exempt an Object pointer from AST context handling
 c     - astExport: Export an Object pointer to an outer context
+c     - astFreeze: Make an Object read-only so it can be shared by threads
 c     - astGet<X>: Get an attribute value for an Object
 c     - astHasAttribute: Test if an Object has a named attribute
 c     - astImport: Import an Object pointer to the current context
@@ -270,6 +272,7 @@ f     - AST_VERSION: Return the verson of the AST library being used.
 #include "keymap.h"              /* Hash tables */
 #include "object.h"              /* Interface definition for this class */
 #include "plot.h"                /* Plot class (for astStripEscapes) */
+#include "threadpool.h"          /* Worker thread pool (NThread) */
 #include "globals.h"             /* Thread-safe global data access */
 
 /* Error code definitions. */
@@ -475,9 +478,10 @@ static int TestUseDefs( AstObject *, int * );
 static void ClearUseDefs( AstObject *, int * );
 static void SetUseDefs( AstObject *, int, int * );
 
+static int ManageLock( AstObject *, int, int, AstObject **, int * );
+
 #if defined(THREAD_SAFE)
 static void ChangeThreadVtab( AstObject *, int * );
-static int ManageLock( AstObject *, int, int, AstObject **, int * );
 #endif
 
 /* Member functions. */
@@ -1214,6 +1218,7 @@ static void ClearAttrib( AstObject *this, const char *attrib, int *status ) {
 /* Test if the attribute string matches any of the read-only
    attributes of this class. If it does, then report an error. */
    } else if ( !strcmp( attrib, "class" ) ||
+               !strcmp( attrib, "frozen" ) ||
                !strcmp( attrib, "nobject" ) ||
                !strcmp( attrib, "objsize" ) ||
                !strcmp( attrib, "refcount" ) ) {
@@ -1404,6 +1409,7 @@ f     function is invoked with STATUS set to an error value, or if it
       new->ref_count = 1;
       new->id = NULL;   /* ID attribute is not copied (but Ident is copied) */
       new->proxy = NULL;
+      new->frozen = 0;  /* Copies of frozen Objects can be modified */
 
 /* Copy the persistent identifier string. */
       if( this->ident ) {
@@ -1538,6 +1544,14 @@ f     value
    generates an error if it doesn't). */
    if ( !astIsAObject( this ) ) return NULL;
 
+/* A frozen Object may be deleted by a thread other than the one that
+   created it. Ensure the Object uses the virtual function table created
+   by the running thread, since the table's free list and Object count
+   are modified below. */
+#if defined(THREAD_SAFE)
+   if( this->frozen ) ChangeThreadVtab( this, status );
+#endif
+
 /* Loop through all the destructors associated with the Object by derived
    classes (working up the class hierarchy). */
    for ( i = this->vtab->ndelete - 1; i >= 0; i-- ) {
@@ -2104,6 +2118,7 @@ static const char *GetAttrib( AstObject *this, const char *attrib, int *status )
    const char *result;           /* Pointer value to return */
    int nobject;                  /* Nobject attribute value */
    int objsize;                  /* ObjSize attribute value */
+   int frozen;                   /* Frozen attribute value */
    int ref_count;                /* RefCount attribute value */
    int usedefs;                  /* UseDefs attribute value */
 
@@ -2163,6 +2178,15 @@ static const char *GetAttrib( AstObject *this, const char *attrib, int *status )
          result = getattrib_buff;
       }
 
+/* Frozen. */
+/* ------- */
+   } else if ( !strcmp( attrib, "frozen" ) ) {
+      frozen = astGetFrozen( this );
+      if ( astOK ) {
+         (void) sprintf( getattrib_buff, "%d", frozen );
+         result = getattrib_buff;
+      }
+
 /* RefCount. */
 /* --------- */
    } else if ( !strcmp( attrib, "refcount" ) ) {
@@ -2378,6 +2402,111 @@ void *astGetProxy_( AstObject *this, int *status ) {
    return this ? this->proxy : NULL;
 }
 
+int astCheckFrozen_( AstObject *this, const char *method, int *status ) {
+/*
+*+
+*  Name:
+*     astCheckFrozen
+
+*  Purpose:
+*     Report an error if an Object has been frozen.
+
+*  Type:
+*     Protected function.
+
+*  Synopsis:
+*     #include "object.h"
+*     int astCheckFrozen( AstObject *this, const char *method )
+
+*  Class Membership:
+*     Object method.
+
+*  Description:
+*     This function should be invoked by any method that modifies an
+*     Object other than by setting or clearing its attributes (attribute
+*     settings are checked by astSet and astClear). If the Object has been
+*     frozen using astFreeze, it may be in use by several threads at once
+*     and so must not be modified. An error is then reported and a
+*     non-zero value returned, in which case the caller should return
+*     without making any change.
+
+*  Parameters:
+*     this
+*        Pointer to the Object.
+*     method
+*        Pointer to a null-terminated string holding the name of the
+*        public method that is attempting to modify the Object. This is
+*        only used in error messages.
+
+*  Returned Value:
+*     Non-zero if the Object has been frozen.
+
+*  Notes:
+*     - A value of zero will be returned if this function is invoked
+*     with the global error status set.
+*-
+*/
+
+/* Check the global error status. */
+   if ( !astOK ) return 0;
+
+/* Report an error if the Object has been frozen. */
+   if ( this->frozen ) {
+      astError( AST__IMMUT, "%s(%s): The %s cannot be modified because it "
+                "has been frozen (programming error).", status, method,
+                astGetClass( this ), astGetClass( this ) );
+      return 1;
+   }
+
+   return 0;
+}
+
+int astGetFrozen_( AstObject *this, int *status ) {
+/*
+*+
+*  Name:
+*     astGetFrozen
+
+*  Purpose:
+*     Obtain the value of the Frozen attribute for an Object.
+
+*  Type:
+*     Protected function.
+
+*  Synopsis:
+*     #include "object.h"
+*     int astGetFrozen( AstObject *this )
+
+*  Class Membership:
+*     Object method.
+
+*  Description:
+*     This function returns the value of the read-only Frozen attribute
+*     for an Object. This is non-zero if the Object has been frozen
+*     using astFreeze, in which case it must not be modified since it
+*     may be in use by several threads at once.
+
+*  Parameters:
+*     this
+*        Pointer to the Object.
+
+*  Returned Value:
+*     Non-zero if the Object has been frozen.
+
+*  Notes:
+*     - A value of zero will be returned if this function is invoked
+*     with the global error status set, or if it should fail for any
+*     reason.
+*-
+*/
+
+/* Check the global error status. */
+   if ( !astOK ) return 0;
+
+/* The frozen flag is never cleared once set, so no mutex is needed. */
+   return this->frozen ? 1 : 0;
+}
+
 int astGetRefCount_( AstObject *this, int *status ) {
 /*
 *+
@@ -2824,6 +2953,11 @@ static int ManageLock( AstObject *this, int mode, int extra,
 *
 *        AST__CHECKLOCK: Check that the object is locked for use by the
 *        calling thread.
+*
+*        AST__FREEZE: Unlock the Object and mark it as frozen. A frozen
+*        Object is never locked again, and all subsequent AST__LOCK,
+*        AST__UNLOCK and AST__CHECKLOCK requests succeed without action,
+*        so that any thread may use it.
 *     extra
 *        Extra mode-specific information.
 *     fail
@@ -2874,6 +3008,10 @@ static int ManageLock( AstObject *this, int mode, int extra,
    if( LOCK_SMUTEX(this) ) {
       result = 2;
 
+/* Frozen Objects are not owned by any thread, and so all requests
+   succeed without any change. */
+   } else if( this->frozen ) {
+
 /* If the secondary mutex was locked succesfully, first deal with cases
    where the caller wants to lock the Object for exclusive use by the
    calling thread. */
@@ -2946,6 +3084,22 @@ static int ManageLock( AstObject *this, int mode, int extra,
          result = 5;
       }
 
+/* Freeze the Object. If it is locked by the calling thread, release the
+   lock first. The thread-specific globals pointer is cleared so that
+   each thread using the frozen Object accesses its own global data.
+   Return a status of 1 if the Object is locked by another thread. */
+   } else if( mode == AST__FREEZE ) {
+      if( this->locker == AST__THREAD_ID ) {
+         this->locker = -1;
+         this->globals = NULL;
+         if( UNLOCK_PMUTEX(this) ) result = 3;
+         this->frozen = 1;
+      } else if( this->locker == -1 ) {
+         this->frozen = 1;
+      } else {
+         result = 1;
+      }
+
 /* Return a status of 4 for any other modes. */
    } else {
       result = 4;
@@ -2958,6 +3112,69 @@ static int ManageLock( AstObject *this, int mode, int extra,
 /* If the operation failed, return a pointer to the failed object. */
    if( result && fail ) *fail = this;
 
+/* Return the status value */
+   return result;
+}
+
+#else
+static int ManageLock( AstObject *this, int mode, int extra,
+                       AstObject **fail, int *status ) {
+/*
+*  Name:
+*     ManageLock
+
+*  Purpose:
+*     Manage the thread lock on an Object.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "object.h"
+*     int ManageLock( AstObject *this, int mode, int extra,
+*                     AstObject **fail, int *status )
+
+*  Class Membership:
+*     Object method.
+
+*  Description:
+*     This is the implementation of the astManageLock method used when
+*     AST is built without POSIX thread support. Objects are not locked
+*     in this case, and so the only request that has any effect is
+*     AST__FREEZE, which marks the Object as frozen. Classes that contain
+*     other Objects over-ride this method in order to forward the request
+*     to those Objects, so that freezing is recursive in all builds.
+
+*  Parameters:
+*     See the thread-safe implementation above.
+
+*  Returned Value:
+*     Zero for the AST__LOCK, AST__UNLOCK, AST__CHECKLOCK and AST__FREEZE
+*     modes, and 4 for any other mode.
+*/
+
+/* Local Variables: */
+   int result;                   /* Returned value */
+
+/* Initialise */
+   result = 0;
+   if( fail ) *fail = NULL;
+
+/* Check the supplied point is not NULL. */
+   if( ! this ) return result;
+
+/* Freeze the Object if required. Other valid requests succeed without
+   any change. Return a status of 4 for any other modes. */
+   if( mode == AST__FREEZE ) {
+      this->frozen = 1;
+   } else if( mode != AST__LOCK && mode != AST__UNLOCK &&
+              mode != AST__CHECKLOCK ) {
+      result = 4;
+   }
+
+/* If the operation failed, return a pointer to the failed object. */
+   if( result && fail ) *fail = this;
+
 /* Return the status value */
    return result;
 }
@@ -3308,6 +3525,7 @@ static void SetAttrib( AstObject *this, const char *setting, int *status ) {
                   ( nc >= len ) )
 
    } else if ( MATCH( "class" ) ||
+               MATCH( "frozen" ) ||
                MATCH( "nobject" ) ||
                MATCH( "objsize" ) ||
                MATCH( "refcount" ) ) {
@@ -4153,6 +4371,7 @@ static int TestAttrib( AstObject *this, const char *attrib, int *status ) {
 /* Test if the attribute string matches any of the read-only
    attributes of this class. If it does, then return zero. */
    } else if ( !strcmp( attrib, "class" ) ||
+               !strcmp( attrib, "frozen" ) ||
                !strcmp( attrib, "nobject" ) ||
                !strcmp( attrib, "objsize" ) ||
                !strcmp( attrib, "refcount" ) ) {
@@ -4237,6 +4456,22 @@ f        AST_DELETE).
 *        that it controls caching of all memory blocks of less than 300 bytes
 *        allocated by AST (whether for internal or external use), not just
 *        memory used to store AST Objects.
+*     NThread
+*        The maximum number of threads that may be used to perform a
+*        single computationally expensive operation, such as resampling
+*        a grid of data using
+c        astResample<X>,
+f        AST_RESAMPLE<X>,
+*        or transforming a large number of points using
+c        astTranN (etc.).
+f        AST_TRANN (etc.).
+*        The work is divided into independent sections which are then
+*        processed concurrently by a pool of worker threads (created when
+*        first needed) together with the calling thread. The results are
+*        identical to those obtained using a single thread. The default
+*        value is one, meaning that all work is performed by the calling
+*        thread. This parameter has no effect if AST was built without
+*        support for POSIX threads.
 
 *  Notes:
 c     - This function attempts to execute even if the AST error
@@ -4266,6 +4501,9 @@ f     error value
       } else if( astChrMatch( name, "MemoryCaching" ) ) {
          result = astMemCaching( value );
 
+      } else if( astChrMatch( name, "NThread" ) ) {
+         result = astNThread( value );
+
       } else if( astOK ) {
          astError( AST__TUNAM, "astTune: Unknown AST tuning parameter "
                    "specified \"%s\".", status, name );
@@ -5198,6 +5436,32 @@ astMAKE_TEST(Object,UseDefs,(this->usedefs!=CHAR_MAX))
 *att--
 */
 
+/*
+*att++
+*  Name:
+*     Frozen
+
+*  Purpose:
+*     Has the Object been frozen?
+
+*  Type:
+*     Public attribute.
+
+*  Synopsis:
+*     Integer (boolean), read-only.
+
+*  Description:
+*     This attribute has a non-zero value if the Object has been frozen
+*     using astFreeze, and zero otherwise. The attribute values of a
+*     frozen Object cannot be changed. Copies of a frozen Object are
+*     not frozen.
+
+*  Applicability:
+*     Object
+*        All Objects have this attribute.
+*att--
+*/
+
 /*
 *att++
 *  Name:
@@ -5464,9 +5728,7 @@ void astInitObjectVtab_(  AstObjectVtab *vtab, const char *name, int *status ) {
    vtab->ClearUseDefs = ClearUseDefs;
    vtab->GetUseDefs = GetUseDefs;
 
-#if defined(THREAD_SAFE)
    vtab->ManageLock = ManageLock;
-#endif
 
 /* Store the pointer to the class name. */
    vtab->class = name;
@@ -5664,6 +5926,9 @@ AstObject *astInitObject_( void *mem, size_t size, int init,
 /* Use default values for unspecified attributes. */
          new->usedefs = CHAR_MAX;
 
+/* New Objects can be modified until they are frozen. */
+         new->frozen = 0;
+
 /* Increment the count of active Objects in the virtual function table.
    Use the count as a unique identifier (unique within the class) for
    the Object. */
@@ -5857,6 +6122,12 @@ void astClear_( AstObject *this, const char *attrib, int *status ) {
 }
 void astClearAttrib_( AstObject *this, const char *attrib, int *status ) {
    if ( !astOK ) return;
+   if ( this->frozen ) {
+      astError( AST__IMMUT, "astClear(%s): Cannot clear the %s attribute "
+                "because the %s has been frozen (programming error).",
+                status, astGetClass( this ), attrib, astGetClass( this ) );
+      return;
+   }
    (**astMEMBER(this,Object,ClearAttrib))( this, attrib, status );
 }
 void astDump_( AstObject *this, AstChannel *channel, int *status ) {
@@ -5864,13 +6135,11 @@ void astDump_( AstObject *this, AstChannel *channel, int *status ) {
    (**astMEMBER(this,Object,Dump))( this, channel, status );
 }
 
-#if defined(THREAD_SAFE)
 int astManageLock_( AstObject *this, int mode, int extra, AstObject **fail,
                     int *status ) {
    if( !this ) return 0;
    return (**astMEMBER(this,Object,ManageLock))( this, mode, extra, fail, status );
 }
-#endif
 
 int astEqual_( AstObject *this, AstObject *that, int *status ) {
    if ( !astOK ) return 0;
@@ -5883,6 +6152,12 @@ const char *astGetAttrib_( AstObject *this, const char *attrib, int *status ) {
 }
 void astSetAttrib_( AstObject *this, const char *setting, int *status ) {
    if ( !astOK ) return;
+   if ( this->frozen ) {
+      astError( AST__IMMUT, "astSet(%s): Cannot apply the setting \"%s\" "
+                "because the %s has been frozen (programming error).",
+                status, astGetClass( this ), setting, astGetClass( this ) );
+      return;
+   }
    (**astMEMBER(this,Object,SetAttrib))( this, setting, status );
 }
 void astShow_( AstObject *this, int *status ) {
@@ -7388,6 +7663,151 @@ f        This routine applies to all Objects.
    }
 }
 
+void astFreezeId_( AstObject *this_id, int *status ) {
+/*
+c++
+*  Name:
+*     astFreeze
+
+*  Purpose:
+*     Make an Object read-only so that it can be shared by threads.
+
+*  Type:
+*     Public function.
+
+*  Synopsis:
+*     #include "object.h"
+*     void astFreeze( AstObject *this )
+
+*  Class Membership:
+*     Object method.
+
+*  Description:
+*     This function freezes the supplied Object, together with all the
+*     Objects contained within it (for instance, the Frames and Mappings
+*     within a FrameSet). The attributes of a frozen Object cannot be
+*     changed - an error is reported if astSet, astSet<X> or astClear is
+*     used to change them.
+*
+*     A frozen Object is not locked by any thread, and cannot be locked.
+*     Any thread may therefore use it, without first calling astLock,
+*     for operations that do not modify it (for instance, transforming
+*     positions, resampling data or formatting axis values), and several
+*     threads may use it at the same time. This avoids the need to create
+*     a separate deep copy of the Object for each thread.
+*
+*     Freezing cannot be reversed, but a copy of a frozen Object created
+*     using astCopy is not frozen and may be modified in the usual way.
+
+*  Parameters:
+*     this
+*        Pointer to the Object to be frozen. It must be locked by the
+*        calling thread, or not locked by any thread.
+
+*  Applicability:
+*     Object
+*        This function applies to all Objects.
+*     Mapping
+*        A Mapping is simplified before it is frozen, and the simplified
+*        Mapping is stored within it so that later calls to astSimplify
+*        can return it without modifying the frozen Mapping. Information
+*        that would otherwise be stored within a Mapping by astMapBox and
+*        by astResample<X> (see the AST__USEPLAN flag) is not stored
+*        within a frozen Mapping.
+
+*  Notes:
+*     - The supplied pointer is no longer associated with any thread or
+*     AST context, and so may be used by any thread. It is not annulled
+*     by astEnd. Pointers created by other threads using astClone belong
+*     to those threads in the usual way.
+*     - A frozen Object is deleted when the last pointer to it is
+*     annulled. A thread should therefore not annul a pointer that other
+*     threads may still be using.
+*     - Functions that modify an Object other than by setting or clearing
+*     its attributes (for instance, astInvert or astAddFrame) report an
+*     error if used on a frozen Object.
+*     - This function is only available in the C interface.
+*     - If the AST library has been built without POSIX thread support
+*     (i.e. the "-with-pthreads" option was not specified when running
+*     the "configure" script), Objects cannot be shared between threads,
+*     but the supplied Object and the Objects contained within it are
+*     still frozen.
+c--
+*/
+
+/* Local Variables: */
+#if defined(THREAD_SAFE)
+   astDECLARE_GLOBALS            /* Thread-specific global data */
+   AstObject *fail;              /* Pointer to Object that failed */
+   int ihandle;                  /* Index of supplied object handle */
+   int lstat;                    /* Local status value */
+#endif
+   AstObject *this;              /* Pointer to Object */
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* Obtain the Object pointer from the ID supplied. This reports an error
+   if the Object is locked by another thread. */
+   this = astMakePointer( this_id );
+   if ( !astOK ) return;
+
+#if defined(THREAD_SAFE)
+
+/* Ensure the global data for this class is accessable. */
+   astGET_GLOBALS(NULL);
+
+/* Get the Handle index for the supplied object identifier. */
+   LOCK_MUTEX2;
+   if ( !active_handles ) InitContext( status );
+   ihandle = CheckId( this_id, 1, status );
+   UNLOCK_MUTEX2;
+
+/* The protected astManageLock function freezes the Object and all the
+   Objects contained within it. */
+   if( ihandle != -1 ){
+      lstat = astManageLock( this, AST__FREEZE, 0, &fail );
+      if( astOK ) {
+         if( lstat == 1 ) {
+            astError( AST__LCKERR, "astFreeze(%s): Failed to freeze the %s "
+                      "because a %s contained within it is locked by another "
+                      "thread (programming error).", status,
+                      astGetClass( this ), astGetClass( this ),
+                      astGetClass( fail ) );
+
+         } else if( lstat == 3 ) {
+            astError( AST__LCKERR, "astFreeze(%s): Failed to unlock a POSIX "
+                      "mutex.", status, astGetClass( this ) );
+
+/* If the Object is now frozen, break the association of the handle with
+   the current thread so that the handle can be used by any thread. */
+         } else {
+            LOCK_MUTEX2;
+            if( handles[ ihandle ].context >= 0 ) {
+               RemoveHandle( ihandle,
+                             &active_handles[ handles[ ihandle ].context ],
+                             status );
+#if defined(MEM_DEBUG)
+               astHandleUse( ihandle, "frozen by thread %d at context "
+                             "level %d", handles[ ihandle ].thread,
+                             handles[ ihandle ].context );
+#endif
+               handles[ ihandle ].thread = -1;
+               handles[ ihandle ].context = UNOWNED_CONTEXT;
+               InsertHandle( ihandle, &unowned_handles, status );
+            }
+            UNLOCK_MUTEX2;
+         }
+      }
+   }
+
+/* Without thread support, the Object cannot be locked by another
+   thread, so just freeze it and the Objects contained within it. */
+#else
+   (void) astManageLock( this, AST__FREEZE, 0, NULL );
+#endif
+}
+
 void astLockId_( AstObject *this_id, int wait, int *status ) {
 /*
 c++
@@ -7447,7 +7867,11 @@ c++
 *     the Object for each thread. Each copy should then be unlocked by
 *     the parent thread (i.e. the thread that created the copy), and then
 *     locked by the child thread (i.e. the thread that wants to use the
-*     copy).
+*     copy). Alternatively, if none of the threads needs to modify the
+*     Object, it may be frozen using astFreeze, after which any thread
+*     may use it without locking it.
+*     - This function returns without action if the Object has been
+*     frozen using astFreeze.
 *     - This function is only available in the C interface.
 *     - This function returns without action if the AST library has
 *     been built without POSIX thread support (i.e. the "-with-pthreads"
@@ -7525,8 +7949,10 @@ c--
             LOCK_MUTEX2;
 
 /* If the supplied handle is not currently assigned to any thread, assign
-   it to the running thread. */
-            if( handles[ ihandle ].context == UNOWNED_CONTEXT ) {
+   it to the running thread. Handles for frozen Objects are left
+   unassigned so that they can still be used by any thread. */
+            if( handles[ ihandle ].context == UNOWNED_CONTEXT &&
+                !this->frozen ) {
                RemoveHandle( ihandle, &unowned_handles, status );
 
 #if defined(MEM_DEBUG)
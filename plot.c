@@ -1682,9 +1682,7 @@ static int (* parent_testattrib)( AstObject *, const char *, int * );
 static void (* parent_clearattrib)( AstObject *, const char *, int * );
 static void (* parent_setattrib)( AstObject *, const char *, int * );
 
-#if defined(THREAD_SAFE)
 static int (* parent_managelock)( AstObject *, int, int, AstObject **, int * );
-#endif
 
 /* Strings giving the label for the graphics items corresponding to
    AST__BORDER_ID, AST__GRIDLINE_ID, etc. */
@@ -2322,9 +2320,7 @@ static void TextLabels( AstPlot *, int, int *, const char *, const char *, int *
 static void Ticker( AstPlot *, int, int, double, double *, double, int, int, EdgeCrossingsStatics **, const char *, const char *, int * );
 static void UpdateConcat( float *, float *, float, float, float, float, float *, float *, float, float, float *, float *, float *, float *, int * );
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *, int, int, AstObject **, int * );
-#endif
 
 /* Functions which access class attributes. */
 /* =======================================  */
@@ -19819,10 +19815,8 @@ void astInitPlotVtab_(  AstPlotVtab *vtab, const char *name, int *status ) {
    parent_testattrib = object->TestAttrib;
    object->TestAttrib = TestAttrib;
 
-#if defined(THREAD_SAFE)
    parent_managelock = object->ManageLock;
    object->ManageLock = ManageLock;
-#endif
 
    parent_transform = mapping->Transform;
    mapping->Transform = Transform;
@@ -21522,7 +21516,6 @@ static double **MakeGrid( AstPlot *this, AstFrame *frm, AstMapping *map,
 }
 
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *this_object, int mode, int extra,
                        AstObject **fail, int *status ) {
 /*
@@ -21625,7 +21618,6 @@ static int ManageLock( AstObject *this_object, int mode, int extra,
    return result;
 
 }
-#endif
 
 static void Map1( int n, double *dist, double *x, double *y,
                   const char *method, const char *class,
@@ -1211,9 +1211,7 @@ static void (* parent_setattrib)( AstObject *, const char *, int * );
 /* A FrameSet pointer that is used when calling astCast. */
 static AstFrameSet *dummy_frameset = NULL;
 
-#if defined(THREAD_SAFE)
 static int (* parent_managelock)( AstObject *, int, int, AstObject **, int * );
-#endif
 
 /* Define macros for accessing each item of thread specific global data. */
 #ifdef THREAD_SAFE
@@ -1317,9 +1315,7 @@ static int TestAttrib( AstObject *, const char *, int * );
 static void ClearAttrib( AstObject *, const char *, int * );
 static void SetAttrib( AstObject *, const char *, int * );
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *, int, int, AstObject **, int * );
-#endif
 
 /* Declare private member functions that access Plot3D attributes.
    --------------------------------------------------------------*/
@@ -3771,10 +3767,8 @@ SET_PLOT3D_ACCESSORS(Norm)
    parent_removeframe = fset->RemoveFrame;
    fset->RemoveFrame = RemoveFrame;
 
-#if defined(THREAD_SAFE)
    parent_managelock = object->ManageLock;
    object->ManageLock = ManageLock;
-#endif
 
 /* Define a macro to override attribute accessors inherited from the
    parent Plot class. First do axis specific attributes. */
@@ -3880,7 +3874,6 @@ SET_PLOT_ACCESSORS(Size)
    }
 }
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *this_object, int mode, int extra,
                        AstObject **fail, int *status ) {
 /*
@@ -3974,7 +3967,6 @@ static int ManageLock( AstObject *this_object, int mode, int extra,
    return result;
 
 }
-#endif
 
 static void Mark( AstPlot *this_plot, int nmark, int ncoord, int indim,
                   const double *in, int type, int *status ){
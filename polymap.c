@@ -165,7 +165,8 @@ f     - AST_POLYTRAN: Fit a PolyMap inverse or forward transformation
 #include "cmpmap.h"              /* Compound mappings */
 #include "polymap.h"             /* Interface definition for this class */
 #include "unitmap.h"             /* Unit mappings */
-#include "cminpack/cminpack.h"   /* Levenberg - Marquardt minimization */
+#include "cminpack/cminpack.h"   /* QR factorisation and least squares */
+#include "threadpool.h"          /* Concurrent execution of jobs */
 #include "pal.h"                 /* SLALIB function definitions */
 
 /* Error code definitions. */
@@ -182,6 +183,25 @@ f     - AST_POLYTRAN: Fit a PolyMap inverse or forward transformation
 #include <limits.h>
 #include <float.h>
 
+/* Type Definitions */
+/* ================ */
+/* Data structure describing the division of the positions transformed
+   by the iterative inverse transformation into blocks, which may be
+   inverted concurrently by several threads. Each block (except the last)
+   contains ITER_NPOINT points. */
+#define ITER_NPOINT 4096
+typedef struct IterInverseJobs {
+   AstPolyMap *this;             /* PolyMap being inverted */
+   AstPolyMap **jacob;           /* PolyMaps describing the Jacobian */
+   double **ptr_in;              /* Returned input positions */
+   double **ptr_out;             /* Supplied output positions */
+   double maxerr;                /* Square of target relative error */
+   int fwd;                      /* Forward flag for original forward */
+   int maxiter;                  /* Maximum number of iterations */
+   int ncoord;                   /* Number of inputs and outputs */
+   int npoint;                   /* Total number of points */
+} IterInverseJobs;
+
 /* Module Variables. */
 /* ================= */
 
@@ -191,15 +211,14 @@ static int class_check;
 
 /* Pointers to parent class methods which are extended by this class. */
 static AstPointSet *(* parent_transform)( AstMapping *, AstPointSet *, int, AstPointSet *, int * );
+static void (* parent_jacobianpoints)( AstMapping *, AstPointSet *, int, AstPointSet *, int * );
 static const char *(* parent_getattrib)( AstObject *, const char *, int * );
 static int (* parent_testattrib)( AstObject *, const char *, int * );
 static void (* parent_clearattrib)( AstObject *, const char *, int * );
 static void (* parent_setattrib)( AstObject *, const char *, int * );
 static int (* parent_getobjsize)( AstObject *, int * );
 
-#if defined(THREAD_SAFE)
 static int (* parent_managelock)( AstObject *, int, int, AstObject **, int * );
-#endif
 
 
 #ifdef THREAD_SAFE
@@ -251,12 +270,13 @@ static double **SamplePoly2D( AstPolyMap *, int, double **, const double *, cons
 static double *FitPoly1D( AstPolyMap *, int, int, double, int, double **, double[2], int *, double *, int * );
 static double *FitPoly2D( AstPolyMap *, int, int, double, int, double **, double[4], int *, double *, int * );
 static int Equal( AstObject *, AstObject *, int * );
+static int ThreadSafe( AstMapping *, int * );
 static int GetObjSize( AstObject *, int * );
 static int GetTranForward( AstMapping *, int * );
 static int GetTranInverse( AstMapping *, int * );
-static int MPFunc1D( void *, int, int, const double *, double *, double *, int, int );
-static int MPFunc2D( void *, int, int, const double *, double *, double *, int, int );
 static int MapMerge( AstMapping *, int, int, int *, AstMapping ***, int **, int * );
+static int NestedTransform( AstPolyMap *, int, int, int, int, double **, double **, int * );
+static int PolyBasis( AstPolyMap *, int, const double **, const double **, int * );
 static int ReplaceTransformation( AstPolyMap *, int, double, double, int, const double *, const double *, int * );
 static void Copy( const AstObject *, AstObject *, int * );
 static void Delete( AstObject *obj, int * );
@@ -265,17 +285,19 @@ static void FitPoly1DInit( AstPolyMap *, int, double **, AstMinPackData *, doubl
 static void FitPoly2DInit( AstPolyMap *, int, double **, AstMinPackData *, double *, int *);
 static void FreeArrays( AstPolyMap *, int, int * );
 static void IterInverse( AstPolyMap *, AstPointSet *, AstPointSet *, int * );
+static void IterInverseJob( int, void *, int * );
 static void LMFunc1D(  const double *, double *, int, int, void * );
+static void NestArrays( AstPolyMap *, int, int * );
 static void LMFunc2D(  const double *, double *, int, int, void * );
 static void LMJacob1D( const double *, double *, int, int, void * );
-static void LMJacob2D( const double *, double *, int, int, void * );
+static void LeastSquares( int, int, double *, int, double **, double *, int * );
 static void PolyCoeffs( AstPolyMap *, int, int, double *, int *, int * );
 static void PolyPowers( AstPolyMap *, double **, int, const int *, double **, int, int, int * );
+static void PolyPowerDerivs( AstPolyMap *, double **, double **, int, const int *, double **, int, int, int * );
+static void JacobianPoints( AstMapping *, AstPointSet *, int, AstPointSet *, int * );
 static void StoreArrays( AstPolyMap *, int, int, const double *, int * );
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *, int, int, AstObject **, int * );
-#endif
 
 static const char *GetAttrib( AstObject *, const char *, int * );
 static int TestAttrib( AstObject *, const char *, int * );
@@ -651,14 +673,11 @@ static double *FitPoly1D( AstPolyMap *this, int forward, int nsamp, double acc,
    double *result;
    double *work1;
    double *work2;
-   double *work4;
    double f1;
    double f2;
    double maxterm;
    double term;
    double tv;
-   int *work3;
-   int info;
    int k;
    int ncof;
    int w1;
@@ -686,11 +705,9 @@ static double *FitPoly1D( AstPolyMap *this, int forward, int nsamp, double acc,
 /* Work space to hold coefficients. */
    coeffs = astMalloc( ncof*sizeof( double ) );
 
-/* Other work space. */
+/* Work space to hold the residuals and the design matrix. */
    work1 = astMalloc( nsamp*sizeof( double ) );
    work2 = astMalloc( ncof*nsamp*sizeof( double ) );
-   work3 = astMalloc( ncof*sizeof( int ) );
-   work4 = astMalloc( (5*ncof+nsamp)*sizeof( double ) );
    if( astOK ) {
 
 /* Find all the required powers of x1 and store them in the "xp1"
@@ -699,19 +716,16 @@ static double *FitPoly1D( AstPolyMap *this, int forward, int nsamp, double acc,
    it up in a virtual function. */
       astFitPoly1DInit( this, forward, table, &data, scales );
 
-/* The initial guess at the coefficient values represents a unit
-   transformation in (normalised) tabulated (x,y) values. Using normalised
-   values means that we are, effectively, including a guess at the linear
-   scaling factor between input and output of the PolyMap (e.g. the PolyMap
-   may have inputs in mm and outputs in radians). */
-      for( k = 0; k < ncof; k++ ) coeffs[ k ] = 0.0;
-      coeffs[ 1 ] = 1.0;
+/* The polynomial is linear in its coefficients, so the best coefficients
+   can be found directly by linear least squares. Store the design matrix
+   (the powers of x1 at each sample) in "work2", and then solve for the
+   coefficients. */
+      data.init_jac = 1;
+      LMJacob1D( coeffs, work2, ncof, nsamp, &data );
+      LeastSquares( nsamp, ncof, work2, 1, data.y, coeffs, status );
 
-/* Find the best coefficients */
-      info = lmder1( MPFunc1D, &data, nsamp, ncof, coeffs, work1, work2, nsamp,
-                     sqrt(DBL_EPSILON), work3, work4, (5*ncof+nsamp) );
-      if( info == 0 ) astError( AST__MNPCK, "astPolyMap(PolyTran): Minpack error "
-                                "detected (possible programming error).", status );
+/* Find the residuals at each tabulated point. */
+      LMFunc1D( coeffs, work1, ncof, nsamp, &data );
 
 /* Return the achieved accuracy. The "work1" array holds the normalised Y
    residuals at each tabulated point. */
@@ -793,8 +807,6 @@ static double *FitPoly1D( AstPolyMap *this, int forward, int nsamp, double acc,
    data.xp1 = astFree( data.xp1 );
    work1 = astFree( work1 );
    work2 = astFree( work2 );
-   work3 = astFree( work3 );
-   work4 = astFree( work4 );
 
 /* Return the coefficient array. */
    return result;
@@ -960,6 +972,7 @@ static double *FitPoly2D( AstPolyMap *this, int forward, int nsamp, double acc,
 /* Local Variables: */
    AstMinPackData data;
    double *coeffs;
+   double *pa;
    double *pc;
    double *pr;
    double *pxp1;
@@ -967,7 +980,6 @@ static double *FitPoly2D( AstPolyMap *this, int forward, int nsamp, double acc,
    double *result;
    double *work1;
    double *work2;
-   double *work4;
    double f1;
    double f20;
    double f2;
@@ -976,8 +988,6 @@ static double *FitPoly2D( AstPolyMap *this, int forward, int nsamp, double acc,
    double maxterm;
    double term;
    double tv;
-   int *work3;
-   int info;
    int iout;
    int k;
    int ncof;
@@ -1008,11 +1018,9 @@ static double *FitPoly2D( AstPolyMap *this, int forward, int nsamp, double acc,
 /* Work space to hold coefficients. */
    coeffs = astMalloc( 2*ncof*sizeof( double ) );
 
-/* Other work space. */
+/* Work space to hold the residuals and the design matrix. */
    work1 = astMalloc( 2*nsamp*sizeof( double ) );
-   work2 = astMalloc( 4*ncof*nsamp*sizeof( double ) );
-   work3 = astMalloc( 2*ncof*sizeof( int ) );
-   work4 = astMalloc( 2*(5*ncof+nsamp)*sizeof( double ) );
+   work2 = astMalloc( ncof*nsamp*sizeof( double ) );
    if( astOK ) {
 
 /* Find all the required powers of x1 and x2 and store them in the "xp1"
@@ -1021,20 +1029,30 @@ static double *FitPoly2D( AstPolyMap *this, int forward, int nsamp, double acc,
    wrap it up in a virtual function. */
       astFitPoly2DInit( this, forward, table, &data, scales );
 
-/* The initial guess at the coefficient values represents a unit
-   transformation in (normalised) tabulated (x,y) values. Using normalised
-   values means that we are, effectively, including a guess at the linear
-   scaling factor between input and output of the PolyMap (e.g. the PolyMap
-   may have inputs in mm and outputs in radians). */
-      for( k = 0; k < 2*ncof; k++ ) coeffs[ k ] = 0.0;
-      coeffs[ 1 ] = 1.0;
-      coeffs[ 5 ] = 1.0;
-
-/* Find the best coefficients */
-      info = lmder1( MPFunc2D, &data, 2*nsamp, 2*ncof, coeffs, work1, work2,
-                     2*nsamp, sqrt(DBL_EPSILON), work3, work4, 2*(5*ncof+nsamp) );
-      if( info == 0 ) astError( AST__MNPCK, "astPolyMap(PolyTran): Minpack error "
-                                "detected (possible programming error).", status );
+/* The polynomials are linear in their coefficients, so the best
+   coefficients can be found directly by linear least squares. Both
+   polynomials use the same terms, and so share the same design matrix.
+   Store the design matrix in "work2". Element (k,c) holds the value of
+   the term for coefficient "c" at sample "k". The coefficients are
+   ordered C00, C10, C01, C20, C11, C02, etc, as described in LMFunc2D. */
+      pa = work2;
+      for( w12 = 0; w12 < order; w12++ ) {
+         for( w2 = 0; w2 <= w12; w2++ ) {
+            w1 = w12 - w2;
+            pxp1 = data.xp1 + w1;
+            pxp2 = data.xp2 + w2;
+            for( k = 0; k < nsamp; k++ ) {
+               *(pa++) = ( *pxp1 )*( *pxp2 );
+               pxp1 += order;
+               pxp2 += order;
+            }
+         }
+      }
+
+/* Find the coefficients for both polynomials, and then the residuals
+   at each tabulated point. */
+      LeastSquares( nsamp, ncof, work2, 2, data.y, coeffs, status );
+      LMFunc2D( coeffs, work1, 2*ncof, 2*nsamp, &data );
 
 /* Return the achieved accuracy. */
       pr = work1;
@@ -1139,8 +1157,6 @@ static double *FitPoly2D( AstPolyMap *this, int forward, int nsamp, double acc,
    data.xp2 = astFree( data.xp2 );
    work1 = astFree( work1 );
    work2 = astFree( work2 );
-   work3 = astFree( work3 );
-   work4 = astFree( work4 );
 
 /* Return the coefficient array. */
    return result;
@@ -1311,6 +1327,14 @@ static void FreeArrays( AstPolyMap *this, int forward, int *status ) {
       this->ncoeff_f = astFree( this->ncoeff_f );
       this->mxpow_f = astFree( this->mxpow_f );
 
+      if( this->nest_f ) {
+         for( i = 0; i < nout; i++ ) {
+            this->nest_f[ i ] = astFree( this->nest_f[ i ] );
+         }
+         this->nest_f = astFree( this->nest_f );
+      }
+      this->nestpow_f = astFree( this->nestpow_f );
+
 /* Free the dynamic arrays for the inverse transformation. */
    } else {
 
@@ -1335,6 +1359,14 @@ static void FreeArrays( AstPolyMap *this, int forward, int *status ) {
 
       this->ncoeff_i = astFree( this->ncoeff_i );
       this->mxpow_i = astFree( this->mxpow_i );
+
+      if( this->nest_i ) {
+         for( i = 0; i < nin; i++ ) {
+            this->nest_i[ i ] = astFree( this->nest_i[ i ] );
+         }
+         this->nest_i = astFree( this->nest_i );
+      }
+      this->nestpow_i = astFree( this->nestpow_i );
    }
 }
 
@@ -1608,6 +1640,215 @@ static AstPolyMap **GetJacobian( AstPolyMap *this, int *status ){
    return this->jacobian;
 }
 
+static void JacobianPoints( AstMapping *this, AstPointSet *in, int forward,
+                            AstPointSet *jac, int *status ) {
+/*
+*  Name:
+*     JacobianPoints
+
+*  Purpose:
+*     Find the Jacobian matrix of a Mapping at a set of points.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "polymap.h"
+*     void JacobianPoints( AstMapping *this, AstPointSet *in, int forward,
+*                          AstPointSet *jac, int *status )
+
+*  Class Membership:
+*     PolyMap member function (over-rides the astJacobianPoints protected
+*     method inherited from the Mapping class).
+
+*  Description:
+*     This function finds the Jacobian matrix of the forward or inverse
+*     transformation of a PolyMap at each of the points in a PointSet,
+*     by differentiating the polynomials analytically. The derivatives of
+*     the basis functions are found using the astPolyPowerDerivs method,
+*     so that sub-classes that use different basis functions (such as
+*     ChebyMaps) are also handled. If the transformation is implemented
+*     by an iterative inverse, the parent method is used instead.
+
+*  Parameters:
+*     this
+*        Pointer to the PolyMap.
+*     in
+*        Pointer to the PointSet holding the positions at which the
+*        Jacobian is required.
+*     forward
+*        A non-zero value indicates that the Jacobian of the forward
+*        coordinate transformation is required, while a zero value
+*        requests the Jacobian of the inverse transformation.
+*     jac
+*        Pointer to the PointSet in which to store the Jacobian.
+*     status
+*        Pointer to the inherited status variable.
+*/
+
+/* Local Variables: */
+   AstPolyMap *map;              /* Pointer to PolyMap */
+   double **coeff;               /* Pointer to coefficient value arrays */
+   double **dwork;               /* Derivatives of basis functions */
+   double **ptr_in;              /* Pointer to input coordinate data */
+   double **ptr_jac;             /* Pointer to Jacobian data */
+   double **work;                /* Basis function values */
+   double *deriv;                /* Derivatives of current output */
+   double *outcof;               /* Pointer to next coefficient value */
+   double term;                  /* Derivative of current term */
+   double xp;                    /* Basis function value */
+   int ***power;                 /* Pointer to coefficient power arrays */
+   int **outpow;                 /* Pointer to next set of axis powers */
+   int *mxpow;                   /* Pointer to max used power for each input */
+   int *ncoeff;                  /* Pointer to no. of coefficients */
+   int fwd;                      /* Use original forward transformation? */
+   int ico;                      /* Coefficient index */
+   int in_coord;                 /* Index of input coordinate */
+   int jn_coord;                 /* Index of differentiated coordinate */
+   int ncoord_in;                /* Number of coordinates per input point */
+   int ncoord_out;               /* Number of coordinates per output point */
+   int npoint;                   /* Number of points */
+   int out_coord;                /* Index of output coordinate */
+   int point;                    /* Loop counter for points */
+   int pow;                      /* Next axis power */
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* Obtain a pointer to the PolyMap, and determine whether to use the
+   original forward or inverse transformation. */
+   map = (AstPolyMap *) this;
+   fwd = astGetInvert( map ) ? !forward : forward;
+
+/* If the iterative inverse is to be used, use the parent method. */
+   if( !fwd && astGetIterInverse( map ) ) {
+      (*parent_jacobianpoints)( this, in, forward, jac, status );
+      return;
+   }
+
+/* Get the dimensions and data pointers. */
+   ncoord_in = astGetNcoord( in );
+   ncoord_out = forward ? astGetNout( this ) : astGetNin( this );
+   npoint = astGetNpoint( in );
+   ptr_in = astGetPoints( in );
+   ptr_jac = astGetPoints( jac );
+
+/* Get a pointer to the arrays holding the required coefficient
+   values and powers. */
+   if ( fwd ) {
+      ncoeff = map->ncoeff_f;
+      coeff = map->coeff_f;
+      power = map->power_f;
+      mxpow = map->mxpow_f;
+   } else {
+      ncoeff = map->ncoeff_i;
+      coeff = map->coeff_i;
+      power = map->power_i;
+      mxpow = map->mxpow_i;
+   }
+
+/* Allocate memory to hold the basis function values and derivatives. */
+   work = astCalloc( ncoord_in, sizeof( double * ) );
+   dwork = astCalloc( ncoord_in, sizeof( double * ) );
+   deriv = astMalloc( sizeof( double )*(size_t) ncoord_in );
+   if( astOK ) {
+      for( in_coord = 0; in_coord < ncoord_in; in_coord++ ) {
+         work[ in_coord ] = astMalloc( sizeof( double )*
+                           (size_t) ( astMAX( 2, mxpow[in_coord]+1 ) ) );
+         dwork[ in_coord ] = astMalloc( sizeof( double )*
+                           (size_t) ( astMAX( 2, mxpow[in_coord]+1 ) ) );
+      }
+   }
+
+/* Loop round each point. */
+   if ( astOK ) {
+      for ( point = 0; point < npoint; point++ ) {
+
+/* Find the basis function values and their derivatives. */
+         astPolyPowerDerivs( this, work, dwork, ncoord_in, mxpow, ptr_in,
+                             point, fwd );
+
+/* Loop round each output, initialising the derivatives with respect to
+   each input. */
+         for( out_coord = 0; out_coord < ncoord_out; out_coord++ ) {
+            for( jn_coord = 0; jn_coord < ncoord_in; jn_coord++ ) {
+               deriv[ jn_coord ] = 0.0;
+            }
+
+/* Loop round all polynomial coefficients. */
+            outcof = coeff[ out_coord ];
+            outpow = power[ out_coord ];
+            for ( ico = 0; ico < ncoeff[ out_coord ];
+                  ico++, outcof++, outpow++ ) {
+
+/* A bad coefficient makes all the derivatives bad. */
+               if( *outcof == AST__BAD ) {
+                  for( jn_coord = 0; jn_coord < ncoord_in; jn_coord++ ) {
+                     deriv[ jn_coord ] = AST__BAD;
+                  }
+                  break;
+               }
+
+/* The derivative of the term with respect to each input is the product
+   of the coefficient, the derivative of the basis function for that
+   input, and the basis functions for all other inputs. Skip
+   derivatives that are already bad. */
+               for( jn_coord = 0; jn_coord < ncoord_in; jn_coord++ ) {
+                  if( deriv[ jn_coord ] == AST__BAD ||
+                      (*outpow)[ jn_coord ] == 0 ) continue;
+
+                  term = *outcof;
+                  for( in_coord = 0; in_coord < ncoord_in &&
+                                     term != AST__BAD; in_coord++ ) {
+                     pow = (*outpow)[ in_coord ];
+                     if( in_coord == jn_coord ) {
+                        xp = dwork[ in_coord ][ pow ];
+                     } else if( pow > 0 ) {
+                        xp = work[ in_coord ][ pow ];
+                     } else {
+                        continue;
+                     }
+                     term = ( xp != AST__BAD ) ? term*xp : AST__BAD;
+                  }
+
+                  if( term != AST__BAD ) {
+                     deriv[ jn_coord ] += term;
+                  } else {
+                     deriv[ jn_coord ] = AST__BAD;
+                  }
+               }
+            }
+
+/* Store the derivatives. A bad input value makes all derivatives
+   bad (as the output value itself is bad). */
+            for( jn_coord = 0; jn_coord < ncoord_in; jn_coord++ ) {
+               if( ptr_in[ jn_coord ][ point ] == AST__BAD ) {
+                  for( in_coord = 0; in_coord < ncoord_in; in_coord++ ) {
+                     deriv[ in_coord ] = AST__BAD;
+                  }
+                  break;
+               }
+            }
+            for( jn_coord = 0; jn_coord < ncoord_in; jn_coord++ ) {
+               ptr_jac[ out_coord*ncoord_in + jn_coord ][ point ] =
+                                                        deriv[ jn_coord ];
+            }
+         }
+      }
+   }
+
+/* Free resources. */
+   if( work && dwork ) {
+      for( in_coord = 0; in_coord < ncoord_in; in_coord++ ) {
+         work[ in_coord ] = astFree( work[ in_coord ] );
+         dwork[ in_coord ] = astFree( dwork[ in_coord ] );
+      }
+   }
+   work = astFree( work );
+   dwork = astFree( dwork );
+   deriv = astFree( deriv );
+}
+
 static int GetObjSize( AstObject *this_object, int *status ) {
 /*
 *  Name:
@@ -1665,6 +1906,20 @@ static int GetObjSize( AstObject *this_object, int *status ) {
    which are stored in dynamically allocated memory. */
    result = (*parent_getobjsize)( this_object, status );
 
+   if( this->nest_f ) {
+      nc = ( (AstMapping *) this )->nout;
+      for( ic = 0; ic < nc; ic++ ) result += astTSizeOf( this->nest_f[ ic ] );
+      result += astTSizeOf( this->nest_f );
+      result += astTSizeOf( this->nestpow_f );
+   }
+
+   if( this->nest_i ) {
+      nc = ( (AstMapping *) this )->nin;
+      for( ic = 0; ic < nc; ic++ ) result += astTSizeOf( this->nest_i[ ic ] );
+      result += astTSizeOf( this->nest_i );
+      result += astTSizeOf( this->nestpow_i );
+   }
+
    if( this->jacobian ) {
       nc = astGetNin( this );
       for( ic = 0; ic < nc; ic++ ) {
@@ -1888,6 +2143,8 @@ void astInitPolyMapVtab_(  AstPolyMapVtab *vtab, const char *name, int *status )
 /* Store pointers to the member functions (implemented here) that provide
    virtual methods for this class. */
    vtab->PolyPowers = PolyPowers;
+   vtab->PolyPowerDerivs = PolyPowerDerivs;
+   vtab->PolyBasis = PolyBasis;
    vtab->FitPoly1DInit = FitPoly1DInit;
    vtab->FitPoly2DInit = FitPoly2DInit;
    vtab->PolyTran = PolyTran;
@@ -1916,10 +2173,8 @@ void astInitPolyMapVtab_(  AstPolyMapVtab *vtab, const char *name, int *status )
    parent_getobjsize = object->GetObjSize;
    object->GetObjSize = GetObjSize;
 
-#if defined(THREAD_SAFE)
    parent_managelock = object->ManageLock;
    object->ManageLock = ManageLock;
-#endif
 
    parent_clearattrib = object->ClearAttrib;
    object->ClearAttrib = ClearAttrib;
@@ -1932,6 +2187,9 @@ void astInitPolyMapVtab_(  AstPolyMapVtab *vtab, const char *name, int *status )
 
    parent_transform = mapping->Transform;
    mapping->Transform = Transform;
+   parent_jacobianpoints = mapping->JacobianPoints;
+   mapping->JacobianPoints = JacobianPoints;
+   mapping->ThreadSafe = ThreadSafe;
    mapping->GetTranForward = GetTranForward;
    mapping->GetTranInverse = GetTranInverse;
 
@@ -1979,6 +2237,12 @@ static void IterInverse( AstPolyMap *this, AstPointSet *out, AstPointSet *result
 *     is assumed to be zero). An iterative Newton-Raphson method is used
 *     which only required the original forward transformation of the PolyMap
 *     to be defined.
+*
+*     The positions are divided into blocks of at most ITER_NPOINT
+*     points, each of which is inverted by IterInverseJob. If the NThread
+*     tuning parameter is larger than one, the blocks are inverted
+*     concurrently using astRunJobs. Since each position is inverted
+*     independently, the results do not depend on the value of NThread.
 
 *  Parameters:
 *     this
@@ -1994,78 +2258,188 @@ static void IterInverse( AstPolyMap *this, AstPointSet *out, AstPointSet *result
 *     status
 *        Pointer to the inherited status variable.
 
+*  Notes:
+*     - Bad values are returned for any position at which the required
+*     output position, the forward transformation or the Jacobian is bad,
+*     or at which the Jacobian matrix is singular.
+
 */
 
 /* Local Variables: */
    AstMapping *lintrunc;
+   IterInverseJobs jobs;
+   double maxerr;
+   int ijob;
+   int njob;
+
+/* Check inherited status */
+   if( !astOK ) return;
+
+/* Check the PolyMap has equal numbers of inputs and outputs. */
+   jobs.ncoord = astGetNin( this );
+   if( jobs.ncoord != astGetNout( this ) ) {
+      astError( AST__INTER, "astTransform(%s): Supplied %s has unequal numbers"
+                " of inputs and outputs and therefore an iterative inverse "
+                "cannot be used (internal AST Programming errpr).", status,
+                astGetClass(this), astGetClass(this) );
+   }
+
+/* Get information about the Jacobian matrix for the forward polynomial
+   transformation. This matrix is a ncoord X ncoord matrix, in which
+   element (row=I,col=J) is the rate of change of output coord I with
+   respect to input coord J, of the supplied PolyMap's forward transformation.
+   The numerical values of the matrix vary depending on where it is
+   evaluated within the input space of the PolyMap. For this reason, the
+   "jacob" variable holds a vector of "ncoord" PolyMaps. The outputs of
+   each of these PolyMaps corresponds to a single column in the Jacobian
+   matrix. The Jacobian is created and stored in the PolyMap by the
+   calling thread, before any jobs are started. */
+   jobs.jacob = GetJacobian( this, status );
+
+/* Store the initial guess at the required input positions. These are
+   determined by transforming the supplied output positions using the
+   inverse of a linear truncation of the PolyMap's forward
+   transformation. */
+   lintrunc = LinearGuess( this, status );
+   if( astOK ) (void) astTransform( lintrunc, out, 0, result );
+   if( lintrunc ) lintrunc = astAnnul( lintrunc );
+
+/* Get the target relative error for the returned input axis values, and
+   square it. */
+   maxerr = astGetTolInverse( this );
+
+/* Store the values needed by each job. Note, here "in" and "out" refer
+   to inputs and outputs of the PolyMap (i.e. the forward
+   transformation). These are respectively *outputs* and *inputs* of the
+   inverse transformation. */
+   jobs.this = this;
+   jobs.fwd = !astGetInvert( this );
+   jobs.maxiter = astGetNiterInverse( this );
+   jobs.maxerr = maxerr*maxerr;
+   jobs.npoint = astGetNpoint( out );
+   jobs.ptr_in = astGetPoints( result );
+   jobs.ptr_out = astGetPoints( out );
+
+/* Invert each block of points, using several threads if the PolyMap may
+   be used safely by several threads at once. */
+   if( astOK && jobs.npoint > 0 ) {
+      njob = ( jobs.npoint - 1 )/ITER_NPOINT + 1;
+      if( njob > 1 && astThreadSafe( this ) ) {
+         astRunJobs( njob, IterInverseJob, &jobs );
+      } else {
+         for( ijob = 0; ijob < njob && astOK; ijob++ ) {
+            IterInverseJob( ijob, &jobs, status );
+         }
+      }
+   }
+}
+
+static void IterInverseJob( int ijob, void *data, int *status ){
+/*
+*  Name:
+*     IterInverseJob
+
+*  Purpose:
+*     Invert a single block of points recorded in an IterInverseJobs
+*     structure.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     void IterInverseJob( int ijob, void *data, int *status )
+
+*  Description:
+*     This function is invoked by astRunJobs (and also directly by
+*     IterInverse) to find the original input positions corresponding
+*     to one block of the original output positions described by an
+*     IterInverseJobs structure. On entry, the input positions hold an
+*     initial guess, which is refined by Newton-Raphson iteration.
+*
+*     The positions that have not yet converged are kept in a compact
+*     list, and only these positions are transformed on each iteration.
+*     The Newton-Raphson step for each position is found using Cramer's
+*     rule if the PolyMap has 1, 2 or 3 inputs, and by Gaussian
+*     elimination otherwise.
+
+*  Parameters:
+*     ijob
+*        The zero-based index of the block to invert.
+*     data
+*        Pointer to the IterInverseJobs structure.
+*     status
+*        Pointer to the inherited status variable.
+
+*/
+
+/* Local Constants: */
+#define SING 1.0E-20     /* Smallest usable determinant (as used by palDmat) */
+
+/* Local Variables: */
+   AstPointSet *act;
    AstPointSet *work;
    AstPointSet **ps_jac;
    AstPolyMap **jacob;
+   IterInverseJobs *jobs;
    double *vec;
-   double *pb;
+   double **ptr_act;
    double **ptr_work;
    double ***ptr_jac;
    double *mat;
    double **ptr_out;
    double **ptr_in;
    double *pa;
+   double a11, a12, a13, a21, a22, a23, a31, a32, a33;
+   double c11, c12, c13;
    double det;
+   double dy1, dy2, dy3;
    double maxerr;
    double vlensq;
    double xlensq;
    double xx;
-   int *flags;
+   int *active;
    int *iw;
-   int fwd;
+   int first;
    int icol;
    int icoord;
    int ipoint;
    int irow;
    int iter;
-   int maxiter;
-   int nconv;
+   int k;
+   int nact;
    int ncoord;
+   int newnact;
    int npoint;
    int sing;
 
 /* Check inherited status */
    if( !astOK ) return;
 
-/* Check the PolyMap has equal numbers of inputs and outputs. */
-   ncoord = astGetNin( this );
-   if( ncoord != astGetNout( this ) ) {
-      astError( AST__INTER, "astTransform(%s): Supplied %s has unequal numbers"
-                " of inputs and outputs and therefore an iterative inverse "
-                "cannot be used (internal AST Programming errpr).", status,
-                astGetClass(this), astGetClass(this) );
+/* Find the first point in the block, and the number of points. */
+   jobs = (IterInverseJobs *) data;
+   first = ijob*ITER_NPOINT;
+   npoint = astMIN( ITER_NPOINT, jobs->npoint - first );
+   ncoord = jobs->ncoord;
+   jacob = jobs->jacob;
+   maxerr = jobs->maxerr;
+
+/* Get pointers to the input and output values for the block. */
+   ptr_in = astMalloc( sizeof( double * )*ncoord );
+   ptr_out = astMalloc( sizeof( double * )*ncoord );
+   if( astOK ) {
+      for( icoord = 0; icoord < ncoord; icoord++ ) {
+         ptr_in[ icoord ] = jobs->ptr_in[ icoord ] + first;
+         ptr_out[ icoord ] = jobs->ptr_out[ icoord ] + first;
+      }
    }
 
-/* Get information about the Jacobian matrix for the forward polynomial
-   transformation. This matrix is a ncoord X ncoord matrix, in which
-   element (row=I,col=J) is the rate of change of output coord I with
-   respect to input coord J, of the supplied PolyMap's forward transformation.
-   The numerical values of the matrix vary depending on where it is
-   evaluated within the input space of the PolyMap. For this reason, the
-   "jacob" variable holds a vector of "ncoord" PolyMaps. The outputs of
-   each of these PolyMaps corresponds to a single column in the Jacobian
-   matrix. */
-   jacob = GetJacobian( this, status );
-
-/* Get the number of points to be transformed. */
-   npoint = astGetNpoint( out );
-
-/* Get another PointSet to hold intermediate results. */
+/* Get a PointSet to hold the current input position guesses at the
+   positions that have not yet converged, and another to hold the
+   corresponding output offsets. The number of points in these PointSets
+   is reduced as positions converge. */
+   act = astPointSet( npoint, ncoord, " ", status );
    work = astPointSet( npoint, ncoord, " ", status );
-
-/* See if the PolyMap has been inverted.*/
-   fwd = !astGetInvert( this );
-
-/* Get pointers to the data arrays for all PointSets. Note, here "in" and
-   "out" refer to inputs and outputs of the PolyMap (i.e. the forward
-   transformation). These are respectively *outputs* and *inputs* of the
-   inverse transformation. */
-   ptr_in = astGetPoints( result );  /* Returned input positions */
-   ptr_out = astGetPoints( out );    /* Supplied output positions */
+   ptr_act = astGetPoints( act );    /* Unconverged input positions */
    ptr_work = astGetPoints( work );  /* Work space */
 
 /* Allocate an array of PointSets to hold the elements of the Jacobian
@@ -2079,9 +2453,9 @@ static void IterInverse( AstPolyMap *this, AstPointSet *out, AstPointSet *result
       }
    }
 
-/* Allocate an array to hold flags indicating if each position has
-   converged. Initialise it to hold zero at every element. */
-   flags = astCalloc( npoint, sizeof( int ) );
+/* Allocate an array to hold the indices of the positions that have not
+   yet converged. */
+   active = astMalloc( sizeof( int )*npoint );
 
 /* Allocate memory to hold the Jacobian matrix at a single point. */
    mat = astMalloc( sizeof( double )*ncoord*ncoord );
@@ -2095,116 +2469,194 @@ static void IterInverse( AstPolyMap *this, AstPointSet *out, AstPointSet *result
 /* Check pointers can be used safely. */
    if( astOK ) {
 
-/* Store the initial guess at the required input positions. These are
-   determined by transforming the supplied output positions using the
-   inverse of a linear truncation of the PolyMap's forward
-   transformation. */
-      lintrunc = LinearGuess( this, status );
-      (void) astTransform( lintrunc, out, 0, result );
-      lintrunc = astAnnul( lintrunc );
-
-/* Get the maximum number of iterations to perform. */
-      maxiter = astGetNiterInverse( this );
-
-/* Get the target relative error for the returned input axis values, and
-   square it. */
-      maxerr = astGetTolInverse( this );
-      maxerr *= maxerr;
-
-/* Initialise the number of positions which have reached the required
-   accuracy. */
-      nconv = 0;
+/* Initially, all positions are unconverged. */
+      nact = npoint;
+      for( ipoint = 0; ipoint < npoint; ipoint++ ) active[ ipoint ] = ipoint;
 
 /* Loop round doing iterations of a Newton-Raphson algorithm, until
    all points have achieved the required relative error, or the
    maximum number of iterations have been performed. */
-      for( iter = 0; iter < maxiter && nconv < npoint && astOK; iter++ ) {
+      for( iter = 0; iter < jobs->maxiter && nact > 0 && astOK; iter++ ) {
+
+/* Copy the current guesses at the unconverged input positions into the
+   "act" PointSet, and reduce the size of the other PointSets to match. */
+         for( icoord = 0; icoord < ncoord; icoord++ ) {
+            pa = ptr_act[ icoord ];
+            for( k = 0; k < nact; k++ ) {
+               pa[ k ] = ptr_in[ icoord ][ active[ k ] ];
+            }
+            astSetNpoint( ps_jac[ icoord ], nact );
+         }
+         astSetNpoint( act, nact );
+         astSetNpoint( work, nact );
 
 /* Use the original forward transformation of the supplied PolyMap to
    transform the current guesses at the required input positions into
    the corresponding output positions. Store the results in the "work"
    PointSet. */
-         (void) astTransform( this, result, fwd, work );
+         (void) astTransform( jobs->this, act, jobs->fwd, work );
+
+/* Evaluate the elements of the Jacobian matrix at the current input
+   position guesses. */
+         for( icoord = 0; icoord < ncoord; icoord++ ) {
+            (void) astTransform( jacob[ icoord ], act, 1, ps_jac[ icoord ] );
+         }
 
 /* Modify the work PointSet so that it holds the offsets from the output
    positions produced by the current input position guesses, and the
    required output positions. */
          for( icoord = 0; icoord < ncoord; icoord++ ) {
-            pa = ptr_out[ icoord ];
-            pb = ptr_work[ icoord ];
-            for( ipoint = 0; ipoint< npoint; ipoint++,pa++,pb++ ) {
-               if( *pa != AST__BAD && *pb != AST__BAD ){
-                  *pb = *pa - *pb;
+            pa = ptr_work[ icoord ];
+            for( k = 0; k < nact; k++ ) {
+               xx = ptr_out[ icoord ][ active[ k ] ];
+               if( xx != AST__BAD && pa[ k ] != AST__BAD ){
+                  pa[ k ] = xx - pa[ k ];
                } else {
-                  *pb = AST__BAD;
+                  pa[ k ] = AST__BAD;
                }
             }
          }
-
-/* Evaluate the elements of the Jacobian matrix at the current input
-   position guesses. */
-         for( icoord = 0; icoord < ncoord; icoord++ ) {
-            (void) astTransform( jacob[ icoord ], result, 1, ps_jac[ icoord ] );
-         }
+         if( !astOK ) break;
 
 /* For each position, we now invert the matrix equation
 
     Dy = Jacobian.Dx
 
    to find a guess at the vector (dx) holding the offsets from the
-   current input positions guesses to their required values. Loop over all
-   points. */
-         for( ipoint = 0; ipoint < npoint; ipoint++ ) {
+   current input positions guesses to their required values. The offsets
+   are stored in the work PointSet in place of Dy. A bad value is stored
+   for the first offset if the matrix is singular or contains bad values.
+   Small matrices are inverted using Cramer's rule. */
+         if( ncoord == 1 ) {
+            for( k = 0; k < nact; k++ ) {
+               a11 = ptr_jac[ 0 ][ 0 ][ k ];
+               dy1 = ptr_work[ 0 ][ k ];
+               if( a11 == AST__BAD || dy1 == AST__BAD || fabs( a11 ) < SING ) {
+                  ptr_work[ 0 ][ k ] = AST__BAD;
+               } else {
+                  ptr_work[ 0 ][ k ] = dy1/a11;
+               }
+            }
+
+         } else if( ncoord == 2 ) {
+            for( k = 0; k < nact; k++ ) {
+               a11 = ptr_jac[ 0 ][ 0 ][ k ];
+               a21 = ptr_jac[ 0 ][ 1 ][ k ];
+               a12 = ptr_jac[ 1 ][ 0 ][ k ];
+               a22 = ptr_jac[ 1 ][ 1 ][ k ];
+               dy1 = ptr_work[ 0 ][ k ];
+               dy2 = ptr_work[ 1 ][ k ];
+               det = a11*a22 - a12*a21;
+               if( a11 == AST__BAD || a21 == AST__BAD || a12 == AST__BAD ||
+                   a22 == AST__BAD || dy1 == AST__BAD || dy2 == AST__BAD ||
+                   fabs( det ) < SING ) {
+                  ptr_work[ 0 ][ k ] = AST__BAD;
+               } else {
+                  ptr_work[ 0 ][ k ] = ( a22*dy1 - a12*dy2 )/det;
+                  ptr_work[ 1 ][ k ] = ( a11*dy2 - a21*dy1 )/det;
+               }
+            }
+
+         } else if( ncoord == 3 ) {
+            for( k = 0; k < nact; k++ ) {
+               a11 = ptr_jac[ 0 ][ 0 ][ k ];
+               a21 = ptr_jac[ 0 ][ 1 ][ k ];
+               a31 = ptr_jac[ 0 ][ 2 ][ k ];
+               a12 = ptr_jac[ 1 ][ 0 ][ k ];
+               a22 = ptr_jac[ 1 ][ 1 ][ k ];
+               a32 = ptr_jac[ 1 ][ 2 ][ k ];
+               a13 = ptr_jac[ 2 ][ 0 ][ k ];
+               a23 = ptr_jac[ 2 ][ 1 ][ k ];
+               a33 = ptr_jac[ 2 ][ 2 ][ k ];
+               dy1 = ptr_work[ 0 ][ k ];
+               dy2 = ptr_work[ 1 ][ k ];
+               dy3 = ptr_work[ 2 ][ k ];
+
+               if( a11 == AST__BAD || a21 == AST__BAD || a31 == AST__BAD ||
+                   a12 == AST__BAD || a22 == AST__BAD || a32 == AST__BAD ||
+                   a13 == AST__BAD || a23 == AST__BAD || a33 == AST__BAD ||
+                   dy1 == AST__BAD || dy2 == AST__BAD || dy3 == AST__BAD ) {
+                  ptr_work[ 0 ][ k ] = AST__BAD;
+                  continue;
+               }
+
+               c11 = a22*a33 - a23*a32;
+               c12 = a23*a31 - a21*a33;
+               c13 = a21*a32 - a22*a31;
+               det = a11*c11 + a12*c12 + a13*c13;
+               if( fabs( det ) < SING ) {
+                  ptr_work[ 0 ][ k ] = AST__BAD;
+               } else {
+                  ptr_work[ 0 ][ k ] = ( c11*dy1 + ( a13*a32 - a12*a33 )*dy2
+                                       + ( a12*a23 - a13*a22 )*dy3 )/det;
+                  ptr_work[ 1 ][ k ] = ( c12*dy1 + ( a11*a33 - a13*a31 )*dy2
+                                       + ( a13*a21 - a11*a23 )*dy3 )/det;
+                  ptr_work[ 2 ][ k ] = ( c13*dy1 + ( a12*a31 - a11*a32 )*dy2
+                                       + ( a11*a22 - a12*a21 )*dy3 )/det;
+               }
+            }
 
-/* Do not change positions that have already converged. */
-            if( !flags[ ipoint ] ) {
+/* Larger matrices are inverted using palDmat. */
+         } else {
+            for( k = 0; k < nact; k++ ) {
 
 /* Get the numerical values for the elements of the Jacobian matrix at
-   the current point. */
+   the current point, and the offset from the current output position to
+   the required output position. */
+               sing = 0;
                pa = mat;
                for( irow = 0; irow < ncoord; irow++ ) {
                   for( icol = 0; icol < ncoord; icol++ ) {
-                     *(pa++) = ptr_jac[ icol ][ irow ][ ipoint ];
+                     *pa = ptr_jac[ icol ][ irow ][ k ];
+                     if( *(pa++) == AST__BAD ) sing = 1;
                   }
-
-/* Store the offset from the current output position to the required
-   output position. */
-                  vec[ irow ] = ptr_work[ irow ][ ipoint ];
+                  vec[ irow ] = ptr_work[ irow ][ k ];
+                  if( vec[ irow ] == AST__BAD ) sing = 1;
                }
 
 /* Find the corresponding offset from the current input position to the required
    input position. */
-               palDmat( ncoord, mat, vec, &det, &sing, iw );
+               if( !sing ) palDmat( ncoord, mat, vec, &det, &sing, iw );
 
-/* If the matrix was singular, the input position cannot be evaluated so
-   store a bad value for it and indicate it has converged. */
                if( sing ) {
+                  ptr_work[ 0 ][ k ] = AST__BAD;
+               } else {
                   for( icoord = 0; icoord < ncoord; icoord++ ) {
-                     ptr_in[ icoord ][ ipoint ] = AST__BAD;
+                     ptr_work[ icoord ][ k ] = vec[ icoord ];
                   }
-                  flags[ ipoint ] = 1;
-                  nconv++;
+               }
+            }
+         }
 
-/* Otherwise, update the input position guess. */
-               } else {
-                  vlensq = 0.0;
-                  xlensq = 0.0;
-                  pa = vec;
-                  for( icoord = 0; icoord < ncoord; icoord++,pa++ ) {
-                     xx = ptr_in[ icoord ][ ipoint ] + (*pa);
-                     ptr_in[ icoord ][ ipoint ] = xx;
-                     xlensq += xx*xx;
-                     vlensq += (*pa)*(*pa);
-                  }
+/* Loop over all unconverged points, updating the input position guesses
+   and removing converged positions from the list. */
+         newnact = 0;
+         for( k = 0; k < nact; k++ ) {
+            ipoint = active[ k ];
+
+/* If the input position cannot be evaluated store a bad value for it,
+   and indicate it has converged. */
+            if( ptr_work[ 0 ][ k ] == AST__BAD ) {
+               for( icoord = 0; icoord < ncoord; icoord++ ) {
+                  ptr_in[ icoord ][ ipoint ] = AST__BAD;
+               }
 
-/* Check for convergence. */
-                  if( vlensq <= maxerr*xlensq ) {
-                     flags[ ipoint ] = 1;
-                     nconv++;
-                  }
+/* Otherwise, update the input position guess. */
+            } else {
+               vlensq = 0.0;
+               xlensq = 0.0;
+               for( icoord = 0; icoord < ncoord; icoord++ ) {
+                  xx = ptr_act[ icoord ][ k ] + ptr_work[ icoord ][ k ];
+                  ptr_in[ icoord ][ ipoint ] = xx;
+                  xlensq += xx*xx;
+                  vlensq += ptr_work[ icoord ][ k ]*ptr_work[ icoord ][ k ];
                }
+
+/* Retain the position in the list if it has not yet converged. */
+               if( vlensq > maxerr*xlensq ) active[ newnact++ ] = ipoint;
             }
          }
+         nact = newnact;
       }
    }
 
@@ -2212,18 +2664,141 @@ static void IterInverse( AstPolyMap *this, AstPointSet *out, AstPointSet *result
    vec = astFree( vec );
    iw = astFree( iw );
    mat = astFree( mat );
-   flags = astFree( flags );
+   active = astFree( active );
+   act = astAnnul( act );
    work = astAnnul( work );
 
    if( ps_jac ) {
       for( icoord = 0; icoord < ncoord; icoord++ ) {
-         ps_jac[ icoord ] = astAnnul( ps_jac[ icoord ] );
+         if( ps_jac[ icoord ] ) ps_jac[ icoord ] = astAnnul( ps_jac[ icoord ] );
       }
       ps_jac = astFree( ps_jac );
    }
 
    ptr_jac = astFree( ptr_jac );
+   ptr_in = astFree( ptr_in );
+   ptr_out = astFree( ptr_out );
+}
+#undef SING
+
+static void LeastSquares( int nsamp, int ncof, double *design, int nrhs,
+                          double **rhs, double *coeffs, int *status ){
+/*
+*  Name:
+*     LeastSquares
+
+*  Purpose:
+*     Find the linear least squares solution for one or more data vectors.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     void LeastSquares( int nsamp, int ncof, double *design, int nrhs,
+*                        double **rhs, double *coeffs, int *status )
+
+*  Description:
+*     This function finds the coefficients that minimise the sum of the
+*     squared residuals between a linear model and a supplied data
+*     vector, for each of one or more data vectors that share the same
+*     design matrix. The design matrix is decomposed once using a QR
+*     factorisation with column pivoting (cminpack qrfac), and each
+*     solution is then found by back-substitution (cminpack qrsolv). This
+*     is used in place of a general non-linear minimisation since a
+*     polynomial is linear in its coefficients. If the design matrix is
+*     rank deficient, a least squares solution is still returned.
+
+*  Parameters:
+*     nsamp
+*        The number of samples (i.e. rows in the design matrix). Must be
+*        at least "ncof".
+*     ncof
+*        The number of coefficients (i.e. columns in the design matrix).
+*     design
+*        An array of "nsamp*ncof" elements holding the design matrix.
+*        Element "k + c*nsamp" holds the value of the basis function for
+*        coefficient "c" at sample "k". The contents of the array are
+*        destroyed on exit.
+*     nrhs
+*        The number of data vectors.
+*     rhs
+*        An array of "nrhs" pointers, each pointing to an array of "nsamp"
+*        data values.
+*     coeffs
+*        An array of "nrhs*ncof" elements in which to return the
+*        coefficients. The coefficients for data vector "i" are returned
+*        in elements "i*ncof" to "i*ncof+ncof-1".
+*     status
+*        Pointer to the inherited status variable.
+*/
+
+/* Local Variables: */
+   double *acnorm;
+   double *diag;
+   double *pa;
+   double *qtb;
+   double *rdiag;
+   double *sdiag;
+   double *wa;
+   double sum;
+   double temp;
+   int *ipvt;
+   int i;
+   int irhs;
+   int j;
+
+/* Check inherited status */
+   if( !astOK ) return;
+
+/* Allocate work space. The "diag" array is filled with zeros, so that
+   qrsolv does not apply any damping. */
+   ipvt = astMalloc( ncof*sizeof( int ) );
+   rdiag = astMalloc( ncof*sizeof( double ) );
+   acnorm = astMalloc( ncof*sizeof( double ) );
+   sdiag = astMalloc( ncof*sizeof( double ) );
+   wa = astMalloc( ncof*sizeof( double ) );
+   diag = astCalloc( ncof, sizeof( double ) );
+   qtb = astMalloc( nrhs*nsamp*sizeof( double ) );
+   if( astOK ) {
+
+/* Form the QR factorisation of the design matrix. On exit, the upper
+   triangle of "design" holds R (except for the diagonal, which is in
+   "rdiag"), and the lower trapezoid holds the Householder vectors that
+   define Q. */
+      qrfac( nsamp, ncof, design, nsamp, 1, ipvt, ncof, rdiag, acnorm, wa );
+
+/* Form (Q transpose)*rhs for each data vector, in the same way as lmder. */
+      for( irhs = 0; irhs < nrhs; irhs++ ) {
+         pa = qtb + irhs*nsamp;
+         for( i = 0; i < nsamp; i++ ) pa[ i ] = rhs[ irhs ][ i ];
+
+         for( j = 0; j < ncof; j++ ) {
+            if( design[ j + j*nsamp ] != 0.0 ) {
+               sum = 0.0;
+               for( i = j; i < nsamp; i++ ) sum += design[ i + j*nsamp ]*pa[ i ];
+               temp = -sum/design[ j + j*nsamp ];
+               for( i = j; i < nsamp; i++ ) pa[ i ] += design[ i + j*nsamp ]*temp;
+            }
+         }
+      }
+
+/* Store the diagonal of R in the design matrix, and then solve R*x =
+   (Q transpose)*rhs for each data vector. */
+      for( j = 0; j < ncof; j++ ) design[ j + j*nsamp ] = rdiag[ j ];
+      for( irhs = 0; irhs < nrhs; irhs++ ) {
+         qrsolv( ncof, design, nsamp, ipvt, diag, qtb + irhs*nsamp,
+                 coeffs + irhs*ncof, sdiag, wa );
+      }
+   }
 
+/* Free resources. */
+   ipvt = astFree( ipvt );
+   rdiag = astFree( rdiag );
+   acnorm = astFree( acnorm );
+   sdiag = astFree( sdiag );
+   wa = astFree( wa );
+   diag = astFree( diag );
+   qtb = astFree( qtb );
 }
 
 static AstMapping *LinearGuess( AstPolyMap *this, int *status ){
@@ -2637,102 +3212,26 @@ static void LMFunc2D( const double *p, double *hx, int m, int n, void *adata ){
    }
 }
 
-static void LMJacob1D( const double *p, double *jac, int m, int n, void *adata ){
-/*
-*  Name:
-*     LMJacob1D
-
-*  Purpose:
-*     Evaluate the Jacobian matrix of a test 1D polynomal.
-
-*  Type:
-*     Private function.
-
-*  Synopsis:
-*     void LMJacob1D( const double *p, double *jac, int m, int n, void *adata )
-
-*  Description:
-*     This function finds the Jacobian matrix that describes the rate of
-*     change of every residual with respect to every polynomial coefficient.
-*     Each residual is a candidate polynomial evaluated at one of the sample
-*     points minus the supplied target value for the polynomial at that test
-*     point.
-*
-*     For a polynomial the Jacobian matrix is constant (i.e. does not
-*     depend on the values of the polynomial coefficients). So we only
-*     evaluate it on the first call.
-
-*  Parameters:
-*     p
-*        An array of "m" coefficients for the candidate polynomial.
-*     jac
-*        An array in which to return the "m*n" elements of the Jacobian
-*        matrix. The rate of change of residual "r" with respect to
-*        coefficient "c" is returned in element "r + c*n". The residual
-*        at sample "k" of polynomial Pi has an "r" index of (k + nsamp*i).
-*        The coefficient of (x1^j) for polynomial Pi has a "c" index
-*        of j.
-*     m
-*        The length of the "p" array. This should be equal to order.
-*     n
-*        The number of residuals. This should be equal to nsamp.
-*     adata
-*        Pointer to a structure holding the sample positions and values,
-*        and other information.
-
-*/
-
-/* Local Variables: */
-   AstMinPackData *data;
-   int k;
-   int w1;
-
-/* Get a pointer to the data structure. */
-   data = (AstMinPackData *) adata;
-
-/* The Jacobian of the residuals with respect to the polynomial
-   coefficients is constant (i.e. does not depend on the values of the
-   polynomial coefficients). So we only need to calculate it once. If
-   this is the first call, calculate the Jacobian and return it in "jac".
-   otherwise, just return immediately retaining the supplied "jac" values
-   (which will be the values returned by the previous call to this
-   function). */
-   if( data->init_jac ) {
-      data->init_jac = 0;
-
-/* Loop over all residuals. */
-      for( k = 0; k < n; k++ ) {
-
-/* Loop over all parameters (i.e. polynomial coefficients). */
-         for( w1 = 0; w1 < m; w1++ ) {
-
-/* Store the Jacobian. */
-            jac[ k + w1*n ] = (data->xp1)[ w1 + k*data->order ];
-         }
-      }
-   }
-}
-
-static void LMJacob2D( const double *p, double *jac, int m, int n, void *adata ){
+static void LMJacob1D( const double *p, double *jac, int m, int n, void *adata ){
 /*
 *  Name:
-*     LMJacob2D
+*     LMJacob1D
 
 *  Purpose:
-*     Evaluate the Jacobian matrix of a test 2D polynomal.
+*     Evaluate the Jacobian matrix of a test 1D polynomal.
 
 *  Type:
 *     Private function.
 
 *  Synopsis:
-*     void LMJacob2D( const double *p, double *jac, int m, int n, void *adata )
+*     void LMJacob1D( const double *p, double *jac, int m, int n, void *adata )
 
 *  Description:
 *     This function finds the Jacobian matrix that describes the rate of
 *     change of every residual with respect to every polynomial coefficient.
-*     Each residual is a candidate polynomial (either P1 or P2) evaluated
-*     at one of the sample points (x1,x2), minus the supplied target value
-*     for the polynomial at that test point.
+*     Each residual is a candidate polynomial evaluated at one of the sample
+*     points minus the supplied target value for the polynomial at that test
+*     point.
 *
 *     For a polynomial the Jacobian matrix is constant (i.e. does not
 *     depend on the values of the polynomial coefficients). So we only
@@ -2740,39 +3239,28 @@ static void LMJacob2D( const double *p, double *jac, int m, int n, void *adata )
 
 *  Parameters:
 *     p
-*        An array of "m" coefficients for the candidate polynomial. All the
-*        coefficients for polynomial P1 come first, followed by those for P2.
-*        Within each each polynomial, the coefficients are order C00, C10,
-*        C01, C20, C11, C02, C30, C21, C12, C03, etc. So the coefficient
-*        of (x1^j*x2^k) (=Cjk) for polynomial Pi is stored in element
-*        [k + (j + k)*(j + k + 1)/2 + i*order*(order+1)/2] of the "p" array.
+*        An array of "m" coefficients for the candidate polynomial.
 *     jac
 *        An array in which to return the "m*n" elements of the Jacobian
 *        matrix. The rate of change of residual "r" with respect to
 *        coefficient "c" is returned in element "r + c*n". The residual
 *        at sample "k" of polynomial Pi has an "r" index of (k + nsamp*i).
-*        The coefficient of (x1^j*x2^k) for polynomial Pi has a "c" index
-*        of [k + (j + k)*(j + k + 1)/2 + i*order*(order+1)/2].
+*        The coefficient of (x1^j) for polynomial Pi has a "c" index
+*        of j.
 *     m
-*        The length of the "p" array. This should be equal to order*(order+1).
+*        The length of the "p" array. This should be equal to order.
 *     n
-*        The number of residuals. This should be equal to 2*nsamp.
+*        The number of residuals. This should be equal to nsamp.
 *     adata
-*        Pointer to a structure holdin gthe sample positions and values,
+*        Pointer to a structure holding the sample positions and values,
 *        and other information.
 
 */
 
 /* Local Variables: */
    AstMinPackData *data;
-   int iout;
    int k;
-   int ncof;
-   int vp;
-   int vr;
    int w1;
-   int w12;
-   int w2;
 
 /* Get a pointer to the data structure. */
    data = (AstMinPackData *) adata;
@@ -2787,42 +3275,19 @@ static void LMJacob2D( const double *p, double *jac, int m, int n, void *adata )
    if( data->init_jac ) {
       data->init_jac = 0;
 
-/* Store the number of coefficients in one polynomial. */
-      ncof = data->order*( 1 + data->order )/2;
-
 /* Loop over all residuals. */
-      for( vr = 0; vr < n; vr++ ) {
-
-/* Calculate the polynomial output index, and sample index, that creates
-   the current residual. */
-         iout = vr/data->nsamp;
-         k = vr - iout*data->nsamp;
+      for( k = 0; k < n; k++ ) {
 
 /* Loop over all parameters (i.e. polynomial coefficients). */
-         for( vp = 0; vp < m; vp++ ) {
-
-/* If this coefficient is not used in the creation of the current
-   polynomial output value, then the Jacobian value is zero. */
-            if( vp/ncof != iout ) {
-               jac[ vr + vp*n ] = 0.0;
-
-/* Otherwise, get the powers of the two polynomial inputs, to which
-   the current coefficient relates. */
-            } else {
-               w12 = ( -1.0 + sqrt( 1.0 + 8.0*(vp - iout*ncof) ) )/2.0;
-               w2 = vp - iout*ncof - w12*( w12 + 1 )/2;
-               w1 = w12 - w2;
+         for( w1 = 0; w1 < m; w1++ ) {
 
 /* Store the Jacobian. */
-               jac[ vr + vp*n ] = (data->xp1)[ w1 + k*data->order ]*
-                                  (data->xp2)[ w2 + k*data->order ];
-            }
+            jac[ k + w1*n ] = (data->xp1)[ w1 + k*data->order ];
          }
       }
    }
 }
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *this_object, int mode, int extra,
                        AstObject **fail, int *status ) {
 /*
@@ -2922,7 +3387,6 @@ static int ManageLock( AstObject *this_object, int mode, int extra,
    return result;
 
 }
-#endif
 
 static int MapMerge( AstMapping *this, int where, int series, int *nmap,
                      AstMapping ***map_list, int **invert_list, int *status ) {
@@ -3160,122 +3624,456 @@ static int MapMerge( AstMapping *this, int where, int series, int *nmap,
    return result;
 }
 
-static int MPFunc1D( void *p, int m, int n, const double *x, double *fvec,
-                     double *fjac, int ldfjac, int iflag ) {
+static void NestArrays( AstPolyMap *this, int forward, int *status ){
 /*
 *  Name:
-*     MPFunc1D
+*     NestArrays
 
 *  Purpose:
-*     Evaluate a test 1D polynomal or its Jacobian.
+*     Prepare the coefficients of a PolyMap for nested evaluation.
 
 *  Type:
 *     Private function.
 
 *  Synopsis:
-*     int MPFunc1D( void *p, int m, int n, const double *x, double *fvec,
-*                   double *fjac, int ldfjac, int iflag )
+*     #include "polymap.h"
+*     void NestArrays( AstPolyMap *this, int forward, int *status )
+
+*  Class Membership:
+*     PolyMap member function
 
 *  Description:
-*     This function finds the residuals or Jacobian implied by a supplied
-*     set of candidate polynomial coefficients. Each residual is a candidate
-*     polynomial evaluated at one of the sample points, minus the
-*     supplied target value for the polynomial at that test point.
-*
-*     The minimisation process minimises the sum of the squared residuals.
+*     This function copies the coefficients of each output of a polynomial
+*     that has one or two inputs into a dense array indexed by the powers
+*     of the inputs, for use by NestedTransform. It is invoked whenever
+*     the coefficients are stored in a PolyMap, so that the dense arrays
+*     are created only once and the PolyMap is not modified when it is
+*     used to transform points. No dense arrays are created if the
+*     polynomial has more than two inputs, or if its coefficients are too
+*     sparse to be stored efficiently in a dense array (in which case the
+*     nested scheme could be slower than the general scheme).
 
 *  Parameters:
-*     p
-*        A pointer to data needed to evaluate the required residuals or
-*        Jacobians.
-*     m
-*        The number of residuals.
-*     n
-*        The number of coefficients.
-*     x
-*        An array of "n" coefficients for the candidate polynomial.
-*     fvec
-*        An array in which to return the "m" residuals.
-*     fjac
-*        An array in which to return the "mxn" Jacobian values.
-*     ldflac
-*        Unused (should always be equal to "m").
-*     iflag
-*        If 1 calculate the residuals, otherwise calculate the Jacobians.
+*     this
+*        Pointer to the PolyMap.
+*     forward
+*        Prepare the original forward transformation of the PolyMap?
+*        Otherwise, the original inverse transformation is prepared.
+*     status
+*        Pointer to the inherited status variable.
 
 */
 
-/* If required, calculate the function values at X, and return this
-   vector in fvec. Do not alter fjac. */
-   if( iflag == 1 ) {
-      LMFunc1D( x, fvec, n, m, p );
+/* Local Variables: */
+   double **coeff;         /* Pointer to coefficient value arrays */
+   double **nest;          /* Dense coefficient array for each output */
+   int ***power;           /* Pointer to coefficient power arrays */
+   int *ncoeff;            /* Pointer to no. of coefficients */
+   int *nestpow;           /* Max power of each input for each output */
+   int i;                  /* Power of first input */
+   int ico;                /* Coefficient index */
+   int j;                  /* Power of second input */
+   int mx;                 /* Max power of first input */
+   int my;                 /* Max power of second input */
+   int nin;                /* Number of polynomial inputs */
+   int nout;               /* Number of polynomial outputs */
+   int ok;                 /* Can nested evaluation be used? */
+   int out_coord;          /* Index of output coordinate */
+
+/* Check the global error status. */
+   if( !astOK ) return;
 
-/* Otherwise, calculate the Jacobian values at X, and return this
-   matrix in fjac. Do not alter fvec. */
+/* Get the number of inputs and outputs of the required polynomial, and
+   pointers to the arrays holding its coefficient values and powers. */
+   if( forward ) {
+      nin = ( (AstMapping *) this )->nin;
+      nout = ( (AstMapping *) this )->nout;
+      ncoeff = this->ncoeff_f;
+      coeff = this->coeff_f;
+      power = this->power_f;
    } else {
-      LMJacob1D( x, fjac, n, m, p );
+      nin = ( (AstMapping *) this )->nout;
+      nout = ( (AstMapping *) this )->nin;
+      ncoeff = this->ncoeff_i;
+      coeff = this->coeff_i;
+      power = this->power_i;
    }
 
-   return 0;
+/* Nested evaluation is only used for polynomials with one or two
+   inputs. */
+   if( !ncoeff || !coeff || !power || nin < 1 || nin > 2 ) return;
+
+/* Allocate the arrays. */
+   nestpow = astMalloc( 2*sizeof( int )*(size_t) nout );
+   nest = astCalloc( nout, sizeof( double * ) );
+   ok = astOK;
+
+/* Find the maximum power of each input used by each output. A value of
+   -1 is stored for the first input if the output has a bad coefficient. */
+   for( out_coord = 0; out_coord < nout && ok; out_coord++ ) {
+      mx = 0;
+      my = 0;
+      for( ico = 0; ico < ncoeff[ out_coord ]; ico++ ) {
+         if( coeff[ out_coord ][ ico ] == AST__BAD ) {
+            mx = -1;
+            break;
+         }
+         mx = astMAX( mx, power[ out_coord ][ ico ][ 0 ] );
+         if( nin == 2 ) my = astMAX( my, power[ out_coord ][ ico ][ 1 ] );
+      }
+      nestpow[ 2*out_coord ] = mx;
+      nestpow[ 2*out_coord + 1 ] = my;
+
+/* Copy the coefficients into a dense array with (mx+1) rows and (my+1)
+   columns. Each row holds the coefficients for a single power of the
+   first input. Coefficients that have the same powers are summed. Do not
+   use nested evaluation if the dense array would be very much larger
+   than the list of supplied coefficients. */
+      if( mx >= 0 ) {
+         if( ( mx + 1 )*( my + 1 ) > 4*ncoeff[ out_coord ] + 16 ) {
+            ok = 0;
+         } else {
+            nest[ out_coord ] = astCalloc( ( mx + 1 )*( my + 1 ),
+                                           sizeof( double ) );
+            ok = astOK;
+         }
+         for( ico = 0; ico < ncoeff[ out_coord ] && ok; ico++ ) {
+            i = power[ out_coord ][ ico ][ 0 ];
+            j = ( nin == 2 ) ? power[ out_coord ][ ico ][ 1 ] : 0;
+            nest[ out_coord ][ i*( my + 1 ) + j ] += coeff[ out_coord ][ ico ];
+         }
+      }
+   }
+
+/* If nested evaluation can be used, store the arrays in the PolyMap.
+   Otherwise, free them. */
+   if( ok ) {
+      if( forward ) {
+         this->nest_f = nest;
+         this->nestpow_f = nestpow;
+      } else {
+         this->nest_i = nest;
+         this->nestpow_i = nestpow;
+      }
+   } else {
+      if( nest ) {
+         for( out_coord = 0; out_coord < nout; out_coord++ ) {
+            nest[ out_coord ] = astFree( nest[ out_coord ] );
+         }
+         nest = astFree( nest );
+      }
+      nestpow = astFree( nestpow );
+   }
 }
 
-static int MPFunc2D( void *p, int m, int n, const double *x, double *fvec,
-                     double *fjac, int ldfjac, int iflag ) {
+static int NestedTransform( AstPolyMap *this, int forward, int npoint,
+                            int ncoord_in, int ncoord_out, double **ptr_in,
+                            double **ptr_out, int *status ){
 /*
 *  Name:
-*     MPFunc1D
+*     NestedTransform
 
 *  Purpose:
-*     Evaluate a test 2D polynomal or its Jacobian.
+*     Evaluate a 1 or 2 input polynomial using nested multiplication.
 
 *  Type:
 *     Private function.
 
 *  Synopsis:
-*     int MPFunc2D( void *p, int m, int n, const double *x, double *fvec,
-*                   double *fjac, int ldfjac, int iflag )
+*     #include "polymap.h"
+*     int NestedTransform( AstPolyMap *this, int forward, int npoint,
+*                          int ncoord_in, int ncoord_out, double **ptr_in,
+*                          double **ptr_out, int *status )
+
+*  Class Membership:
+*     PolyMap member function
 
 *  Description:
-*     This function finds the residuals or Jacobian implied by a supplied
-*     set of candidate polynomial coefficients. Each residual is a candidate
-*     polynomial evaluated at one of the sample points, minus the
-*     supplied target value for the polynomial at that test point.
+*     This function provides a faster alternative to the general
+*     term-by-term evaluation used by astTransform, for polynomials that
+*     have one or two inputs. It uses the dense coefficient arrays
+*     created by NestArrays when the coefficients were stored in the
+*     PolyMap. Each output is evaluated using nested multiplication
+*     (Horner's scheme) for a standard polynomial, or Clenshaw's
+*     recurrence for a Chebyshev polynomial, so that no powers of the
+*     input values need to be formed. Points are processed in blocks of
+*     fixed size, with the innermost loops running over all the points in
+*     a block (the unused elements of the final block being set to zero)
+*     so that the compiler can vectorise them.
 *
-*     The minimisation process minimises the sum of the squared residuals.
+*     The returned values are the same as those produced by the general
+*     scheme, except for differences caused by rounding. In particular,
+*     an output value is bad if any coefficient is bad, or if an input
+*     value used by the output polynomial is bad (or, for a Chebyshev
+*     polynomial, is outside the bounding box of the polynomial).
 
 *  Parameters:
-*     p
-*        A pointer to data needed to evaluate the required residuals or
-*        Jacobians.
-*     m
-*        The number of residuals.
-*     n
-*        The number of coefficients.
-*     x
-*        An array of "n" coefficients for the candidate polynomial.
-*     fvec
-*        An array in which to return the "m" residuals.
-*     fjac
-*        An array in which to return the "mxn" Jacobian values.
-*     ldflac
-*        Unused (should always be equal to "m").
-*     iflag
-*        If 1 calculate the residuals, otherwise calculate the Jacobians.
+*     this
+*        Pointer to the PolyMap.
+*     forward
+*        Use the original forward transformation of the PolyMap?
+*     npoint
+*        The number of points to transform.
+*     ncoord_in
+*        The number of inputs.
+*     ncoord_out
+*        The number of outputs.
+*     ptr_in
+*        Pointers to the input axis values. The output arrays may be the
+*        same as the input arrays.
+*     ptr_out
+*        Pointers to the arrays in which to store the output axis values.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     Non-zero if the points were transformed. Zero is returned without
+*     action if the polynomial is not suitable for nested evaluation (see
+*     NestArrays), in which case the caller should use the general scheme.
 
 */
 
-/* If required, calculate the function values at X, and return this
-   vector in fvec. Do not alter fjac. */
-   if( iflag == 1 ) {
-      LMFunc2D( x, fvec, n, m, p );
+/* Local Constants: */
+#define NBLOCK 64          /* No. of points evaluated together */
 
-/* Otherwise, calculate the Jacobian values at X, and return this
-   matrix in fjac. Do not alter fvec. */
+/* Local Variables: */
+   const double *offsets;  /* Chebyshev offset for each input */
+   const double *scales;   /* Chebyshev scale for each input */
+   double **nest;          /* Dense coefficient array for each output */
+   double *d;              /* Pointer to next row of dense coefficients */
+   double *pout;           /* Pointer to next output value */
+   double ax[ NBLOCK ];    /* Outer recurrence value for each point */
+   double bx1[ NBLOCK ];   /* Outer Clenshaw b(k+1) for each point */
+   double bx2[ NBLOCK ];   /* Outer Clenshaw b(k+2) for each point */
+   double by1[ NBLOCK ];   /* Inner Clenshaw b(k+1) for each point */
+   double by2[ NBLOCK ];   /* Inner Clenshaw b(k+2) for each point */
+   double inner[ NBLOCK ]; /* Inner polynomial value for each point */
+   double t;               /* Temporary storage */
+   double x[ NBLOCK ];     /* First input value for each point */
+   double y[ NBLOCK ];     /* Second input value for each point */
+   int *nestpow;           /* Max power of each input for each output */
+   int badx[ NBLOCK ];     /* Is the first input unusable? */
+   int bady[ NBLOCK ];     /* Is the second input unusable? */
+   int cheby;              /* Are the polynomials Chebyshev polynomials? */
+   int i;                  /* Power of first input */
+   int ip;                 /* Index of point within block */
+   int j;                  /* Power of second input */
+   int mx;                 /* Max power of first input */
+   int my;                 /* Max power of second input */
+   int nb;                 /* No. of points in current block */
+   int out_coord;          /* Index of output coordinate */
+   int point;              /* Index of first point in block */
+
+/* Check the global error status, and that the polynomial has one or two
+   inputs. */
+   if( !astOK || ncoord_in < 1 || ncoord_in > 2 ) return 0;
+
+/* Get pointers to the dense coefficient arrays for the required
+   transformation. Return if they have not been created. */
+   if ( forward ) {
+      nest = this->nest_f;
+      nestpow = this->nestpow_f;
    } else {
-      LMJacob2D( x, fjac, n, m, p );
+      nest = this->nest_i;
+      nestpow = this->nestpow_i;
+   }
+   if( !nest || !nestpow ) return 0;
+
+/* See if the coefficients describe Chebyshev polynomials, and if so get
+   the scales and offsets that map each input onto the range [-1,+1]. */
+   cheby = astPolyBasis( this, forward, &scales, &offsets );
+
+/* Loop round each block of points. */
+   for( point = 0; point < npoint; point += NBLOCK ) {
+      nb = astMIN( NBLOCK, npoint - point );
+
+/* Copy the input values for the block into local arrays, flagging any
+   that are bad or (for Chebyshev polynomials) outside the bounding box.
+   This is done for all outputs before any output values are stored, so
+   that the output arrays can be the same as the input arrays. Unusable
+   input values, and the unused elements at the end of the final block,
+   are replaced by zero so that they do not disturb the arithmetic. */
+      for( ip = 0; ip < nb; ip++ ) {
+         x[ ip ] = ptr_in[ 0 ][ point + ip ];
+         badx[ ip ] = ( x[ ip ] == AST__BAD );
+         if( cheby && !badx[ ip ] ) {
+            x[ ip ] = x[ ip ]*scales[ 0 ] + offsets[ 0 ];
+            badx[ ip ] = ( fabs( x[ ip ] ) > 1.0 );
+         }
+         if( badx[ ip ] ) x[ ip ] = 0.0;
+      }
+      for( ; ip < NBLOCK; ip++ ) x[ ip ] = 0.0;
+
+      if( ncoord_in == 2 ) {
+         for( ip = 0; ip < nb; ip++ ) {
+            y[ ip ] = ptr_in[ 1 ][ point + ip ];
+            bady[ ip ] = ( y[ ip ] == AST__BAD );
+            if( cheby && !bady[ ip ] ) {
+               y[ ip ] = y[ ip ]*scales[ 1 ] + offsets[ 1 ];
+               bady[ ip ] = ( fabs( y[ ip ] ) > 1.0 );
+            }
+            if( bady[ ip ] ) y[ ip ] = 0.0;
+         }
+         for( ; ip < NBLOCK; ip++ ) y[ ip ] = 0.0;
+      } else {
+         for( ip = 0; ip < NBLOCK; ip++ ) {
+            y[ ip ] = 0.0;
+            bady[ ip ] = 0;
+         }
+      }
+
+/* Loop round each output. */
+      for( out_coord = 0; out_coord < ncoord_out; out_coord++ ) {
+         pout = ptr_out[ out_coord ] + point;
+         mx = nestpow[ 2*out_coord ];
+         my = nestpow[ 2*out_coord + 1 ];
+
+/* If the output has a bad coefficient, all output values are bad. */
+         if( mx < 0 ) {
+            for( ip = 0; ip < nb; ip++ ) pout[ ip ] = AST__BAD;
+            continue;
+         }
+
+/* For standard polynomials, loop down through the rows of the dense
+   array, from the highest power of the first input to the lowest. Each
+   row is itself a polynomial in the second input, which is evaluated
+   using Horner's scheme. The results are combined using Horner's scheme
+   in the first input. */
+         if( !cheby ) {
+            for( ip = 0; ip < NBLOCK; ip++ ) ax[ ip ] = 0.0;
+            for( i = mx; i >= 0; i-- ) {
+               d = nest[ out_coord ] + i*( my + 1 );
+               for( ip = 0; ip < NBLOCK; ip++ ) inner[ ip ] = d[ my ];
+               for( j = my - 1; j >= 0; j-- ) {
+                  for( ip = 0; ip < NBLOCK; ip++ ) {
+                     inner[ ip ] = inner[ ip ]*y[ ip ] + d[ j ];
+                  }
+               }
+               for( ip = 0; ip < NBLOCK; ip++ ) {
+                  ax[ ip ] = ax[ ip ]*x[ ip ] + inner[ ip ];
+               }
+            }
+
+/* For Chebyshev polynomials, do the same but using Clenshaw's
+   recurrence, b(k) = a(k) + 2.x.b(k+1) - b(k+2), in place of Horner's
+   scheme. The final value is a(0) + x.b(1) - b(2). */
+         } else {
+            for( ip = 0; ip < NBLOCK; ip++ ) {
+               bx1[ ip ] = 0.0;
+               bx2[ ip ] = 0.0;
+            }
+            for( i = mx; i >= 0; i-- ) {
+               d = nest[ out_coord ] + i*( my + 1 );
+               for( ip = 0; ip < NBLOCK; ip++ ) {
+                  by1[ ip ] = 0.0;
+                  by2[ ip ] = 0.0;
+               }
+               for( j = my; j > 0; j-- ) {
+                  for( ip = 0; ip < NBLOCK; ip++ ) {
+                     t = d[ j ] + 2.0*y[ ip ]*by1[ ip ] - by2[ ip ];
+                     by2[ ip ] = by1[ ip ];
+                     by1[ ip ] = t;
+                  }
+               }
+               for( ip = 0; ip < NBLOCK; ip++ ) {
+                  inner[ ip ] = d[ 0 ] + y[ ip ]*by1[ ip ] - by2[ ip ];
+               }
+
+               if( i > 0 ) {
+                  for( ip = 0; ip < NBLOCK; ip++ ) {
+                     t = inner[ ip ] + 2.0*x[ ip ]*bx1[ ip ] - bx2[ ip ];
+                     bx2[ ip ] = bx1[ ip ];
+                     bx1[ ip ] = t;
+                  }
+               } else {
+                  for( ip = 0; ip < NBLOCK; ip++ ) {
+                     ax[ ip ] = inner[ ip ] + x[ ip ]*bx1[ ip ] - bx2[ ip ];
+                  }
+               }
+            }
+         }
 
+/* Store the output values, setting them bad if they depend on an
+   unusable input value. */
+         for( ip = 0; ip < nb; ip++ ) {
+            if( ( mx > 0 && badx[ ip ] ) || ( my > 0 && bady[ ip ] ) ) {
+               pout[ ip ] = AST__BAD;
+            } else {
+               pout[ ip ] = ax[ ip ];
+            }
+         }
+      }
    }
 
+/* Return the result. */
+   return astOK;
+}
+#undef NBLOCK
+
+static int PolyBasis( AstPolyMap *this, int fwd, const double **scales,
+                      const double **offsets, int *status ){
+/*
+*+
+*  Name:
+*     astPolyBasis
+
+*  Purpose:
+*     Identify the functions used as the basis of a polynomial.
+
+*  Type:
+*     Protected function.
+
+*  Synopsis:
+*     #include "polymap.h"
+*     int astPolyBasis( AstPolyMap *this, int fwd, const double **scales,
+*                       const double **offsets )
+
+*  Class Membership:
+*     PolyMap virtual function.
+
+*  Description:
+*     This function indicates whether the values returned by
+*     astPolyPowers for the specified transformation are simple powers
+*     of the input axis values, or Chebyshev polynomials of the first
+*     kind evaluated at scaled and shifted input axis values. It allows
+*     astTransform to evaluate the polynomials without forming the
+*     individual powers.
+
+*  Parameters:
+*     this
+*        Pointer to the PolyMap.
+*     fwd
+*        Do the coefficients define the foward transformation of the
+*        PolyMap?
+*     scales
+*        Address of a location at which to return a pointer to an array
+*        holding the scale factor for each input axis. Returned holding
+*        NULL if the basis functions are simple powers.
+*     offsets
+*        Address of a location at which to return a pointer to an array
+*        holding the offset for each input axis. Each input axis value
+*        is multiplied by the scale factor and then the offset is added
+*        to give a value in the range [-1,+1] at which the Chebyshev
+*        polynomials are evaluated. Returned holding NULL if the basis
+*        functions are simple powers.
+
+*  Returned Value:
+*     Non-zero if the basis functions are Chebyshev polynomials, and
+*     zero if they are simple powers.
+
+*  Notes:
+*     - Sub-classes that over-ride astPolyPowers should also over-ride
+*     this method.
+*     - Zero is returned if an error has already occurred, or if this
+*     function should fail for any reason.
+*-
+*/
+
+/* Initialise */
+   *scales = NULL;
+   *offsets = NULL;
+
+/* The base PolyMap class always uses simple powers. */
    return 0;
 }
 
@@ -3534,6 +4332,92 @@ static void PolyPowers( AstPolyMap *this, double **work, int ncoord,
    }
 }
 
+static void PolyPowerDerivs( AstPolyMap *this, double **work, double **dwork,
+                             int ncoord, const int *mxpow, double **ptr,
+                             int point, int fwd, int *status ){
+/*
+*+
+*  Name:
+*     astPolyPowerDerivs
+
+*  Purpose:
+*     Find the required powers of the input axis values and their
+*     derivatives.
+
+*  Type:
+*     Protected function.
+
+*  Synopsis:
+*     #include "polymap.h"
+*     void astPolyPowerDerivs( AstPolyMap *this, double **work,
+*                              double **dwork, int ncoord,
+*                              const int *mxpow, double **ptr, int point,
+*                              int fwd )
+
+*  Class Membership:
+*     PolyMap virtual function.
+
+*  Description:
+*     This function is used by astJacobianPoints. It returns the same
+*     values as astPolyPowers, together with the derivative of each
+*     value with respect to the corresponding input axis value.
+*     Sub-classes that over-ride astPolyPowers should also over-ride
+*     this method.
+
+*  Parameters:
+*     this
+*        Pointer to the PolyMap.
+*     work
+*        An array of "ncoord" pointers, each pointing to an array of
+*        length "max(2,mxpow)". The values returned by astPolyPowers are
+*        placed in this array on exit.
+*     dwork
+*        An array of "ncoord" pointers, each pointing to an array of
+*        length "max(2,mxpow)". The derivatives of the values returned
+*        in "work" are placed in this array on exit.
+*     ncoord
+*        The number of axes.
+*     mxpow
+*        Pointer to an array holding the maximum power required of each
+*        axis value. Should have "ncoord" elements.
+*     ptr
+*        An array of "ncoord" pointers, each pointing to an array holding
+*        the axis values. Each of these arrays of axis values must have
+*        at least "point+1" elements.
+*     point
+*        The zero based index of the point within "ptr" that holds the
+*        axis values to be exponentiated.
+*     fwd
+*        Do the supplied coefficients define the foward transformation of
+*        the PolyMap?
+*-
+*/
+
+/* Local Variables; */
+   double *pdwork;
+   double *pwork;
+   int coord;
+   int ip;
+
+/* Check the local error status. */
+   if ( !astOK ) return;
+
+/* Get the powers. */
+   astPolyPowers( this, work, ncoord, mxpow, ptr, point, fwd );
+
+/* The derivative of "x raised to the power i" is "i times x raised to
+   the power i-1". Loop over all input axes. */
+   for( coord = 0; coord < ncoord; coord++ ) {
+      pwork = work[ coord ];
+      pdwork = dwork[ coord ];
+      pdwork[ 0 ] = 0.0;
+      for( ip = 1; ip <= mxpow[ coord ]; ip++ ) {
+         pdwork[ ip ] = ( pwork[ ip - 1 ] != AST__BAD ) ?
+                        ip*pwork[ ip - 1 ] : AST__BAD;
+      }
+   }
+}
+
 static AstPolyMap *PolyTran( AstPolyMap *this, int forward, double acc,
                              double maxacc, int maxorder, const double *lbnd,
                              const double *ubnd, int *status ){
@@ -4666,6 +5550,9 @@ static void StoreArrays( AstPolyMap *this, int forward, int ncoeff,
          }
       }
    }
+
+/* Prepare the coefficients for nested evaluation, if possible. */
+   NestArrays( this, forward, status );
 }
 
 static int TestAttrib( AstObject *this_object, const char *attrib, int *status ) {
@@ -4749,6 +5636,44 @@ static int TestAttrib( AstObject *this_object, const char *attrib, int *status )
    return result;
 }
 
+static int ThreadSafe( AstMapping *this_mapping, int *status ){
+/*
+*  Name:
+*     ThreadSafe
+
+*  Purpose:
+*     Check if a PolyMap can transform points in several threads at once.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "polymap.h"
+*     int ThreadSafe( AstMapping *this, int *status )
+
+*  Class Membership:
+*     PolyMap member function (over-rides the protected astThreadSafe
+*     method inherited from the Mapping class).
+
+*  Description:
+*     This function returns zero if the PolyMap uses an iterative inverse
+*     transformation and the PolyMaps describing the Jacobian of the
+*     forward transformation have not yet been created (since they are
+*     created and stored in the PolyMap when the inverse transformation
+*     is first used). Otherwise it returns a non-zero value.
+
+*  Parameters:
+*     this
+*        Pointer to the PolyMap.
+*     status
+*        Pointer to the inherited status variable.
+*/
+   AstPolyMap *this;
+   if ( !astOK ) return 0;
+   this = (AstPolyMap *) this_mapping;
+   return ( this->jacobian || !astGetIterInverse( this ) );
+}
+
 static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
                                int forward, AstPointSet *out, int *status ) {
 /*
@@ -4866,6 +5791,12 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
       ptr_in = astGetPoints( in );
       ptr_out = astGetPoints( result );
 
+/* Polynomials with one or two inputs can usually be evaluated more
+   quickly using nested multiplication. If this is possible, we have
+   nothing more to do. */
+      if( NestedTransform( map, forward, npoint, ncoord_in, ncoord_out,
+                           ptr_in, ptr_out, status ) ) return result;
+
 /* Get a pointer to the arrays holding the required coefficient
    values and powers, according to the direction of mapping required. */
       if ( forward ) {
@@ -5218,6 +6149,11 @@ static void Copy( const AstObject *objin, AstObject *objout, int *status ) {
    out->coeff_i = NULL;
    out->mxpow_i = NULL;
 
+   out->nest_f = NULL;
+   out->nestpow_f = NULL;
+   out->nest_i = NULL;
+   out->nestpow_i = NULL;
+
    out->jacobian = NULL;
    out->lintrunc = NULL;
 
@@ -5299,6 +6235,10 @@ static void Copy( const AstObject *objin, AstObject *objout, int *status ) {
       }
    }
 
+/* Prepare the copied coefficients for nested evaluation. */
+   NestArrays( out, 1, status );
+   NestArrays( out, 0, status );
+
 /* Copy the linear truncation of the PolyMap - if it has been found. */
    if( in->lintrunc ) out->lintrunc = astCopy( in->lintrunc );
 
@@ -5958,6 +6898,11 @@ AstPolyMap *astInitPolyMap_( void *mem, size_t size, int init,
       new->coeff_i = NULL;
       new->mxpow_i = NULL;
 
+      new->nest_f = NULL;
+      new->nestpow_f = NULL;
+      new->nest_i = NULL;
+      new->nestpow_i = NULL;
+
 /* Store the forward transformation. */
       StoreArrays( new, 1, ncoeff_f, coeff_f, status );
 
@@ -6106,6 +7051,12 @@ AstPolyMap *astLoadPolyMap_( void *mem, size_t size,
    nin = ( (AstMapping *) new )->nin;
    nout = ( (AstMapping *) new )->nout;
 
+/* The coefficients have not yet been prepared for nested evaluation. */
+      new->nest_f = NULL;
+      new->nestpow_f = NULL;
+      new->nest_i = NULL;
+      new->nestpow_i = NULL;
+
 /* Read input data. */
 /* ================ */
 /* Request the input Channel to read all the input data appropriate to
@@ -6283,6 +7234,10 @@ AstPolyMap *astLoadPolyMap_( void *mem, size_t size,
       new->tolinverse = astReadDouble( channel, "tolinv", AST__BAD );
       if ( TestTolInverse( new, status ) ) SetTolInverse( new, new->tolinverse, status );
 
+/* Prepare the coefficients for nested evaluation. */
+      NestArrays( new, 1, status );
+      NestArrays( new, 0, status );
+
 /* The Jacobian of the PolyMap's forward transformation has not yet been
    found. */
       new->jacobian = NULL;
@@ -6321,6 +7276,22 @@ void astPolyPowers_( AstPolyMap *this, double **work, int ncoord,
                                            point, fwd, status );
 }
 
+void astPolyPowerDerivs_( AstPolyMap *this, double **work, double **dwork,
+                          int ncoord, const int *mxpow, double **ptr,
+                          int point, int fwd, int *status ){
+   if ( !astOK ) return;
+   (**astMEMBER(this,PolyMap,PolyPowerDerivs))( this, work, dwork, ncoord,
+                                                mxpow, ptr, point, fwd,
+                                                status );
+}
+
+int astPolyBasis_( AstPolyMap *this, int fwd, const double **scales,
+                   const double **offsets, int *status ){
+   if ( !astOK ) return 0;
+   return (**astMEMBER(this,PolyMap,PolyBasis))( this, fwd, scales, offsets,
+                                                 status );
+}
+
 AstPolyMap *astPolyTran_( AstPolyMap *this, int forward, double acc,
                           double maxacc, int maxorder, const double *lbnd,
                           const double *ubnd, int *status ){
@@ -39,6 +39,8 @@
 *        None.
 *
 *     Protected:
+*        astJacobianPoints
+*           Find the Jacobian matrix of a PolyMap at a set of points.
 *        astTransform
 *           Apply a PolyMap to transform a set of points.
 
@@ -163,6 +165,10 @@ typedef struct AstPolyMap {
    int iterinverse;           /* Use an iterative inverse? */
    int niterinverse;          /* Max number of iterations for iterative inverse */
    double tolinverse;         /* Target relative error for iterative inverse */
+   double **nest_f;           /* Dense forward coeffs for nested evaluation */
+   int *nestpow_f;            /* Max power of the 2 i/p axes for each forward polynomial */
+   double **nest_i;           /* Dense inverse coeffs for nested evaluation */
+   int *nestpow_i;            /* Max power of the 2 i/p axes for each inverse polynomial */
    struct AstPolyMap **jacobian;/* PolyMaps defining Jacobian of forward transformation */
    AstMapping *lintrunc;      /* A linear truncation of the PolyMap */
 } AstPolyMap;
@@ -196,6 +202,8 @@ typedef struct AstPolyMapVtab {
 /* Properties (e.g. methods) specific to this class. */
    AstPolyMap *(* PolyTran)( AstPolyMap *, int, double, double, int, const double *, const double *, int * );
    void (* PolyPowers)( AstPolyMap *, double **, int, const int *, double **, int, int, int * );
+   void (* PolyPowerDerivs)( AstPolyMap *, double **, double **, int, const int *, double **, int, int, int * );
+   int (* PolyBasis)( AstPolyMap *, int, const double **, const double **, int * );
    void (* PolyCoeffs)( AstPolyMap *, int, int, double *, int *, int *);
    void (* FitPoly1DInit)( AstPolyMap *, int, double **, AstMinPackData *, double *, int *);
    void (* FitPoly2DInit)( AstPolyMap *, int, double **, AstMinPackData *, double *, int *);
@@ -271,6 +279,8 @@ void astPolyCoeffs_( AstPolyMap *, int, int, double *, int *, int *);
 
 # if defined(astCLASS)           /* Protected */
    void astPolyPowers_( AstPolyMap *, double **, int, const int *, double **, int, int, int * );
+   void astPolyPowerDerivs_( AstPolyMap *, double **, double **, int, const int *, double **, int, int, int * );
+   int astPolyBasis_( AstPolyMap *, int, const double **, const double **, int * );
    void astFitPoly1DInit_( AstPolyMap *, int, double **, AstMinPackData *, double *, int *);
    void astFitPoly2DInit_( AstPolyMap *, int, double **, AstMinPackData *, double *, int *);
 
@@ -347,6 +357,10 @@ astINVOKE(V,astPolyCoeffs_(astCheckPolyMap(this),forward,nel,coeffs,ncoeff,STATU
 
 #define astPolyPowers(this,work,ncoord,mxpow,ptr,offset,fwd) \
         astINVOKE(V,astPolyPowers_(astCheckPolyMap(this),work,ncoord,mxpow,ptr,point,fwd,STATUS_PTR))
+#define astPolyPowerDerivs(this,work,dwork,ncoord,mxpow,ptr,point,fwd) \
+        astINVOKE(V,astPolyPowerDerivs_(astCheckPolyMap(this),work,dwork,ncoord,mxpow,ptr,point,fwd,STATUS_PTR))
+#define astPolyBasis(this,fwd,scales,offsets) \
+        astINVOKE(V,astPolyBasis_(astCheckPolyMap(this),fwd,scales,offsets,STATUS_PTR))
 #define astFitPoly1DInit(this,forward,table,data,scales) \
         astINVOKE(V,astFitPoly1DInit_(astCheckPolyMap(this),forward,table,data,scales,STATUS_PTR))
 #define astFitPoly2DInit(this,forward,table,data,scales) \
@@ -151,9 +151,7 @@ static void (*parent_getregionbounds)( AstRegion *, double *, double *, int * );
 static void (*parent_regclearattrib)( AstRegion *, const char *, char **, int * );
 static void (*parent_regsetattrib)( AstRegion *, const char *, char **, int * );
 
-#if defined(THREAD_SAFE)
 static int (* parent_managelock)( AstObject *, int, int, AstObject **, int * );
-#endif
 
 
 #ifdef THREAD_SAFE
@@ -220,9 +218,7 @@ static void SetClosed( AstRegion *, int, int * );
 static void SetMeshSize( AstRegion *, int, int * );
 static void SetRegFS( AstRegion *, AstFrame *, int * );
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *, int, int, AstObject **, int * );
-#endif
 
 
 /* Member functions. */
@@ -1334,10 +1330,8 @@ void astInitPrismVtab_(  AstPrismVtab *vtab, const char *name, int *status ) {
    parent_getobjsize = object->GetObjSize;
    object->GetObjSize = GetObjSize;
 
-#if defined(THREAD_SAFE)
    parent_managelock = object->ManageLock;
    object->ManageLock = ManageLock;
-#endif
 
    parent_transform = mapping->Transform;
    mapping->Transform = Transform;
@@ -1409,7 +1403,6 @@ void astInitPrismVtab_(  AstPrismVtab *vtab, const char *name, int *status ) {
    }
 }
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *this_object, int mode, int extra,
                        AstObject **fail, int *status ) {
 /*
@@ -1502,7 +1495,6 @@ static int ManageLock( AstObject *this_object, int mode, int extra,
    return result;
 
 }
-#endif
 
 static int MapList( AstMapping *this_mapping, int series, int invert,
                     int *nmap, AstMapping ***map_list, int **invert_list,
@@ -117,9 +117,7 @@ static int (* parent_getobjsize)( AstObject *, int * );
 static AstPointSet *(* parent_transform)( AstMapping *, AstPointSet *, int, AstPointSet *, int * );
 static int *(* parent_mapsplit)( AstMapping *, int, const int *, AstMapping **, int * );
 
-#if defined(THREAD_SAFE)
 static int (* parent_managelock)( AstObject *, int, int, AstObject **, int * );
-#endif
 
 
 #ifdef THREAD_SAFE
@@ -165,11 +163,10 @@ static void Delete( AstObject *, int * );
 static void Dump( AstObject *, AstChannel *, int * );
 static int *MapSplit( AstMapping *, int, const int *, AstMapping **, int * );
 static int Equal( AstObject *, AstObject *, int * );
+static int ThreadSafe( AstMapping *, int * );
 static int GetObjSize( AstObject *, int * );
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *, int, int, AstObject **, int * );
-#endif
 
 /* Member functions. */
 /* ================= */
@@ -213,6 +210,8 @@ static int Equal( AstObject *this_object, AstObject *that_object, int *status )
 */
 
 /* Local Variables: */
+   AstMapping *that_map;
+   AstMapping *this_map;
    AstRateMap *that;
    AstRateMap *this;
    int nin;
@@ -247,21 +246,27 @@ static int Equal( AstObject *this_object, AstObject *that_object, int *status )
    must be identical. */
          if( astGetInvert( this ) == astGetInvert( that ) ) {
 
-/* Temporarily re-instate the original Invert flag values. */
-            this_inv = astGetInvert( this->map );
-            that_inv = astGetInvert( that->map );
-            astSetInvert( this->map, this->invert );
-            astSetInvert( that->map, that->invert );
-
-            if( astEqual( this->map, that->map ) &&
+/* Temporarily re-instate the original Invert flag values. A frozen
+   Mapping may be in use by other threads, so use a copy of it if its
+   Invert flag needs to be changed. */
+            this_map = astCopyIfFrozen( this->map, this->invert );
+            that_map = astCopyIfFrozen( that->map, that->invert );
+            this_inv = astGetInvert( this_map );
+            that_inv = astGetInvert( that_map );
+            astSetInvert( this_map, this->invert );
+            astSetInvert( that_map, that->invert );
+
+            if( astEqual( this_map, that_map ) &&
                 this->iin == that->iin &&
                 this->iout == that->iout ){
                result = 1;
             }
 
 /* Restore the original Invert flag values. */
-            astSetInvert( this->map, this_inv );
-            astSetInvert( that->map, that_inv );
+            astSetInvert( this_map, this_inv );
+            astSetInvert( that_map, that_inv );
+            this_map = astAnnul( this_map );
+            that_map = astAnnul( that_map );
 
 /* If the Invert flags for the two RateMaps differ, the attributes of the two
    RateMaps must be inversely related to each other. */
@@ -418,16 +423,15 @@ void astInitRateMapVtab_(  AstRateMapVtab *vtab, const char *name, int *status )
 
    mapping->RemoveRegions = RemoveRegions;
 
-#if defined(THREAD_SAFE)
    parent_managelock = object->ManageLock;
    object->ManageLock = ManageLock;
-#endif
 
    parent_transform = mapping->Transform;
    mapping->Transform = Transform;
 
    parent_mapsplit = mapping->MapSplit;
    mapping->MapSplit = MapSplit;
+   mapping->ThreadSafe = ThreadSafe;
 
 /* Store replacement pointers for methods which will be over-ridden by
    new member functions implemented here. */
@@ -448,7 +452,6 @@ void astInitRateMapVtab_(  AstRateMapVtab *vtab, const char *name, int *status )
    }
 }
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *this_object, int mode, int extra,
                        AstObject **fail, int *status ) {
 /*
@@ -540,7 +543,6 @@ static int ManageLock( AstObject *this_object, int mode, int extra,
    return result;
 
 }
-#endif
 
 static int MapMerge( AstMapping *this, int where, int series, int *nmap,
                      AstMapping ***map_list, int **invert_list, int *status ) {
@@ -910,7 +912,7 @@ static int *MapSplit( AstMapping *this_map, int nin, const int *in, AstMapping *
 
 /* Temporarily reset the Invert attribute of the encapsulated Mapping
    back to the value it had when the RateMap was created. */
-      emap = this->map;
+      emap = astCopyIfFrozen( this->map, this->invert );
       old_inv = astGetInvert( emap );
       astSetInvert( emap, this->invert );
 
@@ -956,6 +958,7 @@ static int *MapSplit( AstMapping *this_map, int nin, const int *in, AstMapping *
 /* Re-instate the original Invert flag in the Mapping encapsulated by the
    supplied RateMap. */
       astSetInvert( emap, old_inv );
+      emap = astAnnul( emap );
    }
 
 /* Free returned resources if an error has occurred. */
@@ -1066,6 +1069,39 @@ static AstMapping *RemoveRegions( AstMapping *this_mapping, int *status ) {
    return result;
 }
 
+static int ThreadSafe( AstMapping *this_mapping, int *status ){
+/*
+*  Name:
+*     ThreadSafe
+
+*  Purpose:
+*     Check if a RateMap can transform points in several threads at once.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "ratemap.h"
+*     int ThreadSafe( AstMapping *this, int *status )
+
+*  Class Membership:
+*     RateMap member function (over-rides the protected astThreadSafe
+*     method inherited from the Mapping class).
+
+*  Description:
+*     This function always returns zero, since the RateMap Transform
+*     method uses the astRate method of the encapsulated Mapping, which
+*     caches intermediate values between invocations.
+
+*  Parameters:
+*     this
+*        Pointer to the RateMap.
+*     status
+*        Pointer to the inherited status variable.
+*/
+   return 0;
+}
+
 static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
                                int forward, AstPointSet *out, int *status ) {
 /*
@@ -1169,7 +1205,7 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
 
 /* Temporarily reset the Invert attribute of the encapsulated Mapping
    back to the value it had when the RateMap was created. */
-      emap = map->map;
+      emap = astCopyIfFrozen( map->map, map->invert );
       old_inv = astGetInvert( emap );
       astSetInvert( emap, map->invert );
 
@@ -1204,6 +1240,7 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
 
 /* Re-instate the original Invert flag. */
       astSetInvert( emap, old_inv );
+      emap = astAnnul( emap );
 
 /* Free resources */
       work = astFree( work );
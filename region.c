@@ -127,6 +127,7 @@ c     - astOverlap: Determines the nature of the overlap between two Regions
 f     - AST_OVERLAP: Determines the nature of the overlap between two Regions
 c     - astMask<X>: Mask a region of a data grid
 f     - AST_MASK<X>: Mask a region of a data grid
+c     - astMask8<X>: Mask a region of a data grid using 64-bit bounds
 c     - astSetUnc: Associate a new uncertainty with a Region
 f     - AST_SETUNC: Associate a new uncertainty with a Region
 c     - astShowMesh: Display a mesh of points on the surface of a Region
@@ -835,9 +836,7 @@ static int class_check;
 static int (* parent_getobjsize)( AstObject *, int * );
 static int (* parent_getusedefs)( AstObject *, int * );
 
-#if defined(THREAD_SAFE)
 static int (* parent_managelock)( AstObject *, int, int, AstObject **, int * );
-#endif
 
 /* Define macros for accessing each item of thread specific global data. */
 #ifdef THREAD_SAFE
@@ -886,6 +885,19 @@ static int MaskUB( AstRegion *, AstMapping *, int, int, const int[], const int[]
 static int MaskUI( AstRegion *, AstMapping *, int, int, const int[], const int[], unsigned int[], unsigned int, int * );
 static int MaskUL( AstRegion *, AstMapping *, int, int, const int[], const int[], unsigned long int[], unsigned long int, int * );
 static int MaskUS( AstRegion *, AstMapping *, int, int, const int[], const int[], unsigned short int[], unsigned short int, int * );
+#if HAVE_LONG_DOUBLE     /* Not normally implemented */
+static int64_t Mask8LD( AstRegion *, AstMapping *, int, int, const int64_t[], const int64_t[], long double [], long double, int * );
+#endif
+static int64_t Mask8B( AstRegion *, AstMapping *, int, int, const int64_t[], const int64_t[], signed char[], signed char, int * );
+static int64_t Mask8D( AstRegion *, AstMapping *, int, int, const int64_t[], const int64_t[], double[], double, int * );
+static int64_t Mask8F( AstRegion *, AstMapping *, int, int, const int64_t[], const int64_t[], float[], float, int * );
+static int64_t Mask8I( AstRegion *, AstMapping *, int, int, const int64_t[], const int64_t[], int[], int, int * );
+static int64_t Mask8L( AstRegion *, AstMapping *, int, int, const int64_t[], const int64_t[], long int[], long int, int * );
+static int64_t Mask8S( AstRegion *, AstMapping *, int, int, const int64_t[], const int64_t[], short int[], short int, int * );
+static int64_t Mask8UB( AstRegion *, AstMapping *, int, int, const int64_t[], const int64_t[], unsigned char[], unsigned char, int * );
+static int64_t Mask8UI( AstRegion *, AstMapping *, int, int, const int64_t[], const int64_t[], unsigned int[], unsigned int, int * );
+static int64_t Mask8UL( AstRegion *, AstMapping *, int, int, const int64_t[], const int64_t[], unsigned long int[], unsigned long int, int * );
+static int64_t Mask8US( AstRegion *, AstMapping *, int, int, const int64_t[], const int64_t[], unsigned short int[], unsigned short int, int * );
 
 static AstAxis *GetAxis( AstFrame *, int, int * );
 static AstFrame *GetRegionFrame( AstRegion *, int * );
@@ -900,6 +912,7 @@ static AstFrameSet *GetRegFS( AstRegion *, int * );
 static AstLineDef *LineDef( AstFrame *, const double[2], const double[2], int * );
 static AstMapping *RegMapping( AstRegion *, int * );
 static AstMapping *RemoveRegions( AstMapping *, int * );
+static int ThreadSafe( AstMapping *, int * );
 static AstMapping *Simplify( AstMapping *, int * );
 static AstObject *Cast( AstObject *, AstObject *, int * );
 static AstPointSet *BTransform( AstRegion *, AstPointSet *, int, AstPointSet *, int * );
@@ -919,6 +932,7 @@ static AstSystemType SystemCode( AstFrame *, const char *, int * );
 static AstSystemType ValidateSystem( AstFrame *, AstSystemType, const char *, int * );
 static const char *Abbrev( AstFrame *, int, const char *, const char *, const char *, int * );
 static const char *Format( AstFrame *, int, double, int * );
+static void FormatArray( AstFrame *, int, int, const double *, int, char *, int * );
 static const char *SystemString( AstFrame *, AstSystemType, int * );
 static const int *GetPerm( AstFrame *, int * );
 static double *RegCentre( AstRegion *, double *, double **, int, int, int * );
@@ -945,6 +959,7 @@ static int RegPins( AstRegion *, AstPointSet *, AstRegion *, int **, int * );
 static int SubFrame( AstFrame *, AstFrame *, int, const int *, const int *, AstMapping **, AstFrame **, int * );
 static int RegTrace( AstRegion *, int, double *, double **, int * );
 static int Unformat( AstFrame *, int, const char *, double *, int * );
+static int UnformatArray( AstFrame *, int, int, const char *const [], double *, int * );
 static int ValidateAxis( AstFrame *, int, int, const char *, int * );
 static void AxNorm( AstFrame *, int, int, int, double *, int * );
 static void CheckPerm( AstFrame *, const int *, const char *, int * );
@@ -1132,9 +1147,7 @@ static int TestAdaptive( AstRegion *, int * );
 static void ClearAdaptive( AstRegion *, int * );
 static void SetAdaptive( AstRegion *, int, int * );
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *, int, int, AstObject **, int * );
-#endif
 
 
 /* Member functions. */
@@ -2917,6 +2930,76 @@ static const char *Format( AstFrame *this_frame, int axis, double value, int *st
    return result;
 }
 
+static void FormatArray( AstFrame *this_frame, int axis, int npoint,
+                         const double *value, int len, char *buf,
+                         int *status ) {
+/*
+*  Name:
+*     FormatArray
+
+*  Purpose:
+*     Format an array of coordinate values for a Region axis.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "region.h"
+*     void FormatArray( AstFrame *this, int axis, int npoint,
+*                       const double *value, int len, char *buf,
+*                       int *status )
+
+*  Class Membership:
+*     Region member function (over-rides the astFormatArray method
+*     inherited from the Frame class).
+
+*  Description:
+*     This function formats an array of coordinate values for a
+*     Region axis, storing the resulting strings in a buffer supplied by
+*     the caller. The formatting applied is the same as for astFormat.
+
+*  Parameters:
+*     this
+*        Pointer to the Region.
+*     axis
+*        The number of the axis (zero-based) for which formatting is
+*        to be performed.
+*     npoint
+*        The number of values to be formatted.
+*     value
+*        Pointer to an array of "npoint" coordinate values.
+*     len
+*        The number of characters reserved in "buf" for each formatted
+*        value, including the terminating null.
+*     buf
+*        Pointer to a buffer of at least "npoint*len" characters. The
+*        formatted version of "value[i]" is returned as a null-terminated
+*        string starting at "buf[i*len]".
+*     status
+*        Pointer to the inherited status variable.
+*/
+
+/* Local Variables: */
+   AstFrame *fr;                 /* Pointer to current Frame */
+   AstRegion *this;              /* Pointer to the Region structure */
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* Obtain a pointer to the Region structure. */
+   this = (AstRegion *) this_frame;
+
+/* Validate the axis index. */
+   (void) astValidateAxis( this, axis, 1, "astFormatArray" );
+
+/* Obtain a pointer to the Region's current Frame and invoke the
+   astFormatArray method for this Frame. Annul the Frame pointer
+   afterwards. */
+   fr = astGetFrame( this->frameset, AST__CURRENT );
+   astFormatArray( fr, axis, npoint, value, len, buf );
+   fr = astAnnul( fr );
+}
+
 static double Gap( AstFrame *this_frame, int axis, double gap, int *ntick, int *status ) {
 /*
 *  Name:
@@ -4597,6 +4680,19 @@ void astInitRegionVtab_(  AstRegionVtab *vtab, const char *name, int *status ) {
 #if HAVE_LONG_DOUBLE     /* Not normally implemented */
    vtab->MaskLD = MaskLD;
 #endif
+   vtab->Mask8B = Mask8B;
+   vtab->Mask8D = Mask8D;
+   vtab->Mask8F = Mask8F;
+   vtab->Mask8I = Mask8I;
+   vtab->Mask8L = Mask8L;
+   vtab->Mask8S = Mask8S;
+   vtab->Mask8UB = Mask8UB;
+   vtab->Mask8UI = Mask8UI;
+   vtab->Mask8UL = Mask8UL;
+   vtab->Mask8US = Mask8US;
+#if HAVE_LONG_DOUBLE     /* Not normally implemented */
+   vtab->Mask8LD = Mask8LD;
+#endif
 
 /* Save the inherited pointers to methods that will be extended, and store
    replacement pointers for methods which will be over-ridden by new member
@@ -4611,10 +4707,8 @@ void astInitRegionVtab_(  AstRegionVtab *vtab, const char *name, int *status ) {
    parent_getusedefs = object->GetUseDefs;
    object->GetUseDefs = GetUseDefs;
 
-#if defined(THREAD_SAFE)
    parent_managelock = object->ManageLock;
    object->ManageLock = ManageLock;
-#endif
 
    object->Cast = Cast;
    object->Equal = Equal;
@@ -4626,6 +4720,7 @@ void astInitRegionVtab_(  AstRegionVtab *vtab, const char *name, int *status ) {
    mapping->ReportPoints = ReportPoints;
    mapping->RemoveRegions = RemoveRegions;
    mapping->Simplify = Simplify;
+   mapping->ThreadSafe = ThreadSafe;
 
    frame->Abbrev = Abbrev;
    frame->Angle = Angle;
@@ -4652,6 +4747,7 @@ void astInitRegionVtab_(  AstRegionVtab *vtab, const char *name, int *status ) {
    frame->Distance = Distance;
    frame->FindFrame = FindFrame;
    frame->Format = Format;
+   frame->FormatArray = FormatArray;
    frame->Centre = Centre;
    frame->Gap = Gap;
    frame->GetAxis = GetAxis;
@@ -4713,6 +4809,7 @@ void astInitRegionVtab_(  AstRegionVtab *vtab, const char *name, int *status ) {
    frame->TestTitle = TestTitle;
    frame->TestUnit = TestUnit;
    frame->Unformat = Unformat;
+   frame->UnformatArray = UnformatArray;
    frame->ValidateAxis = ValidateAxis;
    frame->ValidateAxisSelection = ValidateAxisSelection;
    frame->ValidateSystem = ValidateSystem;
@@ -5198,7 +5295,6 @@ static void LineOffset( AstFrame *this_frame, AstLineDef *line, double par,
 }
 
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *this_object, int mode, int extra,
                        AstObject **fail, int *status ) {
 /*
@@ -5296,7 +5392,6 @@ static int ManageLock( AstObject *this_object, int mode, int extra,
    return result;
 
 }
-#endif
 
 static AstRegion *MapRegion( AstRegion *this, AstMapping *map0,
                              AstFrame *frame0, int *status ) {
@@ -6105,6 +6200,200 @@ MAKE_MASK(F,float)
 /* Undefine the macro. */
 #undef MAKE_MASK
 
+/*
+c++
+*  Name:
+*     astMask8<X>
+
+*  Purpose:
+*     Mask a region of a data grid that may be too large for astMask<X>.
+
+*  Type:
+*     Public virtual function.
+
+*  Synopsis:
+*     #include "region.h"
+*     int64_t astMask8<X>( AstRegion *this, AstMapping *map, int inside,
+*                          int ndim, const int64_t lbnd[],
+*                          const int64_t ubnd[], <Xtype> in[],
+*                          <Xtype> val )
+
+*  Class Membership:
+*     Region method.
+
+*  Description:
+*     This is a set of functions that perform the same task as the
+*     astMask<X> functions, but which accept 64-bit pixel index bounds
+*     and return a 64-bit count of masked pixels. They may therefore be
+*     used with arrays that contain more than INT_MAX pixels.
+*
+*     If the array contains no more than INT_MAX pixels, it is masked
+*     in a single call to astMask<X>. Otherwise, it is divided into
+*     slabs along its last dimension, each containing no more than
+*     INT_MAX pixels, and each slab is masked in turn using
+*     astMask<X>. Since each pixel is tested individually, the results
+*     are identical to those that astMask<X> would produce for arrays of
+*     unlimited size.
+
+*  Parameters:
+*     lbnd
+*        Pointer to an array of 64-bit integers, with "ndim" elements,
+*        containing the coordinates of the centre of the first pixel in
+*        the input grid along each dimension.
+*     ubnd
+*        Pointer to an array of 64-bit integers, with "ndim" elements,
+*        containing the coordinates of the centre of the last pixel in
+*        the input grid along each dimension.
+*
+*     See astMask<X> for a description of the remaining parameters.
+
+*  Returned Value:
+*     astMask8<X>()
+*        The number of pixels to which a value of "val" has been
+*        assigned.
+
+*  Notes:
+*     - There is a separate function for each numerical type of
+*     gridded data, distinguished by replacing the <X> in the function
+*     name by the appropriate 1- or 2-character suffix (see the "Data
+*     Type Codes" section of astMask<X>).
+*     - Each bound must lie within the range of an int, and the pixels
+*     in each plane of the grid (i.e. the pixels that share a single
+*     index on the last dimension) must number no more than INT_MAX. An
+*     error is reported otherwise.
+*     - This function is not available in the FORTRAN 77 interface to
+*     the AST library.
+*     - A value of zero will be returned if this function is invoked
+*     with the global error status set, or if it should fail for any
+*     reason.
+c--
+*/
+/* Define a macro to implement the function for a specific data
+   type. */
+#define MAKE_MASK8(X,Xtype) \
+static int64_t Mask8##X( AstRegion *this, AstMapping *map, int inside, \
+                         int ndim, const int64_t lbnd[], \
+                         const int64_t ubnd[], Xtype in[], Xtype val, \
+                         int *status ) { \
+\
+/* Local Variables: */ \
+   int *ilbnd;                   /* Int lower bounds of slab */ \
+   int *iubnd;                   /* Int upper bounds of slab */ \
+   int idim;                     /* Loop counter for dimensions */ \
+   int last;                     /* Index of last grid dimension */ \
+   int slabbed;                  /* Divide the array into slabs? */ \
+   int64_t hi;                   /* Last index of slab on last dimension */ \
+   int64_t limit;                /* Maximum number of pixels in a slab */ \
+   int64_t lo;                   /* First index of slab on last dimension */ \
+   int64_t npix;                 /* Number of pixels in array */ \
+   int64_t nrow;                 /* Number of planes in each slab */ \
+   int64_t result;               /* Result value to return */ \
+   int64_t stride;               /* Number of pixels in each plane */ \
+\
+/* Initialise. */ \
+   result = 0; \
+\
+/* Check the global error status. */ \
+   if ( !astOK ) return result; \
+\
+/* Get the maximum number of pixels in each slab. */ \
+   limit = astSlabPix( AST__TUNULL ); \
+\
+/* Allocate arrays to hold int versions of the bounds. */ \
+   ilbnd = astMalloc( sizeof( int )*(size_t) ( ( ndim > 1 ) ? ndim : 1 ) ); \
+   iubnd = astMalloc( sizeof( int )*(size_t) ( ( ndim > 1 ) ? ndim : 1 ) ); \
+\
+/* Check that every bound can be stored in an int, and store it. Also \
+   find the number of pixels in the array. */ \
+   npix = 1; \
+   slabbed = ( ndim >= 1 ); \
+   if ( astOK ) { \
+      for ( idim = 0; idim < ndim && astOK; idim++ ) { \
+         if ( lbnd[ idim ] < INT_MIN || ubnd[ idim ] > INT_MAX ) { \
+            astError( AST__GBDIN, "astMask8"#X"(%s): Bounds of input grid " \
+                      "(%g:%g) lie outside the range of an int.", status, \
+                      astGetClass( this ), (double) lbnd[ idim ], \
+                      (double) ubnd[ idim ] ); \
+            astError( AST__GBDIN, "Error in input dimension %d.", status, \
+                      idim + 1 ); \
+         } \
+         ilbnd[ idim ] = (int) lbnd[ idim ]; \
+         iubnd[ idim ] = (int) ubnd[ idim ]; \
+         if ( lbnd[ idim ] <= ubnd[ idim ] ) { \
+            npix *= ubnd[ idim ] - lbnd[ idim ] + 1; \
+         } else { \
+            slabbed = 0; \
+         } \
+      } \
+   } \
+\
+/* If the array is small enough, or the arguments are invalid in a way \
+   that would prevent the slabs being formed, mask it in a single call \
+   (which will report any error). */ \
+   if ( !slabbed || npix <= limit ) { \
+      if ( astOK ) { \
+         result = astMask##X( this, map, inside, ndim, ilbnd, iubnd, in, \
+                              val ); \
+      } \
+\
+/* Otherwise, find the number of pixels in each plane of the array (i.e. \
+   the pixels that share a single index on the last dimension), and \
+   report an error if a single plane is too large. */ \
+   } else { \
+      last = ndim - 1; \
+      stride = npix/( ubnd[ last ] - lbnd[ last ] + 1 ); \
+      if ( stride > limit ) { \
+         astError( AST__EXSPIX, "astMask8"#X"(%s): Each plane of the " \
+                   "supplied array contains too many pixels (%g): must be " \
+                   "fewer than %d.", status, astGetClass( this ), \
+                   (double) stride, (int) limit ); \
+      } \
+\
+/* Mask each slab in turn. The pixel indices are not changed, so each \
+   pixel is tested in exactly the same way as if the whole array had \
+   been masked in a single call. */ \
+      nrow = limit/stride; \
+      if ( nrow < 1 ) nrow = 1; \
+      for ( lo = lbnd[ last ]; lo <= ubnd[ last ] && astOK; lo = hi + 1 ) { \
+         hi = lo + nrow - 1; \
+         if ( hi > ubnd[ last ] ) hi = ubnd[ last ]; \
+         ilbnd[ last ] = (int) lo; \
+         iubnd[ last ] = (int) hi; \
+         result += astMask##X( this, map, inside, ndim, ilbnd, iubnd, \
+                               in + ( lo - lbnd[ last ] )*stride, val ); \
+      } \
+   } \
+\
+/* Free resources */ \
+   ilbnd = astFree( ilbnd ); \
+   iubnd = astFree( iubnd ); \
+\
+/* If an error occurred, clear the returned result. */ \
+   if ( !astOK ) result = 0; \
+\
+/* Return the result. */ \
+   return result; \
+}
+
+/* Expand the above macro to generate a function for each required
+   data type. */
+#if HAVE_LONG_DOUBLE     /* Not normally implemented */
+MAKE_MASK8(LD,long double)
+#endif
+MAKE_MASK8(D,double)
+MAKE_MASK8(L,long int)
+MAKE_MASK8(UL,unsigned long int)
+MAKE_MASK8(I,int)
+MAKE_MASK8(UI,unsigned int)
+MAKE_MASK8(S,short int)
+MAKE_MASK8(US,unsigned short int)
+MAKE_MASK8(B,signed char)
+MAKE_MASK8(UB,unsigned char)
+MAKE_MASK8(F,float)
+
+/* Undefine the macro. */
+#undef MAKE_MASK8
+
 
 
 static int Match( AstFrame *this_frame, AstFrame *target, int matchsub,
@@ -11578,6 +11867,39 @@ static AstPointSet *RegTransform( AstRegion *this, AstPointSet *in,
    return result;
 }
 
+static int ThreadSafe( AstMapping *this_mapping, int *status ){
+/*
+*  Name:
+*     ThreadSafe
+
+*  Purpose:
+*     Check if a Region can transform points in several threads at once.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "region.h"
+*     int ThreadSafe( AstMapping *this, int *status )
+
+*  Class Membership:
+*     Region member function (over-rides the protected astThreadSafe
+*     method inherited from the Mapping class).
+
+*  Description:
+*     This function always returns zero, since Regions cache information
+*     (such as the base mesh and the Region boundary in the current
+*     Frame) when they are first used to transform points.
+
+*  Parameters:
+*     this
+*        Pointer to the Region.
+*     status
+*        Pointer to the inherited status variable.
+*/
+   return 0;
+}
+
 static int Unformat( AstFrame *this_frame, int axis, const char *string,
                      double *value, int *status ) {
 /*
@@ -11680,6 +12002,87 @@ static int Unformat( AstFrame *this_frame, int axis, const char *string,
    return nc;
 }
 
+static int UnformatArray( AstFrame *this_frame, int axis, int npoint,
+                          const char *const strings[], double *value,
+                          int *status ) {
+/*
+*  Name:
+*     UnformatArray
+
+*  Purpose:
+*     Read an array of formatted coordinate values for a Region axis.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "region.h"
+*     int UnformatArray( AstFrame *this, int axis, int npoint,
+*                        const char *const strings[], double *value,
+*                        int *status )
+
+*  Class Membership:
+*     Region member function (over-rides the astUnformatArray method
+*     inherited from the Frame class).
+
+*  Description:
+*     This function reads an array of formatted coordinate values for
+*     a Region axis (supplied as strings) and returns the equivalent
+*     numerical values. Each string is interpreted as by astUnformat.
+
+*  Parameters:
+*     this
+*        Pointer to the Region.
+*     axis
+*        The number of the axis (zero-based) for which the coordinate
+*        values are to be read.
+*     npoint
+*        The number of strings to be read.
+*     strings
+*        An array of "npoint" pointers to null-terminated strings, each
+*        holding a formatted coordinate value.
+*     value
+*        Pointer to an array in which to return the "npoint" coordinate
+*        values read.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     The number of strings that were read successfully (see
+*     astUnformatArray).
+*/
+
+/* Local Variables: */
+   AstFrame *fr;                 /* Pointer to current Frame */
+   AstRegion *this;              /* Pointer to the Region structure */
+   int result;                   /* Number of strings read */
+
+/* Initialise. */
+   result = 0;
+
+/* Check the global error status. */
+   if ( !astOK ) return result;
+
+/* Obtain a pointer to the Region structure. */
+   this = (AstRegion *) this_frame;
+
+/* Validate the axis index. */
+   (void) astValidateAxis( this, axis, 1, "astUnformatArray" );
+
+/* Obtain a pointer to the Region's current Frame and invoke the
+   astUnformatArray method for this Frame. Annul the Frame pointer
+   afterwards. */
+   fr = astGetFrame( this->frameset, AST__CURRENT );
+   result = astUnformatArray( fr, axis, npoint, strings, value );
+   fr = astAnnul( fr );
+
+/* Return zero if an error occurred. */
+   if ( !astOK ) result = 0;
+
+/* Return the result. */
+   return result;
+}
+
 static int ValidateAxis( AstFrame *this_frame, int axis, int fwd,
                          const char *method, int *status ) {
 /*
@@ -13363,6 +13766,31 @@ MAKE_MASK_(B,signed char)
 MAKE_MASK_(UB,unsigned char)
 #undef MAKE_MASK_
 
+#define MAKE_MASK8_(X,Xtype) \
+int64_t astMask8##X##_( AstRegion *this, AstMapping *map, int inside, \
+                        int ndim, const int64_t lbnd[], \
+                        const int64_t ubnd[], Xtype in[], Xtype val, \
+                        int *status ) { \
+   if ( !astOK ) return 0; \
+   return (**astMEMBER(this,Region,Mask8##X))( this, map, inside, ndim, \
+                                               lbnd, ubnd, in, val, \
+                                               status ); \
+}
+#if HAVE_LONG_DOUBLE     /* Not normally implemented */
+MAKE_MASK8_(LD,long double)
+#endif
+MAKE_MASK8_(D,double)
+MAKE_MASK8_(F,float)
+MAKE_MASK8_(L,long int)
+MAKE_MASK8_(UL,unsigned long int)
+MAKE_MASK8_(I,int)
+MAKE_MASK8_(UI,unsigned int)
+MAKE_MASK8_(S,short int)
+MAKE_MASK8_(US,unsigned short int)
+MAKE_MASK8_(B,signed char)
+MAKE_MASK8_(UB,unsigned char)
+#undef MAKE_MASK8_
+
 /* Special public interface functions. */
 /* =================================== */
 /* These provide the public interface to certain special functions
@@ -147,6 +147,7 @@ AstShiftMap *astShiftMapId_( int, const double [], const char *, ... );
 /* ======================================== */
 
 static AstPointSet *Transform( AstMapping *, AstPointSet *, int, AstPointSet *, int * );
+static void JacobianPoints( AstMapping *, AstPointSet *, int, AstPointSet *, int * );
 static int GetObjSize( AstObject *, int * );
 static double Rate( AstMapping *, double *, int, int, int * );
 static int MapMerge( AstMapping *, int, int, int *, AstMapping ***, int **, int * );
@@ -437,6 +438,7 @@ void astInitShiftMapVtab_(  AstShiftMapVtab *vtab, const char *name, int *status
    object->Equal = Equal;
    mapping->MapMerge = MapMerge;
    mapping->Rate = Rate;
+   mapping->JacobianPoints = JacobianPoints;
    mapping->MapSplit = MapSplit;
    mapping->GetIsLinear = GetIsLinear;
 
@@ -764,6 +766,65 @@ static int *MapSplit( AstMapping *this_map, int nin, const int *in, AstMapping *
    return result;
 }
 
+static void JacobianPoints( AstMapping *this, AstPointSet *in, int forward,
+                            AstPointSet *jac, int *status ) {
+/*
+*  Name:
+*     JacobianPoints
+
+*  Purpose:
+*     Find the Jacobian matrix of a Mapping at a set of points.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "shiftmap.h"
+*     void JacobianPoints( AstMapping *this, AstPointSet *in, int forward,
+*                          AstPointSet *jac, int *status )
+
+*  Class Membership:
+*     ShiftMap member function (over-rides the astJacobianPoints protected
+*     method inherited from the Mapping class).
+
+*  Description:
+*     This function stores the Jacobian matrix of a ShiftMap (a unit
+*     matrix) at each of the points in a PointSet.
+
+*  Parameters:
+*     this
+*        Pointer to the ShiftMap.
+*     in
+*        Pointer to the PointSet holding the positions at which the
+*        Jacobian is required.
+*     forward
+*        A non-zero value indicates that the Jacobian of the forward
+*        coordinate transformation is required, while a zero value
+*        requests the Jacobian of the inverse transformation.
+*     jac
+*        Pointer to the PointSet in which to store the Jacobian.
+*     status
+*        Pointer to the inherited status variable.
+*/
+
+/* Local Variables: */
+   double *matrix;               /* Jacobian matrix */
+   int coord;                    /* Coordinate index */
+   int nin;                      /* Number of input coordinates */
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* Form a unit matrix, and store it at every point. */
+   nin = astGetNcoord( in );
+   matrix = astCalloc( nin*nin, sizeof( double ) );
+   if ( astOK ) {
+      for ( coord = 0; coord < nin; coord++ ) matrix[ coord*( nin + 1 ) ] = 1.0;
+      astLinearJacobian( in, nin, matrix, jac );
+   }
+   matrix = astFree( matrix );
+}
+
 static double Rate( AstMapping *this, double *at, int ax1, int ax2, int *status ){
 /*
 *  Name:
@@ -178,6 +178,8 @@ static double (*parent_getaxistop)( AstAxis *this, int * );
 static const char *(* parent_axisformat)( AstAxis *, double, int * );
 static double (*parent_axisgap)( AstAxis *, double, int *, int * );
 static int (*parent_axisunformat)( AstAxis *, const char *, double *, int * );
+static int (*parent_axisunformatarray)( AstAxis *, int, const char *const [], double *, int * );
+static void (*parent_axisformatarray)( AstAxis *, int, const double *, int, char *, int * );
 static int (*parent_axisfields)( AstAxis *, const char *, const char *, int, char **, int *, double *, int * );
 
 /* Factors for converting between hours, degrees and radians. */
@@ -251,6 +253,7 @@ static const char *GetAxisLabel( AstAxis *, int * );
 static const char *GetAxisSymbol( AstAxis *, int * );
 static const char *GetAxisUnit( AstAxis *, int * );
 static const char *DHmsFormat( const char *, int, double, int * );
+static const char *DHmsFormatParsed( char, int, int, int, int, int, int, int, double, int * );
 static const char *DHmsUnit( const char *, int, int, int * );
 static double AxisGap( AstAxis *, double, int *, int * );
 static double AxisDistance( AstAxis *, double, double, int * );
@@ -261,6 +264,8 @@ static double GetAxisBottom( AstAxis *, int * );
 static int AxisIn( AstAxis *, double, double, double, int, int * );
 static int AxisFields( AstAxis *, const char *, const char *, int, char **, int *, double *, int * );
 static int AxisUnformat( AstAxis *, const char *, double *, int * );
+static int AxisUnformatArray( AstAxis *, int, const char *const [], double *, int * );
+static int DHmsUnformat( const char *, int, int, int, double *, int * );
 static int GetAxisAsTime( AstSkyAxis *, int * );
 static int GetAxisDirection( AstAxis *, int * );
 static int GetAxisIsLatitude( AstSkyAxis *, int * );
@@ -271,6 +276,7 @@ static int TestAxisFormat( AstAxis *, int * );
 static int TestAxisInternalUnit( AstAxis *, int * );
 static int TestAxisIsLatitude( AstSkyAxis *, int * );
 static int TestAxisCentreZero( AstSkyAxis *, int * );
+static void AxisFormatArray( AstAxis *, int, const double *, int, char *, int * );
 static void AxisNorm( AstAxis *, double *, int * );
 static void AxisNormValues( AstAxis *, int, int, double *, int * );
 static void AxisOverlay( AstAxis *, AstAxis *, int * );
@@ -874,6 +880,100 @@ static const char *AxisFormat( AstAxis *this_axis, double value, int *status ) {
    return result;
 }
 
+static void AxisFormatArray( AstAxis *this_axis, int npoint,
+                             const double *value, int len, char *buf,
+                             int *status ) {
+/*
+*  Name:
+*     AxisFormatArray
+
+*  Purpose:
+*     Format an array of coordinate values for a SkyAxis.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "skyaxis.h"
+*     void AxisFormatArray( AstAxis *this, int npoint, const double *value,
+*                           int len, char *buf, int *status )
+
+*  Class Membership:
+*     SkyAxis member function (over-rides the astAxisFormatArray method
+*     inherited from the Axis class).
+
+*  Description:
+*     This function formats an array of coordinate values for a SkyAxis,
+*     storing the resulting strings in a buffer supplied by the caller.
+*     The Format string is obtained and parsed only once.
+
+*  Parameters:
+*     this
+*        Pointer to the SkyAxis.
+*     npoint
+*        The number of values to be formatted.
+*     value
+*        Pointer to an array of "npoint" coordinate values (in radians).
+*     len
+*        The number of characters reserved in "buf" for each formatted
+*        value, including the terminating null.
+*     buf
+*        Pointer to a buffer of at least "npoint*len" characters. The
+*        formatted version of "value[i]" is returned as a null-terminated
+*        string starting at "buf[i*len]".
+*     status
+*        Pointer to the inherited status variable.
+*/
+
+/* Local Variables: */
+   char sep;                     /* Field separator character */
+   const char *fmt;              /* Pointer to format specifier */
+   const char *text;             /* Pointer to formatted value */
+   int as_time;                  /* Format the value as a time? */
+   int dh;                       /* Degrees/hours field required? */
+   int i;                        /* Index of current value */
+   int lead_zero;                /* Add leading zeros? */
+   int min;                      /* Minutes field required? */
+   int nc;                       /* Number of characters to store */
+   int ndp;                      /* Number of decimal places */
+   int plus;                     /* Add leading plus sign? */
+   int sec;                      /* Seconds field required? */
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* Obtain a pointer to the format specifier to be used, as in the
+   AxisFormat function. If it starts with a percent, use the method
+   inherited from the parent Axis class. */
+   fmt = GetAxisFormat( this_axis, status );
+   if ( !astOK ) return;
+   if( fmt[ 0 ] == '%' ) {
+      (*parent_axisformatarray)( this_axis, npoint, value, len, buf, status );
+
+/* Otherwise, parse the format specifier once and then format each value,
+   copying the result into the caller's buffer. */
+   } else {
+      ParseDHmsFormat( fmt, astGetAxisDigits( this_axis ), &sep, &plus,
+                       &lead_zero, &as_time, &dh, &min, &sec, &ndp, status );
+
+      for ( i = 0; i < npoint && astOK; i++ ) {
+         if ( value[ i ] == AST__BAD ) {
+            text = "<bad>";
+         } else {
+            text = DHmsFormatParsed( sep, plus, lead_zero, as_time, dh, min,
+                                     sec, ndp, value[ i ], status );
+         }
+
+         if ( text ) {
+            nc = strlen( text );
+            if ( nc >= len ) nc = len - 1;
+            memcpy( buf + i*len, text, (size_t) nc );
+            buf[ i*len + nc ] = '\0';
+         }
+      }
+   }
+}
+
 static double AxisGap( AstAxis *this_axis, double gap, int *ntick, int *status ) {
 /*
 *  Name:
@@ -1679,35 +1779,19 @@ static const char *DHmsFormat( const char *fmt, int digs, double value, int *sta
 */
 
 /* Local Variables: */
-   astDECLARE_GLOBALS            /* Pointer to thread-specific global data */
-   char *term;                   /* Pointer to terminator string */
    char sep;                     /* Field separator character */
-   char tbuf[50];                /* Buffer for terminator string */
    const char *result;           /* Pointer to result string */
-   double absvalue;              /* Absolute value in radians */
-   double fract;                 /* Fractional part of final field */
-   double idh;                   /* Integer number of degrees/hours */
-   double ifract;                /* Fractional part expressed as an integer */
-   double imin;                  /* Integer number of minutes */
-   double isec;                  /* Integer number of seconds */
-   double shift;                 /* Factor for rounding fractional part */
-   double test;                  /* Test value to determine rounding */
    int as_time;                  /* Format the value as a time? */
    int dh;                       /* Degrees/hours field required? */
    int lead_zero;                /* Add leading zeros? */
    int min;                      /* Minutes field required? */
    int ndp;                      /* Number of decimal places */
    int plus;                     /* Add leading plus sign? */
-   int pos;                      /* Position to add next character */
-   int positive;                 /* Value is positive (or zero)? */
    int sec;                      /* Seconds field required? */
 
 /* Check the global error status. */
    if ( !astOK ) return NULL;
 
-/* Get a pointer to the thread specific global data structure. */
-   astGET_GLOBALS(NULL);
-
 /* Initialise. */
    result = NULL;
 
@@ -1716,58 +1800,139 @@ static const char *DHmsFormat( const char *fmt, int digs, double value, int *sta
    if ( value == AST__BAD ) {
       result = "<bad>";
 
-/* Otherwise... */
+/* Otherwise, parse the format specifier and format the value. */
    } else {
-
-/* Parse the format specifier. */
       ParseDHmsFormat( fmt, digs, &sep, &plus, &lead_zero,
                        &as_time, &dh, &min, &sec, &ndp, status );
+      result = DHmsFormatParsed( sep, plus, lead_zero, as_time, dh, min, sec,
+                                 ndp, value, status );
+   }
+
+/* Return the result. */
+   return result;
+}
+
+static const char *DHmsFormatParsed( char sep, int plus, int lead_zero,
+                                     int as_time, int dh, int min, int sec,
+                                     int ndp, double value, int *status ) {
+/*
+*  Name:
+*     DHmsFormatParsed
+
+*  Purpose:
+*     Format a value using a parsed degrees/hours, minutes and seconds
+*     format specifier.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "skyaxis.h"
+*     const char *DHmsFormatParsed( char sep, int plus, int lead_zero,
+*                                   int as_time, int dh, int min, int sec,
+*                                   int ndp, double value, int *status )
+
+*  Class Membership:
+*     SkyAxis member function.
+
+*  Description:
+*     This function formats a value representing an angle in radians
+*     into a text string giving degrees/hours, minutes and seconds. The
+*     format is described by the values returned by ParseDHmsFormat, so
+*     that the format specifier need only be parsed once when many values
+*     are formatted.
+
+*  Parameters:
+*     sep, plus, lead_zero, as_time, dh, min, sec, ndp
+*        The values returned by ParseDHmsFormat for the required format
+*        specifier.
+*     value
+*        The value to be formatted (in radians). Must not be AST__BAD.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     Pointer to a null terminated character string containing the
+*     formatted value.
+
+*  Notes:
+*     - The result string is stored in static memory and may be
+*     over-written by a subsequent invocation of this function or of
+*     DHmsFormat.
+*     - A NULL pointer is returned if this function is invoked with the
+*     global error status set or if it should fail for any reason.
+*/
+
+/* Local Variables: */
+   astDECLARE_GLOBALS            /* Pointer to thread-specific global data */
+   char *term;                   /* Pointer to terminator string */
+   char tbuf[50];                /* Buffer for terminator string */
+   const char *result;           /* Pointer to result string */
+   double absvalue;              /* Absolute value in radians */
+   double fract;                 /* Fractional part of final field */
+   double idh;                   /* Integer number of degrees/hours */
+   double ifract;                /* Fractional part expressed as an integer */
+   double imin;                  /* Integer number of minutes */
+   double isec;                  /* Integer number of seconds */
+   double shift;                 /* Factor for rounding fractional part */
+   double test;                  /* Test value to determine rounding */
+   int pos;                      /* Position to add next character */
+   int positive;                 /* Value is positive (or zero)? */
+
+/* Check the global error status. */
+   if ( !astOK ) return NULL;
+
+/* Get a pointer to the thread specific global data structure. */
+   astGET_GLOBALS(NULL);
+
+/* Initialise. */
+   result = NULL;
 
 /* Break the value into fields. */
 /* ---------------------------- */
 /* Restrict the number of decimal places requested, if necessary, so
    that under the worst case the buffer for the result string is not
    likely to overflow. */
-      if ( astOK ) {
-         if ( ( ndp + 11 ) > AST__SKYAXIS_DHMSFORMAT_BUFF_LEN ) ndp = AST__SKYAXIS_DHMSFORMAT_BUFF_LEN - 11;
+   if ( astOK ) {
+      if ( ( ndp + 11 ) > AST__SKYAXIS_DHMSFORMAT_BUFF_LEN ) ndp = AST__SKYAXIS_DHMSFORMAT_BUFF_LEN - 11;
 
 /* Some operating systems have a "minus zero" value (for instance
    "-1.2*0" would give "-0"). This value is numerically equivalent to
    zero, but is formated as "-0" instead of "0". The leading minus sign
    confuses the following code, and so ensure now that all zero values
    are the usual  "+0". */
-         if ( value == 0.0 ) value = 0.0;
+      if ( value == 0.0 ) value = 0.0;
 
 /* Determine if the value to be formatted is positive and obtain its
    absolute value in radians. */
-         positive = ( value >= 0.0 );
-         absvalue = positive ? value : -value;
+      positive = ( value >= 0.0 );
+      absvalue = positive ? value : -value;
 
 /* Convert this to an absolute number of degrees or hours, as
    required. */
-         fract = absvalue / ( as_time ? hr2rad : deg2rad );
+      fract = absvalue / ( as_time ? hr2rad : deg2rad );
 
 /* If a degrees/hours field is required, extract the whole number of
    degrees/hours and the remaining fractional part of a
    degree/hour. */
-         idh = 0.0;
-         if ( dh ) fract = modf( fract, &idh );
+      idh = 0.0;
+      if ( dh ) fract = modf( fract, &idh );
 
 /* If a minutes field is required, convert the value remaining to
    minutes and extract the whole number of minutes and the remaining
    fractional part of a minute. */
-         imin = 0.0;
-         if ( min ) fract = modf( fract * 60.0, &imin );
+      imin = 0.0;
+      if ( min ) fract = modf( fract * 60.0, &imin );
 
 /* If a seconds field is required, convert the value remaining to
    seconds (allowing for the absence of a minutes field if necessary)
    and extract the whole number of seconds and the remaining
    fractional part of a second. */
-         isec = 0.0;
-         if ( sec ) {
-            if ( !min ) fract *= 60.0;
-            fract = modf( fract * 60.0, &isec );
-         }
+      isec = 0.0;
+      if ( sec ) {
+         if ( !min ) fract *= 60.0;
+         fract = modf( fract * 60.0, &isec );
+      }
 
 /* Round to the required number of decimal places. */
 /* ----------------------------------------------- */
@@ -1777,8 +1942,8 @@ static const char *DHmsFormat( const char *fmt, int digs, double value, int *sta
    fractional part by this factor and truncate to an integer (but
    stored as a double to prevent possible integer overflow if the
    number of decimal places is excessive). */
-         shift = pow( 10.0, (double) ndp );
-         ifract = floor( fract * shift );
+      shift = pow( 10.0, (double) ndp );
+      ifract = floor( fract * shift );
 
 /* Next we must determine if truncation was adequate, or whether we
    should round upwards instead. This process is more subtle than it
@@ -1795,59 +1960,59 @@ static const char *DHmsFormat( const char *fmt, int digs, double value, int *sta
    trailing digit 5 appended) and then combine this fractional part
    with the value of all the other fields. Finally, we convert this
    test value back into radians. */
-         test = ( 0.5 + ifract ) / shift;
-         if ( sec ) test = ( isec + test ) / 60.0;
-         if ( min ) {
-            test = ( imin + test ) / 60.0;
-         } else if ( sec ) {
-            test /= 60.0;
-         }
-         if ( dh ) test += idh;
-         test *= ( as_time ? hr2rad : deg2rad );
+      test = ( 0.5 + ifract ) / shift;
+      if ( sec ) test = ( isec + test ) / 60.0;
+      if ( min ) {
+         test = ( imin + test ) / 60.0;
+      } else if ( sec ) {
+         test /= 60.0;
+      }
+      if ( dh ) test += idh;
+      test *= ( as_time ? hr2rad : deg2rad );
 
 /* We now compare the absolute value we are formatting with this test
    value.  If it is not smaller than it, we should have rounded up
    instead of truncating the final digit of the fractional part, so
    increment the integer representation of the truncated fractional
    part by 1.0 to compensate. */
-         if ( absvalue >= test ) ifract += 1.0;
+      if ( absvalue >= test ) ifract += 1.0;
 
 /* Divide by the scale factor to obtain the correctly rounded
    fractional part.  Then check if this fractional part is 1.0. If so,
    rounding has caused it to overflow into the units column of the
    final field, so clear the fractional part. */
-         fract = ( ifract / shift );
-         if ( fract >= 1.0 ) {
-            ifract = 0.0;
+      fract = ( ifract / shift );
+      if ( fract >= 1.0 ) {
+         ifract = 0.0;
 
 /* If a seconds field is present, propagate the overflow up through
    each field in turn, but omitting fields which are not required. Be
    careful about possible rounding errors when comparing integer
    values stored as double. */
-            if ( sec ) {
-               isec += 1.0;
-               if ( ( floor( isec + 0.5 ) > 59.5 ) && min ) {
-                  isec = 0.0;
-                  imin += 1.0;
-                  if ( ( floor( imin + 0.5 ) > 59.5 ) && dh ) {
-                     imin = 0.0;
-                     idh += 1.0;
-                  }
-               }
-
-/* Omit the seconds field if it is not present. */
-            } else if ( min ) {
+         if ( sec ) {
+            isec += 1.0;
+            if ( ( floor( isec + 0.5 ) > 59.5 ) && min ) {
+               isec = 0.0;
                imin += 1.0;
                if ( ( floor( imin + 0.5 ) > 59.5 ) && dh ) {
                   imin = 0.0;
                   idh += 1.0;
                }
+            }
 
-/* If only the degree/hour field is present, simply increment it. */
-            } else {
+/* Omit the seconds field if it is not present. */
+         } else if ( min ) {
+            imin += 1.0;
+            if ( ( floor( imin + 0.5 ) > 59.5 ) && dh ) {
+               imin = 0.0;
                idh += 1.0;
             }
+
+/* If only the degree/hour field is present, simply increment it. */
+         } else {
+            idh += 1.0;
          }
+      }
 
 /* Construct the result string. */
 /* ---------------------------- */
@@ -1857,104 +2022,103 @@ static const char *DHmsFormat( const char *fmt, int digs, double value, int *sta
 
 /* If each field is either not required or equal to zero, disregard
    any sign. */
-         if ( !positive && ( !dh || floor( idh + 0.5 ) < 0.5 ) &&
-                           ( !min || floor( imin + 0.5 ) < 0.5 ) &&
-                           ( !sec || floor( isec + 0.5 ) < 0.5 ) &&
-                           ( floor( ifract + 0.5 ) < 0.5 ) ) {
-            positive = 1;
-         }
+      if ( !positive && ( !dh || floor( idh + 0.5 ) < 0.5 ) &&
+                        ( !min || floor( imin + 0.5 ) < 0.5 ) &&
+                        ( !sec || floor( isec + 0.5 ) < 0.5 ) &&
+                        ( floor( ifract + 0.5 ) < 0.5 ) ) {
+         positive = 1;
+      }
 
 /* Use "pos" to identify where the next character should be
    added. Insert a leading '+' or '-' sign if required. */
-         pos = 0;
-         if ( !positive ) {
-            dhmsformat_buff[ pos++ ] = '-';
-         } else if ( plus ) {
-            dhmsformat_buff[ pos++ ] = '+';
-         }
+      pos = 0;
+      if ( !positive ) {
+         dhmsformat_buff[ pos++ ] = '-';
+      } else if ( plus ) {
+         dhmsformat_buff[ pos++ ] = '+';
+      }
 
 /* Use "sprintf" to format the degrees/hours field, if required. Set
    the minimum field width according to whether padding with leading
    zeros is required and whether the value represents hours (2 digits)
    or degrees (3 digits). */
-         if ( dh ) {
-            pos += sprintf( dhmsformat_buff + pos, "%0*.0f",
-                            lead_zero ? ( as_time ? 2 : 3 ) : 1, idh );
+      if ( dh ) {
+         pos += sprintf( dhmsformat_buff + pos, "%0*.0f",
+                         lead_zero ? ( as_time ? 2 : 3 ) : 1, idh );
 
 /* If letters are being used as field separators, and there are more
    fields to follow, append "d" or "h" as necessary. */
-            if ( min || sec ) {
-               if ( sep == 'l' ) {
-                  dhmsformat_buff[ pos++ ] = ( as_time ? 'h' : 'd' );
-               } else if( sep == 'g' ) {
-                  astTuneC( as_time ? "hrdel":"dgdel", NULL, tbuf,
-                            sizeof( tbuf ) );
-                  term = tbuf;
-                  pos += sprintf( dhmsformat_buff + pos, "%s", term );
-               }
+         if ( min || sec ) {
+            if ( sep == 'l' ) {
+               dhmsformat_buff[ pos++ ] = ( as_time ? 'h' : 'd' );
+            } else if( sep == 'g' ) {
+               astTuneC( as_time ? "hrdel":"dgdel", NULL, tbuf,
+                         sizeof( tbuf ) );
+               term = tbuf;
+               pos += sprintf( dhmsformat_buff + pos, "%s", term );
             }
          }
+      }
 
 /* If a minutes field is required, first add an appropriate non-letter
    field separator if needed. */
-         if ( min ) {
-            if ( ( sep != 'l' && sep != 'g' ) && dh ) dhmsformat_buff[ pos++ ] = sep;
+      if ( min ) {
+         if ( ( sep != 'l' && sep != 'g' ) && dh ) dhmsformat_buff[ pos++ ] = sep;
 
 /* Then format the minutes field with a leading zero to make it two
    digits if necessary. */
-            pos += sprintf( dhmsformat_buff + pos, "%0*.0f", ( dh || lead_zero ) ? 2 : 1,
-                            imin );
+         pos += sprintf( dhmsformat_buff + pos, "%0*.0f", ( dh || lead_zero ) ? 2 : 1,
+                         imin );
 
 /* If letters are being used as field separators, and there is another
    field to follow, append the separator. */
-            if ( sec ) {
-               if ( sep == 'l' ) {
-                  dhmsformat_buff[ pos++ ] = 'm';
-               } else if( sep == 'g' ) {
-                  astTuneC( as_time ? "mndel":"amdel", NULL, tbuf,
-                            sizeof( tbuf ) );
-                  term = tbuf;
-                  pos += sprintf( dhmsformat_buff + pos, "%s", term );
-               }
+         if ( sec ) {
+            if ( sep == 'l' ) {
+               dhmsformat_buff[ pos++ ] = 'm';
+            } else if( sep == 'g' ) {
+               astTuneC( as_time ? "mndel":"amdel", NULL, tbuf,
+                         sizeof( tbuf ) );
+               term = tbuf;
+               pos += sprintf( dhmsformat_buff + pos, "%s", term );
             }
          }
+      }
 
 /* Similarly, if a seconds field is required, first add an appropriate
    non-letter field separator if needed. */
-         if ( sec ) {
-            if ( ( sep != 'l' && sep != 'g' ) && ( dh || min ) ) dhmsformat_buff[ pos++ ] = sep;
+      if ( sec ) {
+         if ( ( sep != 'l' && sep != 'g' ) && ( dh || min ) ) dhmsformat_buff[ pos++ ] = sep;
 
 /* Then format the seconds field with a leading zero to make it two
    digits if necessary. */
-            pos += sprintf( dhmsformat_buff + pos, "%0*.0f",
-                            ( dh || min || lead_zero ) ? 2 : 1, isec );
-         }
+         pos += sprintf( dhmsformat_buff + pos, "%0*.0f",
+                         ( dh || min || lead_zero ) ? 2 : 1, isec );
+      }
 
 /* If decimal places are needed, add a decimal point followed by the
    integer representation of the correctly rounded fractional part,
    padded with leading zeros if necessary. */
-         if ( ndp > 0 ) {
-            dhmsformat_buff[ pos++ ] = '.';
-            pos += sprintf( dhmsformat_buff + pos, "%0*.0f", ndp, ifract );
-         }
+      if ( ndp > 0 ) {
+         dhmsformat_buff[ pos++ ] = '.';
+         pos += sprintf( dhmsformat_buff + pos, "%0*.0f", ndp, ifract );
+      }
 
 /* If letters are being used as separators, append the appropriate one
    to the final field. */
-         if ( sep == 'l' ) {
-            dhmsformat_buff[ pos++ ] = ( sec ? 's' : ( min ? 'm' :
-                                                  ( as_time ? 'h' : 'd' ) ) );
-         } else if ( sep == 'g' ) {
-            astTuneC( as_time ? ( sec ? "scdel" : ( min ? "mndel" : "hrdel" ) ) :
-                      ( sec ? "asdel" : ( min ? "amdel" : "dgdel" ) ),
-                      NULL, tbuf, sizeof( tbuf ) );
-            term = tbuf;
-            pos += sprintf( dhmsformat_buff + pos, "%s", term );
-         }
+      if ( sep == 'l' ) {
+         dhmsformat_buff[ pos++ ] = ( sec ? 's' : ( min ? 'm' :
+                                               ( as_time ? 'h' : 'd' ) ) );
+      } else if ( sep == 'g' ) {
+         astTuneC( as_time ? ( sec ? "scdel" : ( min ? "mndel" : "hrdel" ) ) :
+                   ( sec ? "asdel" : ( min ? "amdel" : "dgdel" ) ),
+                   NULL, tbuf, sizeof( tbuf ) );
+         term = tbuf;
+         pos += sprintf( dhmsformat_buff + pos, "%s", term );
+      }
 
 /* Terminate the result string and return a pointer to it. */
-         dhmsformat_buff[ pos ] = '\0';
-         result = dhmsformat_buff;
-      }
+      dhmsformat_buff[ pos ] = '\0';
+      result = dhmsformat_buff;
    }
 
 /* Return the result. */
@@ -2269,90 +2433,599 @@ static double DHmsGap( const char *fmt, int digs, double gap, int *ntick, int *s
 #undef BUFF_LEN
 }
 
-static const char *DHmsUnit( const char *fmt, int digs, int output, int *status ) {
+static int DHmsUnformat( const char *string, int as_time, int dh, int min,
+                         double *value, int *status ) {
 /*
 *  Name:
-*     DHmsUnit
+*     DHmsUnformat
 
 *  Purpose:
-*     Generate a unit string to describe a formatted angle or time.
+*     Read a formatted degrees/hours, minutes and seconds value.
 
 *  Type:
 *     Private function.
 
 *  Synopsis:
 *     #include "skyaxis.h"
-*     const char *DHmsUnit( const char *fmt, int digs, int output, int *status )
+*     int DHmsUnformat( const char *string, int as_time, int dh, int min,
+*                       double *value, int *status )
 
 *  Class Membership:
 *     SkyAxis member function.
 
 *  Description:
-*     This function generates a string that may be used to describe
-*     either (a) the units of an angle or time that has been formatted
-*     for output using the DHmsFormat function, or (b) a suitable
-*     format to be used for an angle or time that is to be supplied as
-*     an input coordinate value.
+*     This function reads a formatted angle or time (supplied as a
+*     string) and returns the equivalent value in radians. It also
+*     returns the number of characters read from the string. It does
+*     the work for AxisUnformat and AxisUnformatArray, which parse the
+*     SkyAxis Format string first to obtain the default interpretation
+*     of the fields.
 
 *  Parameters:
-*     fmt
-*        Pointer to a null terminated string containing the format
-*        specifier used to format coordinate values. For details of
-*        the syntax of this string, see the DHmsFormat function.
-*     digs
-*        The default number of digits of precision to use. This is used
-*        if the given format specifier indicates the number of decimal
-*        places to use with the string ".*". In this case, the number of
-*        decimal places produced will be chosen so that the total number
-*        of digits of precision is equal to "digs".
-*     output
-*        If non-zero, the returned string will be in a form suitable
-*        for describing the units/format of output produced using
-*        DHmsFormat.
-*
-*        If zero, the returned string will be in a form suitable for
-*        describing a suggested input format, which will subsequently
-*        be read using AxisUnformat.
+*     string
+*        Pointer to a constant null-terminated string containing the
+*        formatted coordinate value.
+*     as_time
+*        The "as_time" value returned by ParseDHmsFormat. Used if the
+*        string does not itself indicate an angle or a time.
+*     dh
+*        The "dh" value returned by ParseDHmsFormat.
+*     min
+*        The "min" value returned by ParseDHmsFormat.
+*     value
+*        Pointer to a double in which the coordinate value read will be
+*        returned (in radians).
 *     status
 *        Pointer to the inherited status variable.
 
 *  Returned Value:
-*     Pointer to a null terminated string containing the unit description.
+*     The number of characters read from the string to obtain the
+*     coordinate value.
 
 *  Notes:
-*     - The result string may be stored in static memory. Its contents
-*     may be over-written or the returned pointer may become invalid
-*     following a further invocation of this function. A copy of the
-*     string should therefore be made if necessary.
-*     - A NULL pointer will be returned if this function is invoked
-*     with the global error status set, or if it should fail for any
-*     reason.
+*     - See AxisUnformat for details of the syntax accepted.
+*     - A function result of zero will be returned and no coordinate
+*     value will be returned via the "value" pointer if this function
+*     is invoked with the global error status set, or if it should
+*     fail for any reason.
 */
 
-/* Local Variables: */
-   astDECLARE_GLOBALS            /* Pointer to thread-specific global data */
-   char dpchar;                  /* Character to indicate decimal places */
-   char sep;                     /* Field separator character */
-   const char *result;           /* Pointer to result string */
-   const int maxdp = 6;          /* Maximum number of decimal places to show */
-   int as_time;                  /* Value formatted as a time? */
-   int dh;                       /* Degrees/hours field required? */
-   int dp;                       /* Loop counter for decimal places */
-   int lead_zero;                /* Add leading zeros? */
-   int min;                      /* Minutes field required? */
-   int ndp;                      /* Number of decimal places */
-   int plus;                     /* Leading plus sign required? */
-   int pos;                      /* Position to add next character */
-   int sec;                      /* Seconds field required? */
-
-/* Initialise. */
-   result = NULL;
-
-/* Check the global error status. */
-   if ( !astOK ) return result;
+/* Local Constants: */
+#define FMT_LEN 50               /* Length of format buffer */
 
-/* Get a pointer to the thread specific global data structure. */
-   astGET_GLOBALS(NULL);
+/* Local Variables: */
+   char fmtbuf[ FMT_LEN + 1 ];   /* Buffer for C format specification */
+   char last_sep;                /* Previous separator character */
+   char sep;                     /* Separator character */
+   char sep_used;                /* Separator character being used */
+   char sign[ 2 ];               /* Sign character as string */
+   const char *field_start[ 3 ]; /* Pointer to start of each field */
+   const char *s;                /* Pointer to current reading position */
+   const char *string_start;     /* Pointer to first significant character */
+   double field[ 3 ];            /* Field values */
+   double testval;               /* Value to test for invalid fields */
+   int angle_or_time;            /* Value known to be angle or time? */
+   int decimal;                  /* Decimal point in field? */
+   int exponent;                 /* Exponent at end of field? */
+   int field_id[ 3 ];            /* Field identification (0 = don't know) */
+   int final;                    /* Final field read? */
+   int good_sep;                 /* Separator character valid? */
+   int i;                        /* Loop counter for characters */
+   int ifield;                   /* Loop counter for fields */
+   int len;                      /* Significant length of string */
+   int m;                        /* Number of characters read by astSscanf */
+   int match;                    /* Character pattern matches? */
+   int n;                        /* Number of characters read by astSscanf */
+   int nc;                       /* Total no. characters read */
+   int nchar;                    /* Number of characters in erroneous value */
+   int next_id;                  /* Next field ID to use (0 = don't know) */
+   int nfield;                   /* Number of fields read */
+   int nread;                    /* No. characters read for current field */
+   int positive;                 /* Value is positive? */
+   int sep_angle_or_time;        /* Separator indicates angle or time? */
+   int sep_field_id;             /* Field ID from separator (0 = don't know) */
+   int sep_index;                /* Index of separator character in table */
+   int sep_len;                  /* Length of separator plus trailing space */
+   int suffix_sep;               /* Field has a suffix separator? */
+
+/* Local Data: */
+   const char *sep_list =        /* List of separator characters recognised */
+              " :hHdDmM'sS\"";
+
+   const int angle_or_time_list[] = /* Whether separator indicates angle or
+                                       time (1 or 2). Zero => don't know. */
+             { 0, 0, 2, 2, 1, 1, 0, 0, 1, 0, 0, 1 };
+
+   const int field_id_list[] =   /* Whether separator identifies previous field
+                                    (1, 2, or 3). Zero => doesn't identify. */
+             { 0, 0, 1, 1, 1, 1, 2, 2, 2, 3, 3, 3 };
+
+   const double fieldvalue[ 3 ] = /* Nominal field values (degrees/hours) */
+                { 1.0, 1.0 / 60.0, 1.0 / 3600.0 };
+
+/* Initialise. */
+   nc = 0;
+
+/* Check the global error status. */
+   if ( !astOK ) return nc;
+
+/* Initialise a pointer into the string and advance it to the first
+   non-white space character. Save a copy of this pointer. */
+   s = string;
+   while ( isspace( (int) *s ) ) s++;
+   string_start = s;
+
+/* Read sign information. */
+/* ---------------------- */
+/* Attempt to read an optional sign character ("+" or "-"), possibly
+   surrounded by white space. Set a flag to indicate if the returned
+   value should be positive or not. Increment the string pointer to
+   the next significant character. */
+positive = 1;
+   n = 0;
+   if ( 1 == astSscanf( s, " %1[+-] %n", sign, &n ) ) {
+      positive = ( *sign == '+' );
+      s += n;
+   }
+
+/* Loop to read field information. */
+/* ------------------------------- */
+/* Initialise, then loop to read the values of up to three fields and
+   to identify the separators that accompany them. */
+   angle_or_time = 0;
+   last_sep = '\0';
+   next_id = 0;
+   nfield = 0;
+   sep_used = '\0';
+   suffix_sep = 0;
+   sep_len = 0;
+   for ( ifield = 0; ifield < 3; ifield++ ) {
+
+/* Set the default field value. */
+      field[ ifield ] = 0.0;
+
+/* If a prefix separator was identified for the second and subsequent
+   fields (when the previous field was being read), then step over the
+   prefix, including any following white space. */
+      if ( ifield && !suffix_sep ) s += sep_len;
+
+/* Note where in the input string the field's numerical value
+   starts. */
+      field_start[ ifield ] = s;
+
+/* Each field must consist of a string of digits, possibly surrounded
+   by white space, except that an optional decimal point may also be
+   present (in which case it indicates the final field). Since we want
+   to exclude signs, etc. from these fields, we must first identify a
+   valid sequence of digits, before attempting to read them as a number.
+   Start by assuming that we will find a decimal point but not an
+   exponent. */
+      decimal = 1;
+      exponent = 0;
+
+/* Match a field and obtain its value. */
+/* ----------------------------------- */
+/* Look for a character sequence like "12.345", or similar, setting a
+   flag to identify a match. */
+      n = 0;
+      match = ( 0 == astSscanf( s, "%*[0123456789].%*[0123456789]%n", &n ) )
+                && n;
+
+/* If that failed, then look for a sequence like "12.", or similar. */
+      if ( !match ) {
+         n = 0;
+         match = ( 0 == astSscanf( s, "%*[0123456789].%n", &n ) ) && n;
+      }
+
+/* If that also failed, then look for a sequence like ".12", or similar. */
+      if ( !match ) {
+         n = 0;
+         match = ( 0 == astSscanf( s, ".%*[0123456789]%n", &n ) ) && n;
+      }
+
+/* If that also failed, then look for a sequence containing digits only. */
+      if ( !match ) {
+         n = 0;
+         match = ( 0 == astSscanf( s, "%*[0123456789]%n", &n ) ) && n;
+
+/* Note we have not found a decimal point. */
+         decimal = 0;
+      }
+
+/* Now look for numbers that end with an exponent. First check that the
+   string starts with a sequence of digits with or without a decimal point. */
+      if( match ) {
+
+/* See if the numbers are followed by an exponent with an explicit sign
+   character. If so, increment the number of characters in the numerical
+   string prefix. */
+         m = 0;
+         if( ( 0 == astSscanf( s + n, "%*1[Ee]%*1[+-]%*[0123456789]%n", &m ) )
+             && m ) {
+            n += m;
+            exponent = 1;
+
+/* If the above check failed, see if the numbers are followed by an exponent
+   without an explicit sign character. If so, increment the number of
+   characters in the numerical string prefix. */
+         } else {
+            m = 0;
+            if( ( 0 == astSscanf( s + n, "%*1[Ee]%*[0123456789]%n", &m ) )
+                && m ) {
+               n += m;
+               exponent = 1;
+            }
+         }
+      }
+
+/* If we identified a suitable sequence of characters above, we will
+   now read them as a number. To prevent any subsequent characters
+   being included as part of this number, the field width must be
+   restricted to the length of the sequence we found. Write a format
+   specification to read a double with this field width, followed by
+   optional white space, and to return the total number of characters
+   read. */
+      nread = 0;
+      if ( match ) {
+         (void) sprintf( fmtbuf, "%%%dlf %%n", n );
+
+/* Use this format specification to read the field value. If
+   successful, increment the string pointer to the next significant
+   character. */
+         if ( 1 == astSscanf( s, fmtbuf, field + ifield, &nread ) ) s += nread;
+      }
+
+/* Note the total number of characters read up to the end of the
+   numerical value in this field (including any following white
+   space). */
+      nc = s - string;
+
+/* Identify the following separator. */
+/* --------------------------------- */
+/* We will now attempt to identify the field separator (if any) which
+   follows the field we have just read. By default, we behave as if
+   the separator is a space. Note we have actually found a space (at
+   least) if extra white space characters were read as part of the
+   field value above. */
+      sep = ' ';
+      good_sep = ( nread > n );
+
+/* Look for one of the recognised separator characters. If one is
+   found, save a copy of it and note we appear (so far) to have a
+   valid separator. */
+      sep_len = 0;
+      if ( *s && strchr( sep_list, *s ) ) {
+         sep = *s;
+         good_sep = 1;
+
+/* Set "sep_len" to the number of characters associated with the
+   separator. This includes any following white space. */
+         while ( isspace( (int) s[ ++sep_len ] ) );
+      }
+
+/* Identify the separator character by looking it up in the separator
+   list (this just uses a space if no valid separator has been
+   found). */
+      sep_index = strchr( sep_list, sep ) - sep_list;
+
+/* Determine if the separator can be used to identify the field which
+   preceded it and if it allows us to determine whether an angle or a
+   time is being read. Both of these properties are specified in data
+   tables (with zero indicating that the separator didn't supply any
+   information). */
+      sep_field_id = field_id_list[ sep_index ];
+      sep_angle_or_time = angle_or_time_list[ sep_index ];
+
+/* Validate the separator. */
+/* ----------------------- */
+/* Now perform further checks that the separator is valid
+   (i.e. conforms to the required syntax). If it appears to identify
+   the previous field (i.e. is a "suffix" separator like "m" or "s"),
+   then it is valid only if its field ID is no less than the ID value
+   that would be used next, based on previous fields (if any), and no
+   less than the current field number. This ensures that fields occur
+   in the correct order without duplication. */
+      if ( good_sep ) {
+         if ( sep_field_id ) {
+            good_sep = ( sep_field_id >= next_id ) &&
+                       ( sep_field_id > ifield );
+
+/* Otherwise (i.e. we appear to have a "prefix" separator like ":" or
+   " "), it is valid if it is the first one used, or if it matches the
+   previous one used. Keep a note of the first such separator used for
+   checking subsequent ones. */
+         } else {
+            good_sep = !sep_used || ( sep == sep_used );
+            if ( !sep_used ) sep_used = sep;
+         }
+      }
+
+/* If the separator seems OK and we don't yet know whether we are reading
+   an angle or a time, then use whatever information the separator
+   provides about this. */
+      if ( good_sep ) {
+         if ( !angle_or_time ) {
+            angle_or_time = sep_angle_or_time;
+
+/* If we already know whether we are reading an angle or a time and
+   the current separator also contains information about this, then
+   check that these sources of information are compatible. This
+   prevents inconsistent use of angle/time field separators. */
+         } else {
+            good_sep = !sep_angle_or_time ||
+                       ( sep_angle_or_time == angle_or_time );
+         }
+      }
+
+/* Update the count of characters read for this field and note if we
+   have identified a valid suffix separator. */
+      if ( good_sep ) nread += sep_len;
+      suffix_sep = good_sep && sep_field_id;
+
+/* Identify which field was read. */
+/* ------------------------------ */
+/* If we have a valid suffix separator, store the field ID. Also make
+   a note of the ID to use for the next field. */
+      if ( suffix_sep ) {
+         field_id[ ifield ] = sep_field_id;
+         next_id = sep_field_id + 1;
+
+/* Step over the separator (plus any following white space) and update
+   the total number of characters read (prefix separators are not
+   accounted for until we start to read the next field). */
+         s += sep_len;
+         nc = s - string;;
+
+/* If the separator does not identify the current field, then assign a
+   field ID based on the previous field (if any). Update the ID to use
+   for the next field, if known. */
+      } else {
+         field_id[ ifield ] = next_id;
+         if ( next_id ) next_id++;
+      }
+
+/* Count fields and exit when done. */
+/* -------------------------------- */
+/* If no characters have been read for the current field, then
+   disregard the field if: (a) it is the first one (i.e. there is
+   nothing to read), or (b) it follows a white space separator
+   (because trailing space does not delimit an extra field). In either
+   case, we have now read all the fields. Otherwise, increment the
+   count of fields read. */
+      final = 0;
+      if ( !nread && ( !ifield || isspace( (int) last_sep ) ) ) {
+         final = 1;
+      } else {
+         nfield++;
+      }
+
+/* We have also read all the fields if: (a) the last one contained a
+   decimal point, or (b) the last one ended with an exponent, or (c)
+   the next character is not a valid field separator, or (d) we have
+   read the seconds field so the next field ID would exceed 3. */
+      final = final || decimal || exponent || !good_sep || ( next_id > 3 );
+
+/* Quit reading if we have read the final field. Otherwise, save the
+   separator character and attempt to read the next field. */
+      if ( final ) break;
+      last_sep = sep;
+   }
+
+/* Complete the identification of fields. */
+/* -------------------------------------- */
+/* Although we have propagated field IDs from earlier ones to later
+   ones in the loop above, we have still not done the reverse. This
+   means there there may still be some leading fields which have not
+   been positively identified (i.e. still have a field ID of zero). In
+   fact, all the fields we have read might still be unidentified at
+   this point. */
+
+/* Calculate the field ID that would apply to the final field we have
+   read in the absence of any other information. This depends on the
+   number of leading fields that are expected to be missing. */
+   next_id = nfield + ( dh ? 0 : ( min ? 1 : 2 ) );
+   if ( next_id > 3 ) next_id = 3;
+
+/* Loop through the fields in reverse order, propagating any positive
+   identifications backwards towards the first field. If no fields
+   have been positively identified, then they are simply numbered
+   consecutively based on the value calculated above. */
+   for ( ifield = nfield - 1; ifield >= 0; ifield-- ) {
+      if ( field_id[ ifield ] ) {
+         next_id = field_id[ ifield ] - 1;
+      } else {
+         field_id[ ifield ] = next_id--;
+      }
+   }
+
+/* Handle inability to read any value. */
+/* ----------------------------------- */
+/* If no fields were read, then check to see if we are trying to read
+   the string "<bad>" (or similar) possibly surrounded by, or
+   containing, white space. If so, return the coordinate value
+   AST__BAD. */
+   if ( !nfield ) {
+      if ( n = 0,
+           ( 0 == astSscanf( string, " < %*1[Bb] %*1[Aa] %*1[Dd] > %n", &n )
+             && n ) ) {
+         *value = AST__BAD;
+         nc = n;
+
+/* If the string still cannot be read, then return a function value of
+   zero. */
+      } else {
+         nc = 0;
+      }
+
+/* Finally determine angle or time. */
+/* -------------------------------- */
+/* If one or more fields have been read, check if we know whether to
+   interpret the value as an angle or a time (if not, we continue to
+   use the default choice obtained from the SkyAxis Format string). */
+   } else {
+      if ( angle_or_time ) as_time = ( angle_or_time == 2 );
+
+/* Validate field values. */
+/* ---------------------- */
+/* If OK, check all fields except the first one for a valid value (we
+   allow the first field to be unconstrained, so that angles and times
+   outside the conventional ranges can be represented). We only need
+   to test for values over 60.0, since negative values can't be
+   read. */
+      if ( astOK ) {
+         for ( ifield = 1; ifield < nfield; ifield++ ) {
+            if ( field[ ifield ] >= 60.0 ) {
+
+/* If a suspect field is found, we must now re-read it. This is
+   because values like "59.9999..." are valid, even if they round up
+   to 60, whereas "60" isn't. To distinguish these cases, we read the
+   digits that occur before the decimal point (if any). Determine how
+   many such digits there are. */
+               n = 0;
+               if ( ( 0 == astSscanf( field_start[ ifield ],
+                                   "%*[0123456789]%n", &n ) ) && n ) {
+
+/* If there are none (this shouldn't happen), the field is
+   valid. Otherwise, construct a format specification to read these
+   digits as a floating point number. */
+                  (void) sprintf( fmtbuf, "%%%dlf", n );
+
+/* Read the digits and compare the result with 60.0. Report an error
+   and quit if necessary, limiting the string length in the error
+   message to include just the significant characters in the value
+   read. */
+                  if ( ( 1 == astSscanf( field_start[ ifield ], fmtbuf,
+                                      &testval ) )
+                       && ( testval >= 60.0 ) ) {
+                     nchar = nc - ( string_start - string );
+                     for ( i = len = 0; i < nchar; i++ ) {
+                        if ( !isspace( (int) string_start[ i ] ) ) {
+                           len = i + 1;
+                        }
+                     }
+                     astError( AST__UNFER, "Invalid %s%s value in sky "
+                               "coordinate \"%.*s\".", status, as_time ? "" : "arc",
+                               ( field_id[ ifield ] == 2 ) ? "minutes" :
+                                                             "seconds",
+                               len, string_start );
+                     break;
+                  }
+               }
+            }
+         }
+      }
+
+/* Calculate final result. */
+/* ----------------------- */
+/* If OK, calculate the result by summing the field values and converting
+   to radians. */
+      if ( astOK ) {
+         *value = 0.0;
+         for ( ifield = 0; ifield < nfield; ifield++ ) {
+            *value += field[ ifield ] *
+                      fieldvalue[ field_id[ ifield ] - 1 ] *
+                      ( as_time ? hr2rad : deg2rad );
+         }
+
+/* Change sign if necessary. */
+         if ( !positive ) *value = - *value;
+      }
+   }
+
+/* If an error occurred, set the number of characters read to zero. */
+   if ( !astOK ) nc = 0;
+
+/* Return the number of characters read. */
+   return nc;
+
+/* Undefine macros local to this function. */
+#undef FMT_LEN
+}
+
+static const char *DHmsUnit( const char *fmt, int digs, int output, int *status ) {
+/*
+*  Name:
+*     DHmsUnit
+
+*  Purpose:
+*     Generate a unit string to describe a formatted angle or time.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "skyaxis.h"
+*     const char *DHmsUnit( const char *fmt, int digs, int output, int *status )
+
+*  Class Membership:
+*     SkyAxis member function.
+
+*  Description:
+*     This function generates a string that may be used to describe
+*     either (a) the units of an angle or time that has been formatted
+*     for output using the DHmsFormat function, or (b) a suitable
+*     format to be used for an angle or time that is to be supplied as
+*     an input coordinate value.
+
+*  Parameters:
+*     fmt
+*        Pointer to a null terminated string containing the format
+*        specifier used to format coordinate values. For details of
+*        the syntax of this string, see the DHmsFormat function.
+*     digs
+*        The default number of digits of precision to use. This is used
+*        if the given format specifier indicates the number of decimal
+*        places to use with the string ".*". In this case, the number of
+*        decimal places produced will be chosen so that the total number
+*        of digits of precision is equal to "digs".
+*     output
+*        If non-zero, the returned string will be in a form suitable
+*        for describing the units/format of output produced using
+*        DHmsFormat.
+*
+*        If zero, the returned string will be in a form suitable for
+*        describing a suggested input format, which will subsequently
+*        be read using AxisUnformat.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     Pointer to a null terminated string containing the unit description.
+
+*  Notes:
+*     - The result string may be stored in static memory. Its contents
+*     may be over-written or the returned pointer may become invalid
+*     following a further invocation of this function. A copy of the
+*     string should therefore be made if necessary.
+*     - A NULL pointer will be returned if this function is invoked
+*     with the global error status set, or if it should fail for any
+*     reason.
+*/
+
+/* Local Variables: */
+   astDECLARE_GLOBALS            /* Pointer to thread-specific global data */
+   char dpchar;                  /* Character to indicate decimal places */
+   char sep;                     /* Field separator character */
+   const char *result;           /* Pointer to result string */
+   const int maxdp = 6;          /* Maximum number of decimal places to show */
+   int as_time;                  /* Value formatted as a time? */
+   int dh;                       /* Degrees/hours field required? */
+   int dp;                       /* Loop counter for decimal places */
+   int lead_zero;                /* Add leading zeros? */
+   int min;                      /* Minutes field required? */
+   int ndp;                      /* Number of decimal places */
+   int plus;                     /* Leading plus sign required? */
+   int pos;                      /* Position to add next character */
+   int sec;                      /* Seconds field required? */
+
+/* Initialise. */
+   result = NULL;
+
+/* Check the global error status. */
+   if ( !astOK ) return result;
+
+/* Get a pointer to the thread specific global data structure. */
+   astGET_GLOBALS(NULL);
 
 /* Parse the format specifier. */
    ParseDHmsFormat( fmt, digs, &sep, &plus, &lead_zero, &as_time, &dh, &min,
@@ -3358,6 +4031,12 @@ void astInitSkyAxisVtab_(  AstSkyAxisVtab *vtab, const char *name, int *status )
    parent_axisunformat = axis->AxisUnformat;
    axis->AxisUnformat = AxisUnformat;
 
+   parent_axisformatarray = axis->AxisFormatArray;
+   axis->AxisFormatArray = AxisFormatArray;
+
+   parent_axisunformatarray = axis->AxisUnformatArray;
+   axis->AxisUnformatArray = AxisUnformatArray;
+
    parent_axisgap = axis->AxisGap;
    axis->AxisGap = AxisGap;
 
@@ -3945,529 +4624,197 @@ static int AxisUnformat( AstAxis *this_axis, const char *string,
 *  Type:
 *     Private function.
 
-*  Synopsis:
-*     #include "skyaxis.h"
-*     int AxisUnformat( AstAxis *axis, const char *string, double *value, int *status )
-
-*  Class Membership:
-*     SkyAxis member function (over-rides the astAxisUnformat method
-*     inherited from the Axis class).
-
-*  Description:
-*     This function reads a formatted coordinate value for a SkyAxis
-*     (supplied as a string) and returns the equivalent numerical
-*     value as a double. It also returns the number of characters read
-*     from the string.
-
-*  Parameters:
-*     this
-*        Pointer to the SkyAxis.
-*     string
-*        Pointer to a constant null-terminated string containing the
-*        formatted coordinate value.
-*     value
-*        Pointer to a double in which the coordinate value read will be
-*        returned (in radians).
-*     status
-*        Pointer to the inherited status variable.
-
-*  Returned Value:
-*     The number of characters read from the string to obtain the
-*     coordinate value.
-
-*  Notes:
-*     - Any white space at the beginning of the string will be
-*     skipped, as also will any trailing white space following the
-*     coordinate value read. The function's return value will reflect
-*     this.
-*     - A function value of zero (and no coordinate value) will be
-*     returned, without error, if the string supplied does not contain
-*     a suitably formatted value.
-*     - The string "<bad>" is recognised as a special case and will
-*     generate the value AST__BAD, without error. The test for this
-*     string is case-insensitive and permits embedded white space.
-*     - A function result of zero will be returned and no coordinate
-*     value will be returned via the "value" pointer if this function
-*     is invoked with the global error status set, or if it should
-*     fail for any reason.
-*-
-*/
-
-/* Local Constants: */
-#define FMT_LEN 50               /* Length of format buffer */
-
-/* Local Variables: */
-   char fmtbuf[ FMT_LEN + 1 ];   /* Buffer for C format specification */
-   char fmtsep;                  /* Format field separator character */
-   char last_sep;                /* Previous separator character */
-   char sep;                     /* Separator character */
-   char sep_used;                /* Separator character being used */
-   char sign[ 2 ];               /* Sign character as string */
-   const char *field_start[ 3 ]; /* Pointer to start of each field */
-   const char *fmt;              /* Pointer to SkyAxis Format string */
-   const char *s;                /* Pointer to current reading position */
-   const char *string_start;     /* Pointer to first significant character */
-   double field[ 3 ];            /* Field values */
-   double testval;               /* Value to test for invalid fields */
-   int angle_or_time;            /* Value known to be angle or time? */
-   int as_time;                  /* Value is a time (else an angle)? */
-   int decimal;                  /* Decimal point in field? */
-   int dh;                       /* Hours field required? */
-   int digs;                     /* Default no. of digits of precision */
-   int exponent;                 /* Exponent at end of field? */
-   int field_id[ 3 ];            /* Field identification (0 = don't know) */
-   int final;                    /* Final field read? */
-   int good_sep;                 /* Separator character valid? */
-   int i;                        /* Loop counter for characters */
-   int ifield;                   /* Loop counter for fields */
-   int lead_zero;                /* Add leading zeros? */
-   int len;                      /* Significant length of string */
-   int m;                        /* Number of characters read by astSscanf */
-   int match;                    /* Character pattern matches? */
-   int min;                      /* Minutes field required? */
-   int n;                        /* Number of characters read by astSscanf */
-   int nc;                       /* Total no. characters read */
-   int nchar;                    /* Number of characters in erroneous value */
-   int ndp;                      /* Number of decimal places */
-   int next_id;                  /* Next field ID to use (0 = don't know) */
-   int nfield;                   /* Number of fields read */
-   int nread;                    /* No. characters read for current field */
-   int plus;                     /* Add leading plus sign? */
-   int positive;                 /* Value is positive? */
-   int sec;                      /* Seconds field required? */
-   int sep_angle_or_time;        /* Separator indicates angle or time? */
-   int sep_field_id;             /* Field ID from separator (0 = don't know) */
-   int sep_index;                /* Index of separator character in table */
-   int sep_len;                  /* Length of separator plus trailing space */
-   int suffix_sep;               /* Field has a suffix separator? */
-
-/* Local Data: */
-   const char *sep_list =        /* List of separator characters recognised */
-              " :hHdDmM'sS\"";
-
-   const int angle_or_time_list[] = /* Whether separator indicates angle or
-                                       time (1 or 2). Zero => don't know. */
-             { 0, 0, 2, 2, 1, 1, 0, 0, 1, 0, 0, 1 };
-
-   const int field_id_list[] =   /* Whether separator identifies previous field
-                                    (1, 2, or 3). Zero => doesn't identify. */
-             { 0, 0, 1, 1, 1, 1, 2, 2, 2, 3, 3, 3 };
-
-   const double fieldvalue[ 3 ] = /* Nominal field values (degrees/hours) */
-                { 1.0, 1.0 / 60.0, 1.0 / 3600.0 };
-
-/* Initialise. */
-   nc = 0;
-
-/* Check the global error status. */
-   if ( !astOK ) return nc;
-
-/* Obtain the SkyAxis Format string. If its starts with a "%" sign, use
-   the parent AxisUnformat method inherited from the Axis class. Use
-   a private method to obtain the Format string, in case the syntax has been
-   over-ridden by a derived class. */
-   fmt = GetAxisFormat( this_axis, status );
-   if( fmt && fmt[0] == '%' ) {
-      nc = (*parent_axisunformat)( this_axis, string, value, status );
-
-/* Otherwise, parse it to determine the default choice of input format. */
-   } else if( astOK ){
-      digs = astGetAxisDigits( this_axis );
-      ParseDHmsFormat( fmt, digs, &fmtsep, &plus, &lead_zero, &as_time, &dh,
-                       &min, &sec, &ndp, status );
-
-/* Initialise a pointer into the string and advance it to the first
-   non-white space character. Save a copy of this pointer. */
-      s = string;
-      while ( isspace( (int) *s ) ) s++;
-      string_start = s;
-
-/* Read sign information. */
-/* ---------------------- */
-/* Attempt to read an optional sign character ("+" or "-"), possibly
-   surrounded by white space. Set a flag to indicate if the returned
-   value should be positive or not. Increment the string pointer to
-   the next significant character. */
-   positive = 1;
-      n = 0;
-      if ( 1 == astSscanf( s, " %1[+-] %n", sign, &n ) ) {
-         positive = ( *sign == '+' );
-         s += n;
-      }
-
-/* Loop to read field information. */
-/* ------------------------------- */
-/* Initialise, then loop to read the values of up to three fields and
-   to identify the separators that accompany them. */
-      angle_or_time = 0;
-      last_sep = '\0';
-      next_id = 0;
-      nfield = 0;
-      sep_used = '\0';
-      suffix_sep = 0;
-      sep_len = 0;
-      for ( ifield = 0; ifield < 3; ifield++ ) {
-
-/* Set the default field value. */
-         field[ ifield ] = 0.0;
-
-/* If a prefix separator was identified for the second and subsequent
-   fields (when the previous field was being read), then step over the
-   prefix, including any following white space. */
-         if ( ifield && !suffix_sep ) s += sep_len;
-
-/* Note where in the input string the field's numerical value
-   starts. */
-         field_start[ ifield ] = s;
-
-/* Each field must consist of a string of digits, possibly surrounded
-   by white space, except that an optional decimal point may also be
-   present (in which case it indicates the final field). Since we want
-   to exclude signs, etc. from these fields, we must first identify a
-   valid sequence of digits, before attempting to read them as a number.
-   Start by assuming that we will find a decimal point but not an
-   exponent. */
-         decimal = 1;
-         exponent = 0;
-
-/* Match a field and obtain its value. */
-/* ----------------------------------- */
-/* Look for a character sequence like "12.345", or similar, setting a
-   flag to identify a match. */
-         n = 0;
-         match = ( 0 == astSscanf( s, "%*[0123456789].%*[0123456789]%n", &n ) )
-                   && n;
-
-/* If that failed, then look for a sequence like "12.", or similar. */
-         if ( !match ) {
-            n = 0;
-            match = ( 0 == astSscanf( s, "%*[0123456789].%n", &n ) ) && n;
-         }
-
-/* If that also failed, then look for a sequence like ".12", or similar. */
-         if ( !match ) {
-            n = 0;
-            match = ( 0 == astSscanf( s, ".%*[0123456789]%n", &n ) ) && n;
-         }
-
-/* If that also failed, then look for a sequence containing digits only. */
-         if ( !match ) {
-            n = 0;
-            match = ( 0 == astSscanf( s, "%*[0123456789]%n", &n ) ) && n;
-
-/* Note we have not found a decimal point. */
-            decimal = 0;
-         }
-
-/* Now look for numbers that end with an exponent. First check that the
-   string starts with a sequence of digits with or without a decimal point. */
-         if( match ) {
-
-/* See if the numbers are followed by an exponent with an explicit sign
-   character. If so, increment the number of characters in the numerical
-   string prefix. */
-            m = 0;
-            if( ( 0 == astSscanf( s + n, "%*1[Ee]%*1[+-]%*[0123456789]%n", &m ) )
-                && m ) {
-               n += m;
-               exponent = 1;
-
-/* If the above check failed, see if the numbers are followed by an exponent
-   without an explicit sign character. If so, increment the number of
-   characters in the numerical string prefix. */
-            } else {
-               m = 0;
-               if( ( 0 == astSscanf( s + n, "%*1[Ee]%*[0123456789]%n", &m ) )
-                   && m ) {
-                  n += m;
-                  exponent = 1;
-               }
-            }
-         }
-
-/* If we identified a suitable sequence of characters above, we will
-   now read them as a number. To prevent any subsequent characters
-   being included as part of this number, the field width must be
-   restricted to the length of the sequence we found. Write a format
-   specification to read a double with this field width, followed by
-   optional white space, and to return the total number of characters
-   read. */
-         nread = 0;
-         if ( match ) {
-            (void) sprintf( fmtbuf, "%%%dlf %%n", n );
-
-/* Use this format specification to read the field value. If
-   successful, increment the string pointer to the next significant
-   character. */
-            if ( 1 == astSscanf( s, fmtbuf, field + ifield, &nread ) ) s += nread;
-         }
-
-/* Note the total number of characters read up to the end of the
-   numerical value in this field (including any following white
-   space). */
-         nc = s - string;
-
-/* Identify the following separator. */
-/* --------------------------------- */
-/* We will now attempt to identify the field separator (if any) which
-   follows the field we have just read. By default, we behave as if
-   the separator is a space. Note we have actually found a space (at
-   least) if extra white space characters were read as part of the
-   field value above. */
-         sep = ' ';
-         good_sep = ( nread > n );
-
-/* Look for one of the recognised separator characters. If one is
-   found, save a copy of it and note we appear (so far) to have a
-   valid separator. */
-         sep_len = 0;
-         if ( *s && strchr( sep_list, *s ) ) {
-            sep = *s;
-            good_sep = 1;
-
-/* Set "sep_len" to the number of characters associated with the
-   separator. This includes any following white space. */
-            while ( isspace( (int) s[ ++sep_len ] ) );
-         }
+*  Synopsis:
+*     #include "skyaxis.h"
+*     int AxisUnformat( AstAxis *axis, const char *string, double *value, int *status )
 
-/* Identify the separator character by looking it up in the separator
-   list (this just uses a space if no valid separator has been
-   found). */
-         sep_index = strchr( sep_list, sep ) - sep_list;
+*  Class Membership:
+*     SkyAxis member function (over-rides the astAxisUnformat method
+*     inherited from the Axis class).
 
-/* Determine if the separator can be used to identify the field which
-   preceded it and if it allows us to determine whether an angle or a
-   time is being read. Both of these properties are specified in data
-   tables (with zero indicating that the separator didn't supply any
-   information). */
-         sep_field_id = field_id_list[ sep_index ];
-         sep_angle_or_time = angle_or_time_list[ sep_index ];
+*  Description:
+*     This function reads a formatted coordinate value for a SkyAxis
+*     (supplied as a string) and returns the equivalent numerical
+*     value as a double. It also returns the number of characters read
+*     from the string.
 
-/* Validate the separator. */
-/* ----------------------- */
-/* Now perform further checks that the separator is valid
-   (i.e. conforms to the required syntax). If it appears to identify
-   the previous field (i.e. is a "suffix" separator like "m" or "s"),
-   then it is valid only if its field ID is no less than the ID value
-   that would be used next, based on previous fields (if any), and no
-   less than the current field number. This ensures that fields occur
-   in the correct order without duplication. */
-         if ( good_sep ) {
-            if ( sep_field_id ) {
-               good_sep = ( sep_field_id >= next_id ) &&
-                          ( sep_field_id > ifield );
+*  Parameters:
+*     this
+*        Pointer to the SkyAxis.
+*     string
+*        Pointer to a constant null-terminated string containing the
+*        formatted coordinate value.
+*     value
+*        Pointer to a double in which the coordinate value read will be
+*        returned (in radians).
+*     status
+*        Pointer to the inherited status variable.
 
-/* Otherwise (i.e. we appear to have a "prefix" separator like ":" or
-   " "), it is valid if it is the first one used, or if it matches the
-   previous one used. Keep a note of the first such separator used for
-   checking subsequent ones. */
-            } else {
-               good_sep = !sep_used || ( sep == sep_used );
-               if ( !sep_used ) sep_used = sep;
-            }
-         }
+*  Returned Value:
+*     The number of characters read from the string to obtain the
+*     coordinate value.
 
-/* If the separator seems OK and we don't yet know whether we are reading
-   an angle or a time, then use whatever information the separator
-   provides about this. */
-         if ( good_sep ) {
-            if ( !angle_or_time ) {
-               angle_or_time = sep_angle_or_time;
+*  Notes:
+*     - Any white space at the beginning of the string will be
+*     skipped, as also will any trailing white space following the
+*     coordinate value read. The function's return value will reflect
+*     this.
+*     - A function value of zero (and no coordinate value) will be
+*     returned, without error, if the string supplied does not contain
+*     a suitably formatted value.
+*     - The string "<bad>" is recognised as a special case and will
+*     generate the value AST__BAD, without error. The test for this
+*     string is case-insensitive and permits embedded white space.
+*     - A function result of zero will be returned and no coordinate
+*     value will be returned via the "value" pointer if this function
+*     is invoked with the global error status set, or if it should
+*     fail for any reason.
+*-
+*/
 
-/* If we already know whether we are reading an angle or a time and
-   the current separator also contains information about this, then
-   check that these sources of information are compatible. This
-   prevents inconsistent use of angle/time field separators. */
-            } else {
-               good_sep = !sep_angle_or_time ||
-                          ( sep_angle_or_time == angle_or_time );
-            }
-         }
+/* Local Variables: */
+   char fmtsep;                  /* Format field separator character */
+   const char *fmt;              /* Pointer to SkyAxis Format string */
+   int as_time;                  /* Value is a time (else an angle)? */
+   int dh;                       /* Hours field required? */
+   int digs;                     /* Default no. of digits of precision */
+   int lead_zero;                /* Add leading zeros? */
+   int min;                      /* Minutes field required? */
+   int nc;                       /* Total no. characters read */
+   int ndp;                      /* Number of decimal places */
+   int plus;                     /* Add leading plus sign? */
+   int sec;                      /* Seconds field required? */
 
-/* Update the count of characters read for this field and note if we
-   have identified a valid suffix separator. */
-         if ( good_sep ) nread += sep_len;
-         suffix_sep = good_sep && sep_field_id;
+/* Initialise. */
+   nc = 0;
 
-/* Identify which field was read. */
-/* ------------------------------ */
-/* If we have a valid suffix separator, store the field ID. Also make
-   a note of the ID to use for the next field. */
-         if ( suffix_sep ) {
-            field_id[ ifield ] = sep_field_id;
-            next_id = sep_field_id + 1;
+/* Check the global error status. */
+   if ( !astOK ) return nc;
 
-/* Step over the separator (plus any following white space) and update
-   the total number of characters read (prefix separators are not
-   accounted for until we start to read the next field). */
-            s += sep_len;
-            nc = s - string;;
+/* Obtain the SkyAxis Format string. If its starts with a "%" sign, use
+   the parent AxisUnformat method inherited from the Axis class. Use
+   a private method to obtain the Format string, in case the syntax has been
+   over-ridden by a derived class. */
+   fmt = GetAxisFormat( this_axis, status );
+   if( fmt && fmt[0] == '%' ) {
+      nc = (*parent_axisunformat)( this_axis, string, value, status );
 
-/* If the separator does not identify the current field, then assign a
-   field ID based on the previous field (if any). Update the ID to use
-   for the next field, if known. */
-         } else {
-            field_id[ ifield ] = next_id;
-            if ( next_id ) next_id++;
-         }
+/* Otherwise, parse it to determine the default choice of input format. */
+   } else if( astOK ){
+      digs = astGetAxisDigits( this_axis );
+      ParseDHmsFormat( fmt, digs, &fmtsep, &plus, &lead_zero, &as_time, &dh,
+                       &min, &sec, &ndp, status );
 
-/* Count fields and exit when done. */
-/* -------------------------------- */
-/* If no characters have been read for the current field, then
-   disregard the field if: (a) it is the first one (i.e. there is
-   nothing to read), or (b) it follows a white space separator
-   (because trailing space does not delimit an extra field). In either
-   case, we have now read all the fields. Otherwise, increment the
-   count of fields read. */
-         final = 0;
-         if ( !nread && ( !ifield || isspace( (int) last_sep ) ) ) {
-            final = 1;
-         } else {
-            nfield++;
-         }
+/* Read the string, using the Format string to resolve any ambiguity. */
+      nc = DHmsUnformat( string, as_time, dh, min, value, status );
+   }
 
-/* We have also read all the fields if: (a) the last one contained a
-   decimal point, or (b) the last one ended with an exponent, or (c)
-   the next character is not a valid field separator, or (d) we have
-   read the seconds field so the next field ID would exceed 3. */
-         final = final || decimal || exponent || !good_sep || ( next_id > 3 );
+/* If an error occurred, set the number of characters read to zero. */
+   if ( !astOK ) nc = 0;
 
-/* Quit reading if we have read the final field. Otherwise, save the
-   separator character and attempt to read the next field. */
-         if ( final ) break;
-         last_sep = sep;
-      }
+/* Return the number of characters read. */
+   return nc;
+}
 
-/* Complete the identification of fields. */
-/* -------------------------------------- */
-/* Although we have propagated field IDs from earlier ones to later
-   ones in the loop above, we have still not done the reverse. This
-   means there there may still be some leading fields which have not
-   been positively identified (i.e. still have a field ID of zero). In
-   fact, all the fields we have read might still be unidentified at
-   this point. */
+static int AxisUnformatArray( AstAxis *this_axis, int npoint,
+                              const char *const strings[], double *value,
+                              int *status ) {
+/*
+*  Name:
+*     AxisUnformatArray
 
-/* Calculate the field ID that would apply to the final field we have
-   read in the absence of any other information. This depends on the
-   number of leading fields that are expected to be missing. */
-      next_id = nfield + ( dh ? 0 : ( min ? 1 : 2 ) );
-      if ( next_id > 3 ) next_id = 3;
+*  Purpose:
+*     Read an array of formatted coordinate values for a SkyAxis.
 
-/* Loop through the fields in reverse order, propagating any positive
-   identifications backwards towards the first field. If no fields
-   have been positively identified, then they are simply numbered
-   consecutively based on the value calculated above. */
-      for ( ifield = nfield - 1; ifield >= 0; ifield-- ) {
-         if ( field_id[ ifield ] ) {
-            next_id = field_id[ ifield ] - 1;
-         } else {
-            field_id[ ifield ] = next_id--;
-         }
-      }
+*  Type:
+*     Private function.
 
-/* Handle inability to read any value. */
-/* ----------------------------------- */
-/* If no fields were read, then check to see if we are trying to read
-   the string "<bad>" (or similar) possibly surrounded by, or
-   containing, white space. If so, return the coordinate value
-   AST__BAD. */
-      if ( !nfield ) {
-         if ( n = 0,
-              ( 0 == astSscanf( string, " < %*1[Bb] %*1[Aa] %*1[Dd] > %n", &n )
-                && n ) ) {
-            *value = AST__BAD;
-            nc = n;
+*  Synopsis:
+*     #include "skyaxis.h"
+*     int AxisUnformatArray( AstAxis *this, int npoint,
+*                            const char *const strings[], double *value,
+*                            int *status )
 
-/* If the string still cannot be read, then return a function value of
-   zero. */
-         } else {
-            nc = 0;
-         }
+*  Class Membership:
+*     SkyAxis member function (over-rides the astAxisUnformatArray method
+*     inherited from the Axis class).
 
-/* Finally determine angle or time. */
-/* -------------------------------- */
-/* If one or more fields have been read, check if we know whether to
-   interpret the value as an angle or a time (if not, we continue to
-   use the default choice obtained from the SkyAxis Format string). */
-      } else {
-         if ( angle_or_time ) as_time = ( angle_or_time == 2 );
+*  Description:
+*     This function reads an array of formatted coordinate values for a
+*     SkyAxis and returns the equivalent values in radians. The Format
+*     string, which determines how ambiguous values are interpreted, is
+*     obtained and parsed only once.
 
-/* Validate field values. */
-/* ---------------------- */
-/* If OK, check all fields except the first one for a valid value (we
-   allow the first field to be unconstrained, so that angles and times
-   outside the conventional ranges can be represented). We only need
-   to test for values over 60.0, since negative values can't be
-   read. */
-         if ( astOK ) {
-            for ( ifield = 1; ifield < nfield; ifield++ ) {
-               if ( field[ ifield ] >= 60.0 ) {
+*  Parameters:
+*     this
+*        Pointer to the SkyAxis.
+*     npoint
+*        The number of strings to be read.
+*     strings
+*        An array of "npoint" pointers to null-terminated strings, each
+*        holding a formatted coordinate value.
+*     value
+*        Pointer to an array in which to return the "npoint" coordinate
+*        values read (in radians).
+*     status
+*        Pointer to the inherited status variable.
 
-/* If a suspect field is found, we must now re-read it. This is
-   because values like "59.9999..." are valid, even if they round up
-   to 60, whereas "60" isn't. To distinguish these cases, we read the
-   digits that occur before the decimal point (if any). Determine how
-   many such digits there are. */
-                  n = 0;
-                  if ( ( 0 == astSscanf( field_start[ ifield ],
-                                      "%*[0123456789]%n", &n ) ) && n ) {
+*  Returned Value:
+*     The number of strings that were read successfully (see
+*     astAxisUnformatArray). AST__BAD is returned in "value" for any
+*     string that was not.
+*/
 
-/* If there are none (this shouldn't happen), the field is
-   valid. Otherwise, construct a format specification to read these
-   digits as a floating point number. */
-                     (void) sprintf( fmtbuf, "%%%dlf", n );
+/* Local Variables: */
+   char fmtsep;                  /* Format field separator character */
+   const char *fmt;              /* Pointer to SkyAxis Format string */
+   int as_time;                  /* Value is a time (else an angle)? */
+   int dh;                       /* Hours field required? */
+   int i;                        /* Index of current string */
+   int lead_zero;                /* Add leading zeros? */
+   int min;                      /* Minutes field required? */
+   int nc;                       /* Number of characters read */
+   int ndp;                      /* Number of decimal places */
+   int plus;                     /* Add leading plus sign? */
+   int result;                   /* Number of strings read */
+   int sec;                      /* Seconds field required? */
 
-/* Read the digits and compare the result with 60.0. Report an error
-   and quit if necessary, limiting the string length in the error
-   message to include just the significant characters in the value
-   read. */
-                     if ( ( 1 == astSscanf( field_start[ ifield ], fmtbuf,
-                                         &testval ) )
-                          && ( testval >= 60.0 ) ) {
-                        nchar = nc - ( string_start - string );
-                        for ( i = len = 0; i < nchar; i++ ) {
-                           if ( !isspace( (int) string_start[ i ] ) ) {
-                              len = i + 1;
-                           }
-                        }
-                        astError( AST__UNFER, "Invalid %s%s value in sky "
-                                  "coordinate \"%.*s\".", status, as_time ? "" : "arc",
-                                  ( field_id[ ifield ] == 2 ) ? "minutes" :
-                                                                "seconds",
-                                  len, string_start );
-                        break;
-                     }
-                  }
-               }
-            }
-         }
+/* Initialise. */
+   result = 0;
 
-/* Calculate final result. */
-/* ----------------------- */
-/* If OK, calculate the result by summing the field values and converting
-   to radians. */
-         if ( astOK ) {
-            *value = 0.0;
-            for ( ifield = 0; ifield < nfield; ifield++ ) {
-               *value += field[ ifield ] *
-                         fieldvalue[ field_id[ ifield ] - 1 ] *
-                         ( as_time ? hr2rad : deg2rad );
-            }
+/* Check the global error status. */
+   if ( !astOK ) return result;
 
-/* Change sign if necessary. */
-            if ( !positive ) *value = - *value;
+/* Obtain the SkyAxis Format string, as in the AxisUnformat function. If
+   it starts with a "%" sign, use the method inherited from the Axis
+   class. */
+   fmt = GetAxisFormat( this_axis, status );
+   if( fmt && fmt[0] == '%' ) {
+      result = (*parent_axisunformatarray)( this_axis, npoint, strings,
+                                            value, status );
+
+/* Otherwise, parse it once to determine the default choice of input
+   format, and then read each string in turn. */
+   } else if( astOK ){
+      ParseDHmsFormat( fmt, astGetAxisDigits( this_axis ), &fmtsep, &plus,
+                       &lead_zero, &as_time, &dh, &min, &sec, &ndp, status );
+
+      for ( i = 0; i < npoint && astOK; i++ ) {
+         nc = DHmsUnformat( strings[ i ], as_time, dh, min, value + i,
+                            status );
+         if ( nc > 0 && nc == (int) strlen( strings[ i ] ) ) {
+            result++;
+         } else {
+            value[ i ] = AST__BAD;
          }
       }
    }
 
-/* If an error occurred, set the number of characters read to zero. */
-   if ( !astOK ) nc = 0;
-
-/* Return the number of characters read. */
-   return nc;
+/* Return zero if an error occurred. */
+   if ( !astOK ) result = 0;
 
-/* Undefine macros local to this function. */
-#undef FMT_LEN
+/* Return the result. */
+   return result;
 }
 
 /* Functions which access class attributes. */
@@ -822,6 +822,7 @@ static int class_check;
 static AstSystemType (* parent_getalignsystem)( AstFrame *, int * );
 static AstSystemType (* parent_getsystem)( AstFrame *, int * );
 static const char *(* parent_format)( AstFrame *, int, double, int * );
+static void (* parent_formatarray)( AstFrame *, int, int, const double *, int, char *, int * );
 static const char *(* parent_getattrib)( AstObject *, const char *, int * );
 static const char *(* parent_getdomain)( AstFrame *, int * );
 static const char *(* parent_getformat)( AstFrame *, int, int * );
@@ -840,6 +841,7 @@ static int (* parent_subframe)( AstFrame *, AstFrame *, int, const int *, const
 static int (* parent_testattrib)( AstObject *, const char *, int * );
 static int (* parent_testformat)( AstFrame *, int, int * );
 static int (* parent_unformat)( AstFrame *, int, const char *, double *, int * );
+static int (* parent_unformatarray)( AstFrame *, int, int, const char *const [], double *, int * );
 static void (* parent_clearattrib)( AstObject *, const char *, int * );
 static void (* parent_cleardtai)( AstFrame *, int * );
 static void (* parent_cleardut1)( AstFrame *, int * );
@@ -965,6 +967,7 @@ static AstSystemType GetSystem( AstFrame *, int * );
 static AstSystemType SystemCode( AstFrame *, const char *, int * );
 static AstSystemType ValidateSystem( AstFrame *, AstSystemType, const char *, int * );
 static const char *Format( AstFrame *, int, double, int * );
+static void FormatArray( AstFrame *, int, int, const double *, int, char *, int * );
 static const char *GetAttrib( AstObject *, const char *, int * );
 static const char *GetDomain( AstFrame *, int * );
 static const char *GetFormat( AstFrame *, int, int * );
@@ -1012,6 +1015,7 @@ static int TestNegLon( AstSkyFrame *, int * );
 static int TestProjection( AstSkyFrame *, int * );
 static int TestSlaUnit( AstSkyFrame *, AstSkyFrame *, AstSlaMap *, int * );
 static int Unformat( AstFrame *, int, const char *, double *, int * );
+static int UnformatArray( AstFrame *, int, int, const char *const [], double *, int * );
 static void ClearAsTime( AstSkyFrame *, int, int * );
 static void ClearAttrib( AstObject *, const char *, int * );
 static void ClearDtai( AstFrame *, int * );
@@ -2083,6 +2087,83 @@ static const char *Format( AstFrame *this_frame, int axis, double value, int *st
    return result;
 }
 
+static void FormatArray( AstFrame *this_frame, int axis, int npoint,
+                         const double *value, int len, char *buf,
+                         int *status ) {
+/*
+*  Name:
+*     FormatArray
+
+*  Purpose:
+*     Format an array of coordinate values for a SkyFrame axis.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "skyframe.h"
+*     void FormatArray( AstFrame *this, int axis, int npoint,
+*                       const double *value, int len, char *buf,
+*                       int *status )
+
+*  Class Membership:
+*     SkyFrame member function (over-rides the astFormatArray method
+*     inherited from the Frame class).
+
+*  Description:
+*     This function formats an array of coordinate values for a SkyFrame
+*     axis, storing the resulting strings in a buffer supplied by the
+*     caller. The formatting applied is the same as for astFormat.
+
+*  Parameters:
+*     this
+*        Pointer to the SkyFrame.
+*     axis
+*        The number of the SkyFrame axis for which formatting is to be
+*        performed (axis numbering starts at zero for the first axis).
+*     npoint
+*        The number of values to be formatted.
+*     value
+*        Pointer to an array of "npoint" coordinate values (in radians).
+*     len
+*        The number of characters reserved in "buf" for each formatted
+*        value, including the terminating null.
+*     buf
+*        Pointer to a buffer of at least "npoint*len" characters. The
+*        formatted version of "value[i]" is returned as a null-terminated
+*        string starting at "buf[i*len]".
+*     status
+*        Pointer to the inherited status variable.
+*/
+
+/* Local Variables: */
+   AstSkyFrame *this;            /* Pointer to the SkyFrame structure */
+   int format_set;               /* Format attribute set? */
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* Obtain a pointer to the SkyFrame structure. */
+   this = (AstSkyFrame *) this_frame;
+
+/* Validate the axis index. */
+   (void) astValidateAxis( this, axis, 1, "astFormatArray" );
+
+/* Set a temporary Format value if none has been set, as in the Format
+   function. */
+   format_set = (*parent_testformat)( this_frame, axis, status );
+   if ( !format_set ) {
+      (*parent_setformat)( this_frame, axis, GetFormat( this_frame, axis, status ), status );
+   }
+
+/* Use the FormatArray member function inherited from the parent class to
+   format the values. */
+   (*parent_formatarray)( this_frame, axis, npoint, value, len, buf, status );
+
+/* If necessary, clear any temporary Format value that was set above. */
+   if ( !format_set ) (*parent_clearformat)( this_frame, axis, status );
+}
+
 static AstPointSet *FrameGrid( AstFrame *this_object, int size, const double *lbnd,
                                const double *ubnd, int *status ){
 /*
@@ -4894,6 +4975,8 @@ void astInitSkyFrameVtab_(  AstSkyFrameVtab *vtab, const char *name, int *status
 
    parent_format = frame->Format;
    frame->Format = Format;
+   parent_formatarray = frame->FormatArray;
+   frame->FormatArray = FormatArray;
    parent_gap = frame->Gap;
    frame->Gap = Gap;
    parent_getdirection = frame->GetDirection;
@@ -4926,6 +5009,8 @@ void astInitSkyFrameVtab_(  AstSkyFrameVtab *vtab, const char *name, int *status
    frame->SubFrame = SubFrame;
    parent_unformat = frame->Unformat;
    frame->Unformat = Unformat;
+   parent_unformatarray = frame->UnformatArray;
+   frame->UnformatArray = UnformatArray;
 
    parent_setdtai = frame->SetDtai;
    frame->SetDtai = SetDtai;
@@ -10655,6 +10740,96 @@ static int Unformat( AstFrame *this_frame, int axis, const char *string,
    return nc;
 }
 
+static int UnformatArray( AstFrame *this_frame, int axis, int npoint,
+                          const char *const strings[], double *value,
+                          int *status ) {
+/*
+*  Name:
+*     UnformatArray
+
+*  Purpose:
+*     Read an array of formatted coordinate values for a SkyFrame axis.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "skyframe.h"
+*     int UnformatArray( AstFrame *this, int axis, int npoint,
+*                        const char *const strings[], double *value,
+*                        int *status )
+
+*  Class Membership:
+*     SkyFrame member function (over-rides the astUnformatArray method
+*     inherited from the Frame class).
+
+*  Description:
+*     This function reads an array of formatted coordinate values for a
+*     SkyFrame axis (supplied as strings) and returns the equivalent
+*     values in radians. Each string is interpreted as by astUnformat.
+
+*  Parameters:
+*     this
+*        Pointer to the SkyFrame.
+*     axis
+*        The number of the SkyFrame axis for which the coordinate values
+*        are to be read (axis numbering starts at zero for the first
+*        axis).
+*     npoint
+*        The number of strings to be read.
+*     strings
+*        An array of "npoint" pointers to null-terminated strings, each
+*        holding a formatted coordinate value.
+*     value
+*        Pointer to an array in which to return the "npoint" coordinate
+*        values read (in radians).
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     The number of strings that were read successfully (see
+*     astUnformatArray).
+*/
+
+/* Local Variables: */
+   AstSkyFrame *this;            /* Pointer to the SkyFrame structure */
+   int format_set;               /* Format attribute set? */
+   int result;                   /* Number of strings read */
+
+/* Initialise. */
+   result = 0;
+
+/* Check the global error status. */
+   if ( !astOK ) return result;
+
+/* Obtain a pointer to the SkyFrame structure. */
+   this = (AstSkyFrame *) this_frame;
+
+/* Validate the axis index. */
+   (void) astValidateAxis( this, axis, 1, "astUnformatArray" );
+
+/* Set a temporary Format value if none has been set, as in the Unformat
+   function. */
+   format_set = (*parent_testformat)( this_frame, axis, status );
+   if ( !format_set ) {
+      (*parent_setformat)( this_frame, axis, GetFormat( this_frame, axis, status ), status );
+   }
+
+/* Use the UnformatArray member function inherited from the parent class
+   to read the coordinate values. */
+   result = (*parent_unformatarray)( this_frame, axis, npoint, strings,
+                                     value, status );
+
+/* If necessary, clear any temporary Format value that was set above. */
+   if ( !format_set ) (*parent_clearformat)( this_frame, axis, status );
+
+/* Return zero if an error occurred. */
+   if ( !astOK ) result = 0;
+
+/* Return the result. */
+   return result;
+}
+
 static int ValidateSystem( AstFrame *this, AstSystemType system, const char *method, int *status ) {
 /*
 *
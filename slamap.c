@@ -266,6 +266,7 @@ static AstPointSet *Transform( AstMapping *, AstPointSet *, int, AstPointSet *,
 static const char *CvtString( int, const char **, int *, const char *[ MAX_SLA_ARGS ], int * );
 static int CvtCode( const char *, int * );
 static int Equal( AstObject *, AstObject *, int * );
+static int ThreadSafe( AstMapping *, int * );
 static int MapMerge( AstMapping *, int, int, int *, AstMapping ***, int **, int * );
 static int SlaIsEmpty( AstSlaMap *, int * );
 static void AddSlaCvt( AstSlaMap *, int, int, const double *, int * );
@@ -2515,6 +2516,7 @@ void astInitSlaMapVtab_(  AstSlaMapVtab *vtab, const char *name, int *status ) {
    new member functions implemented here. */
    object->Equal = Equal;
    mapping->MapMerge = MapMerge;
+   mapping->ThreadSafe = ThreadSafe;
 
 /* Declare the copy constructor, destructor and class dump
    function. */
@@ -3383,6 +3385,10 @@ f     This value should then be supplied to AST_SLAADD in ARGS(1).
 
 /* Add the new conversion to the SlaMap. */
    AddSlaCvt( this, cvttype, narg, args, status );
+
+/* Discard any stored result of simplifying the SlaMap, since it no
+   longer describes the SlaMap. */
+   astResetSimplify( this );
 }
 
 static int SlaIsEmpty( AstSlaMap *this, int *status ){
@@ -3503,6 +3509,62 @@ static void SolarPole( double mjd, double pole[3], int *status ) {
 
 }
 
+static int ThreadSafe( AstMapping *this_mapping, int *status ){
+/*
+*  Name:
+*     ThreadSafe
+
+*  Purpose:
+*     Check if a SlaMap can transform points in several threads at once.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "slamap.h"
+*     int ThreadSafe( AstMapping *this, int *status )
+
+*  Class Membership:
+*     SlaMap member function (over-rides the protected astThreadSafe
+*     method inherited from the Mapping class).
+
+*  Description:
+*     This function returns zero if the SlaMap contains any apparent to
+*     mean place (or mean to apparent place) conversions for which the
+*     required parameter array has not yet been calculated (since these
+*     are calculated and stored in the SlaMap when the conversion is
+*     first used). Otherwise it returns a non-zero value.
+
+*  Parameters:
+*     this
+*        Pointer to the SlaMap.
+*     status
+*        Pointer to the inherited status variable.
+*/
+
+/* Local Variables: */
+   AstSlaMap *this;              /* Pointer to SlaMap structure */
+   int cvt;                      /* Loop counter for conversion steps */
+   int result;                   /* Returned flag */
+
+/* Check the global error status. */
+   if ( !astOK ) return 0;
+
+/* Obtain a pointer to the SlaMap structure. */
+   this = (AstSlaMap *) this_mapping;
+
+/* Check each conversion step. */
+   result = 1;
+   for ( cvt = 0; cvt < this->ncvt && result; cvt++ ) {
+      if ( ( this->cvttype[ cvt ] == AST__SLA_AMP ||
+             this->cvttype[ cvt ] == AST__SLA_MAP ) &&
+           !this->cvtextra[ cvt ] ) result = 0;
+   }
+
+/* Return the result. */
+   return result;
+}
+
 static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
                                int forward, AstPointSet *out, int *status ) {
 /*
@@ -3054,6 +3054,10 @@ f     these arguments should be given, via the ARGS array, in the
 
 /* Add the new conversion to the SpecMap. */
    AddSpecCvt( this, cvttype, narg, args, status );
+
+/* Discard any stored result of simplifying the SpecMap, since it no
+   longer describes the SpecMap. */
+   astResetSimplify( this );
 }
 
 static int SystemChange( int cvt_code, int np, double *values, double *args,
@@ -151,9 +151,7 @@ static void (* parent_setfillfactor)( AstRegion *, double, int * );
 static void (* parent_setmeshsize)( AstRegion *, int, int * );
 static void (* parent_setnegated)( AstRegion *, int, int * );
 
-#if defined(THREAD_SAFE)
 static int (* parent_managelock)( AstObject *, int, int, AstObject **, int * );
-#endif
 
 /* The keys associated with each component of an AstroCoords element
    within KeyMap */
@@ -254,9 +252,7 @@ static int GetNegated( AstRegion *, int * );
 static void SetNegated( AstRegion *, int, int * );
 static int TestNegated( AstRegion *, int * );
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *, int, int, AstObject **, int * );
-#endif
 
 /* Member functions. */
 /* ================= */
@@ -1487,10 +1483,8 @@ void astInitStcVtab_(  AstStcVtab *vtab, const char *name, int *status ) {
    parent_getobjsize = object->GetObjSize;
    object->GetObjSize = GetObjSize;
 
-#if defined(THREAD_SAFE)
    parent_managelock = object->ManageLock;
    object->ManageLock = ManageLock;
-#endif
 
    parent_clearattrib = object->ClearAttrib;
    object->ClearAttrib = ClearAttrib;
@@ -1798,7 +1792,6 @@ static AstKeyMap *MakeAstroCoordsKeyMap( AstRegion *reg, AstKeyMap *coord,
 
 }
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *this_object, int mode, int extra,
                        AstObject **fail, int *status ) {
 /*
@@ -1895,7 +1888,6 @@ static int ManageLock( AstObject *this_object, int mode, int extra,
    return result;
 
 }
-#endif
 
 static int Overlap( AstRegion *this, AstRegion *that, int *status ){
 /*
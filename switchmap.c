@@ -164,9 +164,7 @@ static int class_check;
 static int (* parent_getobjsize)( AstObject *, int * );
 static AstPointSet *(* parent_transform)( AstMapping *, AstPointSet *, int, AstPointSet *, int * );
 
-#if defined(THREAD_SAFE)
 static int (* parent_managelock)( AstObject *, int, int, AstObject **, int * );
-#endif
 
 
 
@@ -209,6 +207,7 @@ static AstMapping *RemoveRegions( AstMapping *, int * );
 static AstPointSet *Transform( AstMapping *, AstPointSet *, int, AstPointSet *, int * );
 static double Rate( AstMapping *, double *, int, int, int * );
 static int Equal( AstObject *, AstObject *, int * );
+static int ThreadSafe( AstMapping *, int * );
 static int GetObjSize( AstObject *, int * );
 static int MapMerge( AstMapping *, int, int, int *, AstMapping ***, int **, int * );
 static void Copy( const AstObject *, AstObject *, int * );
@@ -217,9 +216,7 @@ static void Dump( AstObject *, AstChannel *, int * );
 static AstMapping *GetSelector( AstSwitchMap *, int, int *, int * );
 static AstMapping *GetRoute( AstSwitchMap *, double, int *, int * );
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *, int, int, AstObject **, int * );
-#endif
 
 /* Member functions. */
 /* ================= */
@@ -326,21 +323,35 @@ static int Equal( AstObject *this_object, AstObject *that_object, int *status )
                   if( !astEqual( rmap1, rmap2 ) ) result = 0;
                   astSetInvert( rmap2, rinv2 );
                   astSetInvert( rmap1, rinv1 );
+                  rmap2 = astAnnul( rmap2 );
+                  rmap1 = astAnnul( rmap1 );
                }
             }
 
 /* Reinstate the invert flags for the inverse selector Mappings. Ensure
    this is done in the opposite order to which the selector Mappings were
    obtained (in case they are in fact the same Mapping). */
-            if( ismap2 ) astSetInvert( ismap2, isinv2 );
-            if( ismap1 ) astSetInvert( ismap1, isinv1 );
+            if( ismap2 ) {
+               astSetInvert( ismap2, isinv2 );
+               ismap2 = astAnnul( ismap2 );
+            }
+            if( ismap1 ) {
+               astSetInvert( ismap1, isinv1 );
+               ismap1 = astAnnul( ismap1 );
+            }
          }
 
 /* Reinstate the invert flags for the forward selector Mappings. Ensure
    this is done in the oppsote order to which the selector Mappings were
    obtained (in case they are in fact the same Mapping). */
-         if( fsmap2 ) astSetInvert( fsmap2, fsinv2 );
-         if( fsmap1 ) astSetInvert( fsmap1, fsinv1 );
+         if( fsmap2 ) {
+            astSetInvert( fsmap2, fsinv2 );
+            fsmap2 = astAnnul( fsmap2 );
+         }
+         if( fsmap1 ) {
+            astSetInvert( fsmap1, fsinv1 );
+            fsmap1 = astAnnul( fsmap1 );
+         }
       }
    }
 
@@ -463,8 +474,10 @@ static AstMapping *GetRoute( AstSwitchMap *this, double sel, int *inv, int *stat
 *        Pointer to the inherited status variable.
 
 *  Returns:
-*     A pointer to the route Mapping to use. Note, the returned pointer
-*     should NOT be annulled when no longer needed. NULL is returned
+*     A pointer to the route Mapping to use. The returned pointer should
+*     be annulled when no longer needed (after re-instating its Invert
+*     flag). If the route Mapping has been frozen and its Invert flag
+*     needs to be changed, a copy of it is returned. NULL is returned
 *     (without error) if the SwitchMap does not have a route Mapping for the
 *     requested selector value. The forward transformation of the
 *     returned Mapping will implenment the forward transformation of the
@@ -492,21 +505,21 @@ static AstMapping *GetRoute( AstSwitchMap *this, double sel, int *inv, int *stat
 /* Return the null pointer if the index is out of range. */
       if( rindex >= 0 && rindex < this->nroute ) {
 
-/* Get the required route Mapping. */
-         ret = ( this->routemap )[ rindex ];
+/* Get the required route Mapping. A frozen Mapping may be in use by
+   other threads, so use a copy of it if its Invert flag needs to be
+   changed. */
+         ret = astCopyIfFrozen( ( this->routemap )[ rindex ],
+                                this->routeinv[ rindex ] != astGetInvert( this ) );
 
 /* Return its original invert flag. */
          *inv = astGetInvert( ret );
 
 /* Set the Invert flag back to the value it had when the SwitchMap was
-   created. */
-         astSetInvert( ret, this->routeinv[ rindex ] );
-
-/* If the SwitchMap has since been inverted, also invert the returned
-   route Mapping, so that the forward transformation of the returned
-   Mapping implements the forward transformation of the supplied
+   created. If the SwitchMap has since been inverted, also invert the
+   returned route Mapping, so that the forward transformation of the
+   returned Mapping implements the forward transformation of the supplied
    SwitchMap (and vice-versa). */
-         if( astGetInvert( this ) ) astInvert( ret );
+         astSetInvert( ret, this->routeinv[ rindex ] != astGetInvert( this ) );
       }
    }
 
@@ -554,8 +567,10 @@ static AstMapping *GetSelector( AstSwitchMap *this, int fwd, int *inv, int *stat
 *        Pointer to the inherited status variable.
 
 *  Returns:
-*     A pointer to the selector Mapping to use. Note, the returned pointer
-*     should NOT be annulled when no longer needed. NULL is returned
+*     A pointer to the selector Mapping to use. The returned pointer
+*     should be annulled when no longer needed (after re-instating its
+*     Invert flag). If the selector Mapping has been frozen and its Invert
+*     flag needs to be changed, a copy of it is returned. NULL is returned
 *     (without error) if the SwitchMap does not have a Mapping for the
 *     requested selector.
 
@@ -563,6 +578,7 @@ static AstMapping *GetSelector( AstSwitchMap *this, int fwd, int *inv, int *stat
 
 /* Local Variables: */
    AstMapping *ret;
+   int invert;
    int swinv;
 
 /* Initialise */
@@ -578,20 +594,22 @@ static AstMapping *GetSelector( AstSwitchMap *this, int fwd, int *inv, int *stat
    Mappings should be reversed. */
    if( ( !swinv && !fwd ) || ( swinv && fwd ) ){
       ret = this->ismap;
-      if( ret ) {
-         *inv = astGetInvert( ret );
-         astSetInvert( ret, this->isinv );
-      }
-
+      invert = this->isinv;
    } else {
       ret = this->fsmap;
-      if( ret ) {
-         *inv = astGetInvert( ret );
-         astSetInvert( ret, this->fsinv );
-      }
+      invert = this->fsinv;
    }
 
-   if( ret && swinv ) astInvert( ret );
+/* A frozen Mapping may be in use by other threads, so use a copy of it if
+   its Invert flag needs to be changed. */
+   if( ret ) {
+      ret = astCopyIfFrozen( ret, invert != swinv );
+
+/* Set the Invert flag back to the value it had when the SwitchMap was
+   created, inverting it if the SwitchMap has been inverted. */
+      *inv = astGetInvert( ret );
+      astSetInvert( ret, invert != swinv );
+   }
 
 /* Return the pointer. */
    return ret;
@@ -670,10 +688,8 @@ void astInitSwitchMapVtab_(  AstSwitchMapVtab *vtab, const char *name, int *stat
    parent_getobjsize = object->GetObjSize;
    object->GetObjSize = GetObjSize;
 
-#if defined(THREAD_SAFE)
    parent_managelock = object->ManageLock;
    object->ManageLock = ManageLock;
-#endif
 
    parent_transform = mapping->Transform;
    mapping->Transform = Transform;
@@ -683,6 +699,7 @@ void astInitSwitchMapVtab_(  AstSwitchMapVtab *vtab, const char *name, int *stat
    object->Equal = Equal;
    mapping->MapMerge = MapMerge;
    mapping->Rate = Rate;
+   mapping->ThreadSafe = ThreadSafe;
    mapping->RemoveRegions = RemoveRegions;
 
 /* Declare the copy constructor, destructor and class dump function. */
@@ -699,7 +716,6 @@ void astInitSwitchMapVtab_(  AstSwitchMapVtab *vtab, const char *name, int *stat
    }
 }
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *this_object, int mode, int extra,
                        AstObject **fail, int *status ) {
 /*
@@ -797,7 +813,6 @@ static int ManageLock( AstObject *this_object, int mode, int extra,
    return result;
 
 }
-#endif
 
 static int MapMerge( AstMapping *this, int where, int series, int *nmap,
                      AstMapping ***map_list, int **invert_list, int *status ) {
@@ -1218,10 +1233,12 @@ static double Rate( AstMapping *this, double *at, int ax1, int ax2, int *status
 
 /* Reset the Invert flag for the route Mapping. */
          astSetInvert( rmap, rinv );
+         rmap = astAnnul( rmap );
       }
 
 /* Reset the Invert flag for the selector Mapping. */
       astSetInvert( smap, fsinv );
+      smap = astAnnul( smap );
    }
 
 /* Return the result. */
@@ -1526,6 +1543,7 @@ int astSwitchList_( AstSwitchMap *this, int invert, int *nmap,
          ( *map_list )[ 0 ] = astClone( map );
          ( *invert_list )[ 0 ] = astGetInvert( map );
          astSetInvert( map, inv );
+         map = astAnnul( map );
 
 /* If the SwitchMap does not has a forward selector Mapping, return a
    NULL pointer. */
@@ -1540,6 +1558,7 @@ int astSwitchList_( AstSwitchMap *this, int invert, int *nmap,
          ( *map_list )[ 1 ] = astClone( map );
          ( *invert_list )[ 1 ] = astGetInvert( map );
          astSetInvert( map, inv );
+         map = astAnnul( map );
       } else {
          ( *map_list )[ 1 ] = NULL;
          ( *invert_list )[ 1 ] = 0;
@@ -1559,6 +1578,7 @@ int astSwitchList_( AstSwitchMap *this, int invert, int *nmap,
             ( *map_list )[ i + 2 ] = astClone( map );
             ( *invert_list )[ i + 2 ] = astGetInvert( map );
             astSetInvert( map, inv );
+            map = astAnnul( map );
 
 /* If the SwitchMap does not has a route Mapping for the current selector
    value, return a NULL pointer. */
@@ -1586,6 +1606,39 @@ int astSwitchList_( AstSwitchMap *this, int invert, int *nmap,
    return result;
 }
 
+static int ThreadSafe( AstMapping *this_mapping, int *status ){
+/*
+*  Name:
+*     ThreadSafe
+
+*  Purpose:
+*     Check if a SwitchMap can transform points in several threads at once.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "switchmap.h"
+*     int ThreadSafe( AstMapping *this, int *status )
+
+*  Class Membership:
+*     SwitchMap member function (over-rides the protected astThreadSafe
+*     method inherited from the Mapping class).
+
+*  Description:
+*     This function always returns zero, since the SwitchMap Transform
+*     method temporarily changes the Invert attribute of the selector and
+*     route Mappings.
+
+*  Parameters:
+*     this
+*        Pointer to the SwitchMap.
+*     status
+*        Pointer to the inherited status variable.
+*/
+   return 0;
+}
+
 static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
                                int forward, AstPointSet *out, int *status ) {
 /*
@@ -1659,7 +1712,11 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
    double **sel_ptr;
    double *outv;
    double *sel;
+   int *pind;
+   int *pindices;
    int *popmap;
+   int *rindices;
+   int *start;
    int iroute;
    int ipoint;
    int j;
@@ -1716,30 +1773,54 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
    npoint = astGetNpoint( result );
 
 /* We now count how many positions are to be tranformed by each of the
-   route Mappings. */
+   route Mappings, recording the zero-based route index for each point
+   (-1 for points that are not transformed by any route Mapping). */
    nroute = map->nroute;
    popmap = astMalloc( sizeof( int )*nroute );
+   start = astMalloc( sizeof( int )*nroute );
+   rindices = astMalloc( sizeof( int )*npoint );
+   pindices = astMalloc( sizeof( int )*npoint );
    if( astOK ) {
       for( iroute = 0; iroute < nroute; iroute++ ) popmap[ iroute ] = 0;
 
       sel = sel_ptr[ 0 ];
       for( ipoint = 0; ipoint < npoint; ipoint++,sel++ ) {
+         rindex = -1;
          if( *sel != AST__BAD ) {
             rindex = (int)( *sel + 0.5 ) - 1;
-            if( rindex >= 0 && rindex < nroute ) ( popmap[ rindex ] )++;
+            if( rindex >= 0 && rindex < nroute ) {
+               ( popmap[ rindex ] )++;
+            } else {
+               rindex = -1;
+            }
          }
+         rindices[ ipoint ] = rindex;
       }
 
 /* Find the number of points transformed by the most popular route Mapping.
-   Also find the total number of points transformed by any route Mapping. */
+   Also find the total number of points transformed by any route Mapping,
+   and the offset to the first element of "pindices" used by each route
+   Mapping. */
       totpop = 0;
       maxpop = 0;
       for( iroute = 0; iroute < nroute; iroute++ ) {
          if( popmap[ iroute ] > maxpop ) maxpop = popmap[ iroute ];
+         start[ iroute ] = totpop;
          totpop += popmap[ iroute ];
       }
       if( maxpop == 0 ) maxpop = 1;
 
+/* Sort the point indices into groups, one for each route Mapping, so
+   that the points used by each route Mapping can be found without
+   checking every point again. */
+      for( ipoint = 0; ipoint < npoint; ipoint++ ) {
+         rindex = rindices[ ipoint ];
+         if( rindex >= 0 ) pindices[ ( start[ rindex ] )++ ] = ipoint;
+      }
+      for( iroute = 0; iroute < nroute; iroute++ ) {
+         start[ iroute ] -= popmap[ iroute ];
+      }
+
 /* If some of the points are not transformed by any route Mapping.
    Initialise the whole output array to hold AST__BAD at every point. */
       if( totpop < npoint ) {
@@ -1780,17 +1861,10 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
 
 /* Fill the input PointSet with the input positions which are to be
    transformed using the current route Mapping. */
-               sel = sel_ptr[ 0 ];
-               k = 0;
-               for( ipoint = 0; ipoint < npoint; ipoint++,sel++ ) {
-                  if( *sel != AST__BAD ) {
-                     rindex = (int)( *sel + 0.5 ) - 1;
-                     if( rindex == iroute ) {
-                        for( j = 0; j < ncin; j++ ) {
-                           ptr1[ j ][ k ] = in_ptr[ j ][ ipoint ];
-                        }
-                        k++;
-                     }
+               pind = pindices + start[ iroute ];
+               for( k = 0; k < popmap[ iroute ]; k++ ) {
+                  for( j = 0; j < ncin; j++ ) {
+                     ptr1[ j ][ k ] = in_ptr[ j ][ pind[ k ] ];
                   }
                }
 
@@ -1799,17 +1873,9 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
 
 /* Copy the axis values from the resulting PointSet back into the results
    array. */
-               sel = sel_ptr[ 0 ];
-               k = 0;
-               for( ipoint = 0; ipoint < npoint; ipoint++,sel++ ) {
-                  if( *sel != AST__BAD ) {
-                     rindex = (int)( *sel + 0.5 ) - 1;
-                     if( rindex == iroute ) {
-                        for( j = 0; j < ncout; j++ ) {
-                           out_ptr[ j ][ ipoint ] = ptr2[ j ][ k ];
-                        }
-                        k++;
-                     }
+               for( k = 0; k < popmap[ iroute ]; k++ ) {
+                  for( j = 0; j < ncout; j++ ) {
+                     out_ptr[ j ][ pind[ k ] ] = ptr2[ j ][ k ];
                   }
                }
 
@@ -1819,6 +1885,7 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
 
 /* Re-instate the Invert flag for the route Mapping. */
                astSetInvert( rmap, rinv );
+               rmap = astAnnul( rmap );
             }
          }
       }
@@ -1830,9 +1897,13 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
 
    selps = astAnnul( selps );
    popmap = astFree( popmap );
+   start = astFree( start );
+   rindices = astFree( rindices );
+   pindices = astFree( pindices );
 
 /* Re-instate the Invert flag of the selector Mapping. */
    astSetInvert( selmap, selinv );
+   selmap = astAnnul( selmap );
 
 /* If an error occurred, clean up by deleting the output PointSet (if
    allocated by this function) and setting a NULL result pointer. */
@@ -238,9 +238,7 @@ static void (* parent_mapremove)( AstKeyMap *, const char *, int * );
 static void (* parent_setattrib)( AstObject *, const char *, int * );
 static void (* parent_mapputu)( AstKeyMap *, const char *, const char *, int * );
 
-#if defined(THREAD_SAFE)
 static int (* parent_managelock)( AstObject *, int, int, AstObject **, int * );
-#endif
 
 
 /* Define macros for accessing each item of thread specific global data. */
@@ -362,9 +360,7 @@ static void RemoveRow( AstTable *, int, int * );
 static void SetKeyCase( AstKeyMap *, int, int * );
 static void ClearKeyCase( AstKeyMap *, int * );
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *, int, int, AstObject **, int * );
-#endif
 
 static const char *GetAttrib( AstObject *, const char *, int * );
 static int TestAttrib( AstObject *, const char *, int * );
@@ -2173,10 +2169,8 @@ void astInitTableVtab_(  AstTableVtab *vtab, const char *name, int *status ) {
    parent_testattrib = object->TestAttrib;
    object->TestAttrib = TestAttrib;
 
-#if defined(THREAD_SAFE)
    parent_managelock = object->ManageLock;
    object->ManageLock = ManageLock;
-#endif
 
    parent_mapremove = keymap->MapRemove;
 
@@ -2228,7 +2222,6 @@ void astInitTableVtab_(  AstTableVtab *vtab, const char *name, int *status ) {
    }
 }
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *this_object, int mode, int extra,
                        AstObject **fail, int *status ) {
 /*
@@ -2324,7 +2317,6 @@ static int ManageLock( AstObject *this_object, int mode, int extra,
 /* Return the result. */
    return result;
 }
-#endif
 
 /*
 *  Name:
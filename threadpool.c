@@ -0,0 +1,458 @@
+/*
+*  Name:
+*     threadpool.c
+
+*  Purpose:
+*     Implement a pool of worker threads for executing independent jobs.
+
+*  Description:
+*     This file implements the ThreadPool module which is used for
+*     dividing computationally expensive operations (such as resampling
+*     a large grid of data) into a set of independent jobs, and then
+*     executing these jobs concurrently. For a description of the module
+*     and its interface, see the .h file of the same name.
+*
+*     The worker threads are created when first needed and then wait for
+*     further work, so that the cost of thread creation (and of the
+*     thread-specific global data allocated by AST for each new thread)
+*     is incurred only once. The thread that invokes astRunJobs always
+*     takes part in executing the jobs, so that a pool containing N-1
+*     worker threads provides N threads of execution.
+*
+*     Only one set of jobs can be executed by the pool at any one time.
+*     If astRunJobs is invoked while the pool is busy (for instance, by a
+*     job that is itself being executed by the pool, or by an unrelated
+*     thread), the new set of jobs is executed sequentially by the calling
+*     thread. This avoids deadlocks and over-subscription of the CPUs.
+
+*  Copyright:
+*     Copyright (C) 2026 University of Washington
+
+*  Licence:
+*     This program is free software: you can redistribute it and/or
+*     modify it under the terms of the GNU Lesser General Public
+*     License as published by the Free Software Foundation, either
+*     version 3 of the License, or (at your option) any later
+*     version.
+*
+*     This program is distributed in the hope that it will be useful,
+*     but WITHOUT ANY WARRANTY; without even the implied warranty of
+*     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*     GNU Lesser General Public License for more details.
+*
+*     You should have received a copy of the GNU Lesser General
+*     License along with this program.  If not, see
+*     <http://www.gnu.org/licenses/>.
+*/
+
+/* Configuration results. */
+/* ---------------------- */
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+/* Module Macros. */
+/* ============== */
+/* Define the astCLASS macro (even although this is not a class
+   implementation) to obtain access to the protected error handling
+   functions. */
+#define astCLASS
+
+/* Include files. */
+/* ============== */
+/* Interface definitions. */
+/* ---------------------- */
+#include "error.h"               /* Error reporting facilities */
+#include "memory.h"              /* Memory management facilities */
+#include "threadpool.h"          /* Interface to this module */
+
+/* Error code definitions. */
+/* ----------------------- */
+#include "ast_err.h"             /* AST error codes */
+
+/* C header files. */
+/* --------------- */
+#include <stddef.h>
+
+#ifdef THREAD_SAFE
+#include <pthread.h>
+#endif
+
+/* Module Variables. */
+/* ================= */
+/* The value of the NThread tuning parameter. This is the maximum number
+   of threads (including the calling thread) that may be used to execute
+   a set of jobs. It is shared by all threads. */
+static int nthread = 1;
+
+#ifdef THREAD_SAFE
+
+/* Mutex that serialises access to all the other variables in this
+   module. */
+static pthread_mutex_t pool_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/* Condition variable used to wake worker threads when new jobs become
+   available. */
+static pthread_cond_t work_cond = PTHREAD_COND_INITIALIZER;
+
+/* Condition variable used to tell the thread that invoked astRunJobs
+   that all jobs have been completed. */
+static pthread_cond_t done_cond = PTHREAD_COND_INITIALIZER;
+
+/* The number of worker threads in the pool. */
+static int nworker = 0;
+
+/* The number of worker threads that may take part in executing the
+   current set of jobs. */
+static int nactive_worker = 0;
+
+/* Is the pool currently executing a set of jobs? */
+static int busy = 0;
+
+/* Has a fork handler been registered? */
+static int atfork_registered = 0;
+
+/* Details of the current set of jobs. */
+static AstJobFun *job_fun = NULL;/* Function that performs each job */
+static void *job_data = NULL;    /* Data to pass to the job function */
+static int job_count = 0;        /* Total number of jobs */
+static int job_next = 0;         /* Index of next job to start */
+static int job_running = 0;      /* Number of jobs currently running */
+static int job_status = 0;       /* First error status from a worker */
+
+#endif
+
+/* Prototypes for Private Functions. */
+/* ================================= */
+#ifdef THREAD_SAFE
+static void *Worker( void * );
+static void ResetAfterFork( void );
+#endif
+
+/* Function implementations. */
+/* ========================= */
+int astNThread_( int newval, int *status ){
+/*
+*+
+*  Name:
+*     astNThread
+
+*  Purpose:
+*     Get or set the NThread tuning parameter.
+
+*  Type:
+*     Protected function.
+
+*  Synopsis:
+*     #include "threadpool.h"
+*     int astNThread( int newval )
+
+*  Description:
+*     This function returns the maximum number of threads that may be
+*     used by AST to perform a single computationally expensive
+*     operation, optionally storing a new value. The value is shared by
+*     all threads in the process.
+
+*  Parameters:
+*     newval
+*        The new value for the NThread tuning parameter (see astTune in
+*        object.c). Values less than one are treated as one. If
+*        AST__TUNULL is supplied, the current value is left unchanged.
+
+*  Returned Value:
+*     astNThread()
+*        The original value of the NThread tuning parameter.
+
+*  Notes:
+*     - The value is stored even if AST has been built without thread
+*     support, but in this case it has no effect.
+*     - This function attempts to execute even if the global error
+*     status is set.
+*-
+*/
+
+/* Local Variables: */
+   int result;
+
+#ifdef THREAD_SAFE
+   pthread_mutex_lock( &pool_mutex );
+#endif
+
+   result = nthread;
+   if( newval != AST__TUNULL ) nthread = ( newval > 1 ) ? newval : 1;
+
+#ifdef THREAD_SAFE
+   pthread_mutex_unlock( &pool_mutex );
+#endif
+
+   return result;
+}
+
+void astRunJobs_( int njob, AstJobFun *fun, void *data, int *status ){
+/*
+*+
+*  Name:
+*     astRunJobs
+
+*  Purpose:
+*     Execute a set of independent jobs, possibly concurrently.
+
+*  Type:
+*     Protected function.
+
+*  Synopsis:
+*     #include "threadpool.h"
+*     void astRunJobs( int njob, AstJobFun *fun, void *data )
+
+*  Description:
+*     This function invokes the supplied job function once for each
+*     job index in the range zero to "njob"-1, and returns when all
+*     jobs have completed. If AST has been built with thread support,
+*     and the NThread tuning parameter is larger than one, the jobs may
+*     be executed concurrently by a pool of worker threads, together
+*     with the calling thread. Otherwise, they are executed sequentially
+*     by the calling thread, in order of increasing job index.
+*
+*     The order in which jobs are started or completed is not defined
+*     when they are executed concurrently. Each job should therefore
+*     write its results to a separate area of memory (for instance, a
+*     separate section of an output array, or a separate element of an
+*     array of per-job structures indexed by the job index) so that
+*     the final results do not depend on the order of execution.
+
+*  Parameters:
+*     njob
+*        The number of jobs to execute.
+*     fun
+*        Pointer to the function that executes a single job. It is
+*        invoked with the zero-based job index, the "data" pointer and a
+*        pointer to an inherited status value. The job function should
+*        use the supplied status pointer for all error reporting, since
+*        it may be executing in a thread other than the one that invoked
+*        astRunJobs.
+*     data
+*        A pointer that is passed unchanged to each invocation of "fun".
+*        Any data accessed through this pointer must not be modified by
+*        a job unless it is private to that job.
+
+*  Notes:
+*     - If any job fails, no further jobs are started and an error is
+*     reported by this function (if the failure occurred in a worker
+*     thread) using the status value from the failed job.
+*     - Objects accessed by a job executing in a worker thread will
+*     usually be locked by the thread that invoked this function. The
+*     caller must therefore ensure that the jobs only use Objects in ways
+*     that are safe when performed concurrently (for instance, by
+*     checking astThreadSafe before transforming points with a Mapping).
+*-
+*/
+
+/* Local Variables: */
+   int ijob;                     /* Index of job to execute */
+   int serial;                   /* Execute the jobs sequentially? */
+   int worker_status;            /* Error status from worker threads */
+
+#ifdef THREAD_SAFE
+   pthread_attr_t attr;          /* Attributes for new worker threads */
+   pthread_t thread;             /* Identifier for new worker thread */
+#endif
+
+/* Check the global error status. */
+   if( !astOK || njob < 1 ) return;
+
+/* Assume the jobs will be executed sequentially. */
+   serial = 1;
+   worker_status = 0;
+
+/* If thread support is available, and more than one thread may be
+   used, attempt to use the worker pool. */
+#ifdef THREAD_SAFE
+   pthread_mutex_lock( &pool_mutex );
+   if( !busy && nthread > 1 && njob > 1 ) {
+      busy = 1;
+      serial = 0;
+
+/* Ensure that child processes created by "fork" (which inherit none of
+   the worker threads) do not expect the worker threads to exist. */
+      if( !atfork_registered ) {
+         atfork_registered = !pthread_atfork( NULL, NULL, ResetAfterFork );
+      }
+
+/* Create any extra worker threads that are needed. The calling thread
+   also executes jobs, so we need one fewer worker threads than the
+   number of threads requested. If a new thread cannot be created, just
+   use the threads that already exist. */
+      if( nworker < nthread - 1 && !pthread_attr_init( &attr ) ) {
+         pthread_attr_setdetachstate( &attr, PTHREAD_CREATE_DETACHED );
+         while( nworker < nthread - 1 ) {
+            if( pthread_create( &thread, &attr, Worker,
+                                (void *)(size_t) nworker ) ) break;
+            nworker++;
+         }
+         pthread_attr_destroy( &attr );
+      }
+
+/* Store details of the jobs and wake up the required number of worker
+   threads. */
+      nactive_worker = ( nworker < nthread - 1 ) ? nworker : nthread - 1;
+      job_fun = fun;
+      job_data = data;
+      job_count = njob;
+      job_next = 0;
+      job_running = 0;
+      job_status = 0;
+      pthread_cond_broadcast( &work_cond );
+
+/* The calling thread now executes jobs in the same way as the worker
+   threads, until no jobs remain to be started. The mutex is released
+   while each job is executing. If a job fails, prevent any further
+   jobs from being started. */
+      while( job_next < job_count ) {
+         ijob = job_next++;
+         job_running++;
+         pthread_mutex_unlock( &pool_mutex );
+
+         (*fun)( ijob, data, status );
+
+         pthread_mutex_lock( &pool_mutex );
+         job_running--;
+         if( !astOK ) job_next = job_count;
+      }
+
+/* Wait until all jobs being executed by worker threads have completed. */
+      while( job_running > 0 ) pthread_cond_wait( &done_cond, &pool_mutex );
+
+/* Note the status from any failed worker thread, and leave the pool in
+   an idle state. */
+      worker_status = job_status;
+      job_fun = NULL;
+      job_data = NULL;
+      job_count = 0;
+      job_next = 0;
+      busy = 0;
+   }
+   pthread_mutex_unlock( &pool_mutex );
+#endif
+
+/* If the worker pool is not being used, execute the jobs sequentially
+   in the calling thread. */
+   if( serial ) {
+      for( ijob = 0; ijob < njob && astOK; ijob++ ) {
+         (*fun)( ijob, data, status );
+      }
+
+/* Otherwise, report an error if any job executed by a worker thread
+   failed. The worker thread will already have reported the details. */
+   } else if( worker_status != 0 && astOK ) {
+      astError( worker_status, "astRunJobs: A job being executed by an "
+                "AST worker thread failed.", status );
+   }
+}
+
+#ifdef THREAD_SAFE
+static void ResetAfterFork( void ){
+/*
+*  Name:
+*     ResetAfterFork
+
+*  Purpose:
+*     Reset the pool in a child process created by fork.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     void ResetAfterFork( void )
+
+*  Description:
+*     This function is registered using pthread_atfork and is invoked in
+*     the child process after a fork. The child process contains only the
+*     thread that called fork, so the pool is reset to contain no worker
+*     threads. New worker threads will be created if needed.
+*/
+
+   pthread_mutex_init( &pool_mutex, NULL );
+   pthread_cond_init( &work_cond, NULL );
+   pthread_cond_init( &done_cond, NULL );
+   nworker = 0;
+   nactive_worker = 0;
+   busy = 0;
+   job_fun = NULL;
+   job_data = NULL;
+   job_count = 0;
+   job_next = 0;
+   job_running = 0;
+   job_status = 0;
+}
+
+static void *Worker( void *arg ){
+/*
+*  Name:
+*     Worker
+
+*  Purpose:
+*     The function executed by each worker thread.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     void *Worker( void *arg )
+
+*  Description:
+*     This function waits until jobs become available and then executes
+*     them, one at a time. It never returns.
+
+*  Parameters:
+*     arg
+*        The zero-based index of the worker thread within the pool, cast
+*        to a pointer.
+*/
+
+/* Local Variables: */
+   AstJobFun *fun;               /* Job function */
+   int *status;                  /* Pointer to the inherited status */
+   int ijob;                     /* Index of job to execute */
+   int iworker;                  /* Index of this worker thread */
+   int status_value;             /* Inherited status for this thread */
+   void *data;                   /* Data to pass to job function */
+
+/* Each job is executed with a private status value. */
+   iworker = (int)(size_t) arg;
+   status = &status_value;
+
+   pthread_mutex_lock( &pool_mutex );
+   while( 1 ) {
+
+/* Wait until there is a job that this worker may execute. */
+      while( iworker >= nactive_worker || job_next >= job_count ) {
+         pthread_cond_wait( &work_cond, &pool_mutex );
+      }
+
+/* Claim the next job, and release the mutex while it executes. */
+      ijob = job_next++;
+      job_running++;
+      fun = job_fun;
+      data = job_data;
+      pthread_mutex_unlock( &pool_mutex );
+
+      status_value = 0;
+      (*fun)( ijob, data, status );
+
+/* If the job failed, record the status and prevent any further jobs
+   from being started. Tell the invoking thread when the last running
+   job has completed. */
+      pthread_mutex_lock( &pool_mutex );
+      job_running--;
+      if( !astOK ) {
+         if( job_status == 0 ) job_status = status_value;
+         job_next = job_count;
+      }
+      if( job_running == 0 && job_next >= job_count ) {
+         pthread_cond_signal( &done_cond );
+      }
+   }
+
+   return NULL;
+}
+#endif
@@ -0,0 +1,90 @@
+#if !defined( THREADPOOL_INCLUDED )  /* Include this file only once */
+#define THREADPOOL_INCLUDED
+/*
+*+
+*  Name:
+*     threadpool.h
+
+*  Purpose:
+*     Define the interface to the ThreadPool module.
+
+*  Description:
+*     This module defines functions which allow a set of independent
+*     jobs to be executed concurrently by a pool of worker threads. The
+*     pool is created when first needed and is then retained for re-use
+*     by later calls. The maximum number of threads used is controlled
+*     by the "NThread" tuning parameter (see astTune).
+*
+*     If AST is built without thread support (i.e. if THREAD_SAFE is not
+*     defined), the jobs are always executed sequentially by the calling
+*     thread.
+*
+*     Note that this module is not a class implementation, although it
+*     resembles one.
+
+*  Functions Defined:
+*     Public:
+*        None.
+*
+*     Protected:
+*        astNThread
+*           Get or set the NThread tuning parameter.
+*        astRunJobs
+*           Execute a set of independent jobs, possibly concurrently.
+
+*  Copyright:
+*     Copyright (C) 2026 University of Washington
+
+*  Licence:
+*     This program is free software: you can redistribute it and/or
+*     modify it under the terms of the GNU Lesser General Public
+*     License as published by the Free Software Foundation, either
+*     version 3 of the License, or (at your option) any later
+*     version.
+*
+*     This program is distributed in the hope that it will be useful,
+*     but WITHOUT ANY WARRANTY; without even the implied warranty of
+*     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*     GNU Lesser General Public License for more details.
+*
+*     You should have received a copy of the GNU Lesser General
+*     License along with this program.  If not, see
+*     <http://www.gnu.org/licenses/>.
+
+*-
+*/
+
+/* Include files. */
+/* ============== */
+#include "error.h"
+
+/* Macros. */
+/* ======= */
+#if defined(astCLASS) || defined(astFORTRAN77)
+#define STATUS_PTR status
+#else
+#define STATUS_PTR astGetStatusPtr
+#endif
+
+#if defined(astCLASS)            /* Protected */
+
+/* Type definitions */
+/* ================ */
+/* The type of function that performs a single job. It is given the
+   zero-based index of the job, the generic pointer supplied to astRunJobs,
+   and a pointer to the inherited status value for the thread executing
+   the job. */
+typedef void (AstJobFun)( int, void *, int * );
+
+/* Function prototypes. */
+/* ==================== */
+int astNThread_( int, int * );
+void astRunJobs_( int, AstJobFun *, void *, int * );
+
+/* Function interfaces. */
+/* ==================== */
+#define astNThread(newval) astERROR_INVOKE(astNThread_(newval,STATUS_PTR))
+#define astRunJobs(njob,fun,data) astERROR_INVOKE(astRunJobs_(njob,fun,data,STATUS_PTR))
+
+#endif
+#endif
@@ -288,6 +288,7 @@ static double (* parent_centre)( AstFrame *, int, double, double, int * );
 static double (* parent_gap)( AstFrame *, int, double, int *, int * );
 static const char *(* parent_abbrev)( AstFrame *, int, const char *, const char *, const char *, int * );
 static const char *(* parent_format)( AstFrame *, int, double, int * );
+static void (* parent_formatarray)( AstFrame *, int, int, const double *, int, char *, int * );
 static const char *(* parent_getattrib)( AstObject *, const char *, int * );
 static const char *(* parent_getdomain)( AstFrame *, int * );
 static const char *(* parent_getlabel)( AstFrame *, int, int * );
@@ -373,6 +374,7 @@ static AstSystemType ValidateSystem( AstFrame *, AstSystemType, const char *, in
 static AstTimeScaleType TimeScaleCode( const char *, int * );
 static const char *DefUnit( AstSystemType, const char *, const char *, int * );
 static const char *Format( AstFrame *, int, double, int * );
+static void FormatArray( AstFrame *, int, int, const double *, int, char *, int * );
 static const char *GetDomain( AstFrame *, int * );
 static const char *GetLabel( AstFrame *, int, int * );
 static const char *GetSymbol( AstFrame *, int, int * );
@@ -402,6 +404,7 @@ static void SetUnit( AstFrame *, int, const char *, int * );
 static void VerifyAttrs( AstTimeFrame *, const char *, const char *, const char *, int * );
 static AstMapping *ToMJDMap( AstSystemType, double, int * );
 static int Unformat( AstFrame *, int, const char *, double *, int * );
+static int UnformatArray( AstFrame *, int, int, const char *const [], double *, int * );
 static const char *Abbrev( AstFrame *, int, const char *, const char *, const char *, int * );
 static double Centre( AstFrame *, int, double, double, int * );
 static double Gap( AstFrame *, int, double, int *, int * );
@@ -1745,6 +1748,92 @@ static const char *Format( AstFrame *this_frame, int axis, double value, int *st
    return result;
 }
 
+static void FormatArray( AstFrame *this_frame, int axis, int npoint,
+                         const double *value, int len, char *buf,
+                         int *status ) {
+/*
+*  Name:
+*     FormatArray
+
+*  Purpose:
+*     Format an array of coordinate values for a TimeFrame axis.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "timeframe.h"
+*     void FormatArray( AstFrame *this, int axis, int npoint,
+*                       const double *value, int len, char *buf,
+*                       int *status )
+
+*  Class Membership:
+*     TimeFrame member function (over-rides the astFormatArray method
+*     inherited from the Frame class).
+
+*  Description:
+*     This function formats an array of coordinate values for a
+*     TimeFrame axis, storing the resulting strings in a buffer supplied
+*     by the caller. The formatting applied is the same as for astFormat.
+
+*  Parameters:
+*     this
+*        Pointer to the TimeFrame.
+*     axis
+*        The number of the TimeFrame axis for which formatting is to be
+*        performed (axis numbering starts at zero for the first axis).
+*     npoint
+*        The number of values to be formatted.
+*     value
+*        Pointer to an array of "npoint" coordinate values.
+*     len
+*        The number of characters reserved in "buf" for each formatted
+*        value, including the terminating null.
+*     buf
+*        Pointer to a buffer of at least "npoint*len" characters. The
+*        formatted version of "value[i]" is returned as a null-terminated
+*        string starting at "buf[i*len]".
+*     status
+*        Pointer to the inherited status variable.
+*/
+
+/* Local Variables: */
+   AstTimeFrame *this;
+   const char *text;
+   int i;
+   int nc;
+   int ndp;
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* Obtain a pointer to the TimeFrame structure. */
+   this = (AstTimeFrame *) this_frame;
+
+/* Validate the axis index. */
+   (void) astValidateAxis( this, axis, 1, "astFormatArray" );
+
+/* If the format string does not indicate a date/time format, invoke the
+   parent FormatArray method. */
+   if( !DateFormat( astGetFormat( this, 0 ), &ndp, NULL, status ) ) {
+      (*parent_formatarray)( this_frame, axis, npoint, value, len, buf,
+                             status );
+
+/* Otherwise, format each value as a date/time using the astFormat method,
+   copying the result into the caller's buffer. */
+   } else {
+      for( i = 0; i < npoint && astOK; i++ ) {
+         text = astFormat( this, axis, value[ i ] );
+         if( text ) {
+            nc = strlen( text );
+            if( nc >= len ) nc = len - 1;
+            memcpy( buf + i*len, text, (size_t) nc );
+            buf[ i*len + nc ] = '\0';
+         }
+      }
+   }
+}
+
 static double FromMJD( AstTimeFrame *this, double oldval, int *status ){
 /*
 *
@@ -3468,9 +3557,14 @@ void astInitTimeFrameVtab_(  AstTimeFrameVtab *vtab, const char *name, int *stat
    parent_format = frame->Format;
    frame->Format = Format;
 
+   parent_formatarray = frame->FormatArray;
+   frame->FormatArray = FormatArray;
+
    parent_unformat = frame->Unformat;
    frame->Unformat = Unformat;
 
+   frame->UnformatArray = UnformatArray;
+
    parent_abbrev = frame->Abbrev;
    frame->Abbrev = Abbrev;
 
@@ -6262,6 +6356,89 @@ static int Unformat( AstFrame *this_frame, int axis, const char *string,
    return nc;
 }
 
+static int UnformatArray( AstFrame *this_frame, int axis, int npoint,
+                          const char *const strings[], double *value,
+                          int *status ) {
+/*
+*  Name:
+*     UnformatArray
+
+*  Purpose:
+*     Read an array of formatted coordinate values for a TimeFrame axis.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "timeframe.h"
+*     int UnformatArray( AstFrame *this, int axis, int npoint,
+*                        const char *const strings[], double *value,
+*                        int *status )
+
+*  Class Membership:
+*     TimeFrame member function (over-rides the astUnformatArray method
+*     inherited from the Frame class).
+
+*  Description:
+*     This function reads an array of formatted coordinate values for a
+*     TimeFrame axis. Since each string may hold either a date/time or a
+*     plain number, each one is read using the astUnformat method.
+
+*  Parameters:
+*     this
+*        Pointer to the TimeFrame.
+*     axis
+*        The number of the TimeFrame axis for which the coordinate values
+*        are to be read (axis numbering starts at zero for the first
+*        axis).
+*     npoint
+*        The number of strings to be read.
+*     strings
+*        An array of "npoint" pointers to null-terminated strings, each
+*        holding a formatted coordinate value.
+*     value
+*        Pointer to an array in which to return the "npoint" coordinate
+*        values read.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     The number of strings that were read successfully (see
+*     astUnformatArray).
+*/
+
+/* Local Variables: */
+   int i;
+   int nc;
+   int result;
+
+/* Initialise. */
+   result = 0;
+
+/* Check the global error status. */
+   if ( !astOK ) return result;
+
+/* Validate the axis index. */
+   (void) astValidateAxis( this_frame, axis, 1, "astUnformatArray" );
+
+/* Read each string in turn, storing a bad value if the whole string was
+   not used. */
+   for( i = 0; i < npoint && astOK; i++ ) {
+      nc = astUnformat( this_frame, axis, strings[ i ], value + i );
+      if( nc > 0 && nc == (int) strlen( strings[ i ] ) ) {
+         result++;
+      } else {
+         value[ i ] = AST__BAD;
+      }
+   }
+
+/* Return zero if an error occurred. */
+   if ( !astOK ) result = 0;
+
+/* Return the result. */
+   return result;
+}
+
 static int ValidateSystem( AstFrame *this, AstSystemType system, const char *method, int *status ) {
 /*
 *
@@ -3779,6 +3779,10 @@ f     AST_TRANSFORM
 
 /* Add the new conversion to the TimeMap. */
    AddTimeCvt( this, cvttype, narg, args, status );
+
+/* Discard any stored result of simplifying the TimeMap, since it no
+   longer describes the TimeMap. */
+   astResetSimplify( this );
 }
 
 static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
@@ -121,9 +121,7 @@ static int (* parent_getobjsize)( AstObject *, int * );
 static AstPointSet *(* parent_transform)( AstMapping *, AstPointSet *, int, AstPointSet *, int * );
 static int *(* parent_mapsplit)( AstMapping *, int, const int *, AstMapping **, int * );
 
-#if defined(THREAD_SAFE)
 static int (* parent_managelock)( AstObject *, int, int, AstObject **, int * );
-#endif
 
 
 
@@ -167,6 +165,7 @@ static AstPointSet *Transform( AstMapping *, AstPointSet *, int, AstPointSet *,
 static double Rate( AstMapping *, double *, int, int, int * );
 static int *MapSplit( AstMapping *, int, const int *, AstMapping **, int * );
 static int Equal( AstObject *, AstObject *, int * );
+static int ThreadSafe( AstMapping *, int * );
 static int MapMerge( AstMapping *, int, int, int *, AstMapping ***, int **, int * );
 static void Copy( const AstObject *, AstObject *, int * );
 static void Delete( AstObject *, int * );
@@ -174,9 +173,7 @@ static void Dump( AstObject *, AstChannel *, int * );
 static void Decompose( AstMapping *, AstMapping **, AstMapping **, int *, int *, int *, int * );
 static int GetObjSize( AstObject *, int * );
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *, int, int, AstObject **, int * );
-#endif
 
 
 /* Member functions. */
@@ -241,6 +238,22 @@ static int Equal( AstObject *this_object, AstObject *that_object, int *status )
    this = (AstTranMap *) this_object;
    that = (AstTranMap *) that_object;
 
+/* The Invert flags of the component Mappings are changed temporarily
+   below. A frozen Mapping may be in use by other threads, so compare
+   copies of the TranMaps if any of their component Mappings are
+   frozen. */
+   if( astIsATranMap( that ) && ( astGetFrozen( this->map1 ) ||
+                                  astGetFrozen( this->map2 ) ||
+                                  astGetFrozen( that->map1 ) ||
+                                  astGetFrozen( that->map2 ) ) ) {
+      this = astCopy( this );
+      that = astCopy( that );
+      result = astEqual( this, that );
+      this = astAnnul( this );
+      that = astAnnul( that );
+      return result;
+   }
+
 /* Check the second object is a TranMap. We know the first is a
    TranMap since we have arrived at this implementation of the virtual
    function. */
@@ -526,10 +539,8 @@ void astInitTranMapVtab_(  AstTranMapVtab *vtab, const char *name, int *status )
 
    mapping->RemoveRegions = RemoveRegions;
 
-#if defined(THREAD_SAFE)
    parent_managelock = object->ManageLock;
    object->ManageLock = ManageLock;
-#endif
 
    parent_transform = mapping->Transform;
    mapping->Transform = Transform;
@@ -543,6 +554,7 @@ void astInitTranMapVtab_(  AstTranMapVtab *vtab, const char *name, int *status )
    mapping->Decompose = Decompose;
    mapping->MapMerge = MapMerge;
    mapping->Rate = Rate;
+   mapping->ThreadSafe = ThreadSafe;
 
 /* Declare the copy constructor, destructor and class dump function. */
    astSetCopy( vtab, Copy );
@@ -558,7 +570,6 @@ void astInitTranMapVtab_(  AstTranMapVtab *vtab, const char *name, int *status )
    }
 }
 
-#if defined(THREAD_SAFE)
 static int ManageLock( AstObject *this_object, int mode, int extra,
                        AstObject **fail, int *status ) {
 /*
@@ -651,7 +662,6 @@ static int ManageLock( AstObject *this_object, int mode, int extra,
    return result;
 
 }
-#endif
 
 static int MapMerge( AstMapping *this, int where, int series, int *nmap,
                      AstMapping ***map_list, int **invert_list, int *status ) {
@@ -1110,6 +1120,16 @@ static int *MapSplit( AstMapping *this_map, int nin, const int *in, AstMapping *
 /* Get a pointer to the TranMap structure. */
       this = (AstTranMap *) this_map;
 
+/* The Invert flags of the component Mappings are changed temporarily
+   below. A frozen Mapping may be in use by other threads, so split a copy
+   of the TranMap if either component Mapping is frozen. */
+      if( astGetFrozen( this->map1 ) || astGetFrozen( this->map2 ) ) {
+         this = astCopy( this );
+         result = MapSplit( (AstMapping *) this, nin, in, map, status );
+         this = astAnnul( this );
+         return result;
+      }
+
 /* Get pointers to the forward and inverse Mappings, taking into account
    whether the TranMap has been inverted. */
       if( !astGetInvert( this ) ) {
@@ -1263,7 +1283,9 @@ static double Rate( AstMapping *this, double *at, int ax1, int ax2, int *status
    }
 
 /* Temporarily set the Invert flag of the component Mapping back to its
-   original value. */
+   original value. A frozen Mapping may be in use by other threads, so use
+   a copy of it if its Invert flag needs to be changed. */
+   cmap = astCopyIfFrozen( cmap, cinv );
    old_inv = astGetInvert( cmap );
    astSetInvert( cmap, cinv );
 
@@ -1272,6 +1294,7 @@ static double Rate( AstMapping *this, double *at, int ax1, int ax2, int *status
 
 /* Re-instate the Invert flag of the component Mapping. */
    astSetInvert( cmap, old_inv );
+   cmap = astAnnul( cmap );
 
 /* Return the result. */
    return result;
@@ -1406,6 +1429,40 @@ static AstMapping *RemoveRegions( AstMapping *this_mapping, int *status ) {
    return result;
 }
 
+static int ThreadSafe( AstMapping *this_mapping, int *status ){
+/*
+*  Name:
+*     ThreadSafe
+
+*  Purpose:
+*     Check if a TranMap can transform points in several threads at once.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "tranmap.h"
+*     int ThreadSafe( AstMapping *this, int *status )
+
+*  Class Membership:
+*     TranMap member function (over-rides the protected astThreadSafe
+*     method inherited from the Mapping class).
+
+*  Description:
+*     This function returns a non-zero value if both component Mappings
+*     can safely be used by several threads at once.
+
+*  Parameters:
+*     this
+*        Pointer to the TranMap.
+*     status
+*        Pointer to the inherited status variable.
+*/
+   AstTranMap *this;
+   this = (AstTranMap *) this_mapping;
+   return astThreadSafe( this->map1 ) && astThreadSafe( this->map2 );
+}
+
 static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
                                int forward, AstPointSet *out, int *status ) {
 /*
@@ -1467,7 +1524,6 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
    AstPointSet *result;          /* Pointer to output PointSet */
    AstTranMap *map;              /* Pointer to TranMap to be applied */
    int cinv;                     /* Invert flag when TranMap was created */
-   int old_inv;                  /* Invert flag on entry to this function */
 
 /* Check the global error status. */
    if ( !astOK ) return NULL;
@@ -1497,17 +1553,16 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
       cinv = map->invert2;
    }
 
-/* Temporarily set the Invert flag of the component Mapping back to its
-   original value. */
-   old_inv = astGetInvert( cmap );
-   astSetInvert( cmap, cinv );
+/* If the Invert flag of the component Mapping has changed since the
+   TranMap was created, use the opposite transformation of the component
+   Mapping. This is equivalent to temporarily re-instating the original
+   Invert flag, but does not modify the component Mapping (so that the
+   TranMap can be used by several threads at once). */
+   if( astGetInvert( cmap ) != cinv ) forward = !forward;
 
 /* Use the Transform method of the component Mapping. */
    result = astTransform( cmap, in, forward, out );
 
-/* Re-instate the Invert flag of the component Mapping. */
-   astSetInvert( cmap, old_inv );
-
 /* If an error occurred, clean up by deleting the output PointSet (if
    allocated by this function) and setting a NULL result pointer. */
    if ( !astOK ) {
@@ -148,6 +148,7 @@ AstUnitMap *astUnitMapId_( int, const char *, ... );
 /* Prototypes for Private Member Functions. */
 /* ======================================== */
 static AstPointSet *Transform( AstMapping *, AstPointSet *, int, AstPointSet *, int * );
+static void JacobianPoints( AstMapping *, AstPointSet *, int, AstPointSet *, int * );
 static double Rate( AstMapping *, double *, int, int, int * );
 static int *MapSplit( AstMapping *, int, const int *, AstMapping **, int * );
 static int Equal( AstObject *, AstObject *, int * );
@@ -339,6 +340,7 @@ void astInitUnitMapVtab_(  AstUnitMapVtab *vtab, const char *name, int *status )
    mapping->MapMerge = MapMerge;
    mapping->MapSplit = MapSplit;
    mapping->Rate = Rate;
+   mapping->JacobianPoints = JacobianPoints;
    mapping->GetIsLinear = GetIsLinear;
 
 /* Declare the class dump function. There is no copy constructor or
@@ -747,6 +749,65 @@ static int *MapSplit( AstMapping *this_map, int nin, const int *in, AstMapping *
    return result;
 }
 
+static void JacobianPoints( AstMapping *this, AstPointSet *in, int forward,
+                            AstPointSet *jac, int *status ) {
+/*
+*  Name:
+*     JacobianPoints
+
+*  Purpose:
+*     Find the Jacobian matrix of a Mapping at a set of points.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "unitmap.h"
+*     void JacobianPoints( AstMapping *this, AstPointSet *in, int forward,
+*                          AstPointSet *jac, int *status )
+
+*  Class Membership:
+*     UnitMap member function (over-rides the astJacobianPoints protected
+*     method inherited from the Mapping class).
+
+*  Description:
+*     This function stores the Jacobian matrix of a UnitMap (a unit
+*     matrix) at each of the points in a PointSet.
+
+*  Parameters:
+*     this
+*        Pointer to the UnitMap.
+*     in
+*        Pointer to the PointSet holding the positions at which the
+*        Jacobian is required.
+*     forward
+*        A non-zero value indicates that the Jacobian of the forward
+*        coordinate transformation is required, while a zero value
+*        requests the Jacobian of the inverse transformation.
+*     jac
+*        Pointer to the PointSet in which to store the Jacobian.
+*     status
+*        Pointer to the inherited status variable.
+*/
+
+/* Local Variables: */
+   double *matrix;               /* Jacobian matrix */
+   int coord;                    /* Coordinate index */
+   int nin;                      /* Number of input coordinates */
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* Form a unit matrix, and store it at every point. */
+   nin = astGetNcoord( in );
+   matrix = astCalloc( nin*nin, sizeof( double ) );
+   if ( astOK ) {
+      for ( coord = 0; coord < nin; coord++ ) matrix[ coord*( nin + 1 ) ] = 1.0;
+      astLinearJacobian( in, nin, matrix, jac );
+   }
+   matrix = astFree( matrix );
+}
+
 static double Rate( AstMapping *this, double *at, int ax1, int ax2, int *status ){
 /*
 *  Name:
@@ -779,6 +779,7 @@ static const char *GetAttrib( AstObject *, const char *, int * );
 static int CanMerge( AstMapping *, int, AstMapping *, int, int * );
 static int CanSwap( AstMapping *, AstMapping *, int, int, int *, AstWcsMap **, int * );
 static int Equal( AstObject *, AstObject *, int * );
+static int ThreadSafe( AstMapping *, int * );
 static int GetNP( AstWcsMap *, int, int * );
 static int IsZenithal( AstWcsMap *, int * );
 static int LongRange( const PrjData *, struct AstPrjPrm *, double *, double *, int * );
@@ -2473,6 +2474,7 @@ void astInitWcsMapVtab_(  AstWcsMapVtab *vtab, const char *name, int *status ) {
    new member functions implemented here. */
    object->Equal = Equal;
    mapping->MapMerge = MapMerge;
+   mapping->ThreadSafe = ThreadSafe;
 
 /* Declare the destructor and copy constructor. */
    astSetDelete( (AstObjectVtab *) vtab, Delete );
@@ -4128,6 +4130,43 @@ static int TestPV( AstWcsMap *this, int i, int m, int *status ) {
    return ret;
 }
 
+static int ThreadSafe( AstMapping *this_mapping, int *status ){
+/*
+*  Name:
+*     ThreadSafe
+
+*  Purpose:
+*     Check if a WcsMap can transform points in several threads at once.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "wcsmap.h"
+*     int ThreadSafe( AstMapping *this, int *status )
+
+*  Class Membership:
+*     WcsMap member function (over-rides the protected astThreadSafe
+*     method inherited from the Mapping class).
+
+*  Description:
+*     This function returns zero if the intermediate values used by the
+*     projection have not yet been calculated (since they are calculated
+*     and stored in the WcsMap when the projection is first used).
+*     Otherwise it returns a non-zero value.
+
+*  Parameters:
+*     this
+*        Pointer to the WcsMap.
+*     status
+*        Pointer to the inherited status variable.
+*/
+   AstWcsMap *this;
+   if ( !astOK ) return 0;
+   this = (AstWcsMap *) this_mapping;
+   return ( this->params.flag != 0 );
+}
+
 static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
                                int forward, AstPointSet *out, int *status ) {
 /*
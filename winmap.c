@@ -215,6 +215,7 @@ AstWinMap *astWinMapId_( int, const double [], const double [],
 /* ======================================== */
 
 static AstPointSet *Transform( AstMapping *, AstPointSet *, int, AstPointSet *, int * );
+static void JacobianPoints( AstMapping *, AstPointSet *, int, AstPointSet *, int * );
 static AstWinMap *WinUnit( AstWinMap *, AstUnitMap *, int, int, int * );
 static AstWinMap *WinWin( AstMapping *, AstMapping *, int, int, int, int * );
 static AstWinMap *WinZoom( AstWinMap *, AstZoomMap *, int, int, int, int, int * );
@@ -850,6 +851,7 @@ void astInitWinMapVtab_(  AstWinMapVtab *vtab, const char *name, int *status ) {
    mapping->MapMerge = MapMerge;
    mapping->MapSplit = MapSplit;
    mapping->Rate = Rate;
+   mapping->JacobianPoints = JacobianPoints;
    mapping->GetIsLinear = GetIsLinear;
 
 /* Declare the class dump, copy and delete functions.*/
@@ -2036,6 +2038,92 @@ static void PermGet( AstPermMap *map, int **outperm, int **inperm,
    return;
 }
 
+static void JacobianPoints( AstMapping *this, AstPointSet *in, int forward,
+                            AstPointSet *jac, int *status ) {
+/*
+*  Name:
+*     JacobianPoints
+
+*  Purpose:
+*     Find the Jacobian matrix of a Mapping at a set of points.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "winmap.h"
+*     void JacobianPoints( AstMapping *this, AstPointSet *in, int forward,
+*                          AstPointSet *jac, int *status )
+
+*  Class Membership:
+*     WinMap member function (over-rides the astJacobianPoints protected
+*     method inherited from the Mapping class).
+
+*  Description:
+*     This function stores the Jacobian matrix of a WinMap (a diagonal
+*     matrix holding the scale factors, or their reciprocals) at each of
+*     the points in a PointSet.
+
+*  Parameters:
+*     this
+*        Pointer to the WinMap.
+*     in
+*        Pointer to the PointSet holding the positions at which the
+*        Jacobian is required.
+*     forward
+*        A non-zero value indicates that the Jacobian of the forward
+*        coordinate transformation is required, while a zero value
+*        requests the Jacobian of the inverse transformation.
+*     jac
+*        Pointer to the PointSet in which to store the Jacobian.
+*     status
+*        Pointer to the inherited status variable.
+*/
+
+/* Local Variables: */
+   AstWinMap *map;               /* Pointer to WinMap */
+   double *matrix;               /* Jacobian matrix */
+   double aa;                    /* Constant term */
+   double bb;                    /* Multiplicative term */
+   int coord;                    /* Coordinate index */
+   int nin;                      /* Number of input coordinates */
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* Get a pointer to the WinMap structure, and determine whether to use
+   the forward or inverse transformation. */
+   map = (AstWinMap *) this;
+   if ( astGetInvert( this ) ) forward = !forward;
+
+/* Form a diagonal matrix holding the scale factor for each axis. Axes
+   on which the WinMap is undefined (as in astTransform) get a bad
+   scale factor. */
+   nin = astGetNcoord( in );
+   matrix = astCalloc( nin*nin, sizeof( double ) );
+   if ( !( map->a && map->b ) && astOK ) {
+      astError( AST__BADWM, "astJacobianPoints(%s): The supplied %s does "
+                "not contain any window information.", status,
+                astGetClass( this ), astGetClass( this ) );
+   }
+   if ( astOK ) {
+      for ( coord = 0; coord < nin; coord++ ) {
+         aa = map->a[ coord ];
+         bb = map->b[ coord ];
+         if ( aa == AST__BAD || bb == AST__BAD || ( !forward && bb == 0.0 ) ) {
+            bb = AST__BAD;
+         } else if ( !forward ) {
+            bb = 1.0/bb;
+         }
+         matrix[ coord*( nin + 1 ) ] = bb;
+      }
+
+/* Store the matrix at every point. */
+      astLinearJacobian( in, nin, matrix, jac );
+   }
+   matrix = astFree( matrix );
+}
+
 static double Rate( AstMapping *this, double *at, int ax1, int ax2, int *status ){
 /*
 *  Name: